@@ -63,6 +63,11 @@ vomsProxy = "x509up_u93032" # Does NOT work on condor node
 reduceJobsMCBy     = 3
 reduceJobsDataBy   = 5
 
+# Merge the per-era Data samples of a year (..._2018A_Data_X, ..._2018B_Data_X)
+# into one year-only sample (..._2018_Data_X). runMain then picks the JEC era
+# per event from the run number, so the jobs span the whole year.
+mergeDataEras      = False
+
 
 # Base configuration template remains the same.
 baseConfig = {
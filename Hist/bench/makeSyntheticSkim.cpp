@@ -0,0 +1,630 @@
+// bench/makeSyntheticSkim.cpp
+//
+// Writes a deterministic NanoAOD-like skim ("Events" + "Runs") for the
+// benchmark harness (make bench, bench/runBench.py). Branch names and types
+// follow what SkimAdapter binds for the NanoVersion implied by the jet algo
+// (AK4Chs -> V9, AK4Puppi/AK8Puppi -> V15), so the whole event loop runs on
+// it unchanged. Every collection is written for every channel, as in a real
+// skim; the channel only decides which reference object (Z, photon, W lepton
+// or leading jet) the recoil jet balances.
+//
+// The same (options, seed) always produces the same file.
+
+#include "SkimBranch.hpp"
+
+#include <TFile.h>
+#include <TLorentzVector.h>
+#include <TRandom3.h>
+#include <TTree.h>
+#include <TVector2.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// ------------------------------------------------------------------
+// Typed branch buffers
+// ------------------------------------------------------------------
+template <typename T> struct LeafCode;
+template <> struct LeafCode<Float_t>   { static constexpr char c = 'F'; };
+template <> struct LeafCode<Double_t>  { static constexpr char c = 'D'; };
+template <> struct LeafCode<Int_t>     { static constexpr char c = 'I'; };
+template <> struct LeafCode<UInt_t>    { static constexpr char c = 'i'; };
+template <> struct LeafCode<Short_t>   { static constexpr char c = 'S'; };
+template <> struct LeafCode<UChar_t>   { static constexpr char c = 'b'; };
+template <> struct LeafCode<Bool_t>    { static constexpr char c = 'O'; };
+template <> struct LeafCode<Long64_t>  { static constexpr char c = 'L'; };
+template <> struct LeafCode<ULong64_t> { static constexpr char c = 'l'; };
+
+class Column {
+public:
+    virtual ~Column() = default;
+    virtual void set(int i, double v) = 0;
+    void set(double v) { set(0, v); }
+};
+
+template <typename T>
+class TypedColumn final : public Column {
+public:
+    TypedColumn(TTree& tree, const std::string& name, const std::string& count, int size)
+        : buf_(new T[size]()) {
+        std::string leaf = name;
+        if (!count.empty()) leaf += "[" + count + "]";
+        leaf += std::string("/") + LeafCode<T>::c;
+        tree.Branch(name.c_str(), buf_.get(), leaf.c_str());
+    }
+    void set(int i, double v) override { buf_[i] = static_cast<T>(v); }
+
+private:
+    std::unique_ptr<T[]> buf_; // not std::vector: vector<Bool_t> has no data()
+};
+
+class Schema {
+public:
+    explicit Schema(TTree& tree) : tree_(tree) {}
+
+    template <typename T>
+    Column* scalar(const std::string& name) {
+        return add_(std::make_unique<TypedColumn<T>>(tree_, name, "", 1));
+    }
+
+    template <typename T>
+    Column* array(const std::string& name, const std::string& count, int size) {
+        return add_(std::make_unique<TypedColumn<T>>(tree_, name, count, size));
+    }
+
+private:
+    Column* add_(std::unique_ptr<Column> c) {
+        cols_.push_back(std::move(c));
+        return cols_.back().get();
+    }
+
+    TTree& tree_;
+    std::vector<std::unique_ptr<Column>> cols_;
+};
+
+// ------------------------------------------------------------------
+// Options
+// ------------------------------------------------------------------
+struct Options {
+    std::string out;
+    std::string jetAlgo = "AK4Puppi";
+    std::string channel = "ZmmJet";
+    std::string year    = "2018";
+    bool isMC = false;
+    long long nEvents = 10000;
+    unsigned seed = 1;
+    double meanJets = 6.0;
+    double meanPhotons = 2.0;
+    double meanLeptons = 2.0;
+    std::vector<std::string> hlt;
+    unsigned run = 1;
+    unsigned lumiFirst = 1;
+    unsigned lumiLast = 1;
+    int eventsPerLumi = 200;
+};
+
+std::vector<std::string> splitComma(const std::string& s) {
+    std::vector<std::string> out;
+    std::stringstream ss(s);
+    std::string tok;
+    while (std::getline(ss, tok, ',')) {
+        if (!tok.empty()) out.push_back(tok);
+    }
+    return out;
+}
+
+[[noreturn]] void usage(const char* prog) {
+    std::cerr << "Usage: " << prog << " -o <out.root> [-a <jetAlgo>] [-c <channel>] [-y <year>] [-m]\n"
+              << "          [-n <events>] [-s <seed>] [-J <mean jets>] [-P <mean photons>]\n"
+              << "          [-L <mean leptons>] [-H <HLT_a,HLT_b>] [-r <run>] [-l <first>:<last>]\n"
+              << "  -m  write MC branches (gen jets, gen leptons/photons, weights) and a Runs tree\n";
+    std::exit(1);
+}
+
+Options parseOptions(int argc, char* argv[]) {
+    Options o;
+    int opt;
+    while ((opt = getopt(argc, argv, "o:a:c:y:mn:s:J:P:L:H:r:l:h")) != -1) {
+        switch (opt) {
+            case 'o': o.out = optarg; break;
+            case 'a': o.jetAlgo = optarg; break;
+            case 'c': o.channel = optarg; break;
+            case 'y': o.year = optarg; break;
+            case 'm': o.isMC = true; break;
+            case 'n': o.nEvents = std::stoll(optarg); break;
+            case 's': o.seed = static_cast<unsigned>(std::stoul(optarg)); break;
+            case 'J': o.meanJets = std::stod(optarg); break;
+            case 'P': o.meanPhotons = std::stod(optarg); break;
+            case 'L': o.meanLeptons = std::stod(optarg); break;
+            case 'H': o.hlt = splitComma(optarg); break;
+            case 'r': o.run = static_cast<unsigned>(std::stoul(optarg)); break;
+            case 'l': {
+                const std::string s = optarg;
+                const auto colon = s.find(':');
+                o.lumiFirst = static_cast<unsigned>(std::stoul(s.substr(0, colon)));
+                o.lumiLast  = colon == std::string::npos ? o.lumiFirst
+                                                         : static_cast<unsigned>(std::stoul(s.substr(colon + 1)));
+                break;
+            }
+            default: usage(argv[0]);
+        }
+    }
+    if (o.out.empty()) usage(argv[0]);
+    if (o.lumiLast < o.lumiFirst) o.lumiLast = o.lumiFirst;
+    return o;
+}
+
+// ------------------------------------------------------------------
+// Event content
+// ------------------------------------------------------------------
+struct Obj {
+    double pt, eta, phi, mass;
+    int charge = 0;
+    bool signal = false; // reference object: passes the channel's tight selection
+};
+
+int poissonAtLeast(TRandom3& rng, double mean, int least, int most) {
+    const int n = least + rng.Poisson(std::max(0.0, mean - least));
+    return std::min(n, most);
+}
+
+double wrapPhi(double phi) {
+    return TVector2::Phi_mpi_pi(phi);
+}
+
+// Two-body decay of `mother` into massless-ish daughters of mass m, isotropic in the rest frame.
+std::pair<Obj, Obj> decay(TRandom3& rng, const TLorentzVector& mother, double m) {
+    const double M = mother.M();
+    const double p = std::sqrt(std::max(0.0, M * M / 4.0 - m * m));
+    const double cosT = rng.Uniform(-1.0, 1.0);
+    const double sinT = std::sqrt(1.0 - cosT * cosT);
+    const double phi  = rng.Uniform(-M_PI, M_PI);
+    TLorentzVector d1(p * sinT * std::cos(phi), p * sinT * std::sin(phi), p * cosT, M / 2.0);
+    TLorentzVector d2(-d1.Px(), -d1.Py(), -d1.Pz(), M / 2.0);
+    d1.Boost(mother.BoostVector());
+    d2.Boost(mother.BoostVector());
+    const int q = rng.Rndm() < 0.5 ? 1 : -1;
+    return {Obj{d1.Pt(), d1.Eta(), d1.Phi(), m, q, true}, Obj{d2.Pt(), d2.Eta(), d2.Phi(), m, -q, true}};
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const Options o = parseOptions(argc, argv);
+
+    const bool isV15 = (o.jetAlgo != "AK4Chs");
+    const bool isAK8 = (o.jetAlgo == "AK8Puppi");
+    const bool isPuppi = (o.jetAlgo != "AK4Chs");
+    const std::string jet   = isAK8 ? "FatJet" : "Jet";
+    const std::string nJetN = isAK8 ? "nFatJet" : "nJet";
+    const std::string gen   = isAK8 ? "GenJetAK8" : "GenJet";
+    const std::string nGenN = isAK8 ? "nGenJetAK8" : "nGenJet";
+
+    const int nJetMax = SkimBranch::nJetMax;
+    const int nPhoMax = SkimBranch::nPhotonMax;
+    const int nEleMax = SkimBranch::nEleMax;
+    const int nMuMax  = SkimBranch::nMuonMax;
+    const int nGenMax = SkimBranch::nGenJetMax;
+
+    TFile fout(o.out.c_str(), "RECREATE");
+    if (fout.IsZombie()) {
+        throw std::runtime_error("makeSyntheticSkim - cannot create " + o.out);
+    }
+    TTree events("Events", "synthetic NanoAOD-like events");
+    Schema s(events);
+
+    // Counters: UInt_t in NanoV9, Int_t in NanoV15 (see SkimAdapter).
+    auto counter = [&](const std::string& name) {
+        return isV15 ? s.scalar<Int_t>(name) : s.scalar<UInt_t>(name);
+    };
+    // Index-like arrays: Int_t in V9, Short_t in V15.
+    auto index = [&](const std::string& name, const std::string& n, int size) {
+        return isV15 ? s.array<Short_t>(name, n, size) : s.array<Int_t>(name, n, size);
+    };
+    auto small = [&](const std::string& name, const std::string& n, int size) {
+        return isV15 ? s.array<UChar_t>(name, n, size) : s.array<Int_t>(name, n, size);
+    };
+
+    // ---------------- event / common ----------------
+    Column* cRun   = s.scalar<UInt_t>("run");
+    Column* cLumi  = s.scalar<UInt_t>("luminosityBlock");
+    Column* cEvent = s.scalar<ULong64_t>("event");
+    Column* cPre   = s.scalar<Float_t>("L1PreFiringWeight_Nom");
+    Column* cPreDn = s.scalar<Float_t>("L1PreFiringWeight_Dn");
+    Column* cPreUp = s.scalar<Float_t>("L1PreFiringWeight_Up");
+    Column* cRho   = s.scalar<Float_t>(isV15 ? "Rho_fixedGridRhoFastjetAll" : "fixedGridRhoFastjetAll");
+    Column* cPVz   = s.scalar<Float_t>("PV_z");
+    Column* cGVz   = s.scalar<Float_t>("GenVtx_z");
+    Column* cNpv   = isV15 ? s.scalar<UChar_t>("PV_npvs")     : s.scalar<Int_t>("PV_npvs");
+    Column* cNpvG  = isV15 ? s.scalar<UChar_t>("PV_npvsGood") : s.scalar<Int_t>("PV_npvsGood");
+
+    std::vector<Column*> cHlt;
+    for (const auto& name : o.hlt) cHlt.push_back(s.scalar<Bool_t>(name));
+
+    // ---------------- jets ----------------
+    Column* cNJet = counter(nJetN);
+    auto jetF = [&](const std::string& v) { return s.array<Float_t>(jet + "_" + v, nJetN, nJetMax); };
+    Column* cJPt = jetF("pt");
+    Column* cJEta = jetF("eta");
+    Column* cJPhi = jetF("phi");
+    Column* cJMass = jetF("mass");
+    Column* cJRaw = jetF("rawFactor");
+    Column* cJMuSub = jetF("muonSubtrFactor");
+    Column* cJArea = jetF("area");
+    Column* cJB = jetF("btagDeepFlavB");
+    Column* cJCvL = jetF("btagDeepFlavCvL");
+    Column* cJCvB = jetF("btagDeepFlavCvB");
+    Column* cJQG = jetF("btagDeepFlavQG");
+    Column* cJChH = jetF("chHEF");
+    Column* cJNeH = jetF("neHEF");
+    Column* cJChEm = jetF("chEmEF");
+    Column* cJNeEm = jetF("neEmEF");
+    Column* cJMu = jetF("muEF");
+    Column* cJChM = s.array<Short_t>(jet + "_chMultiplicity", nJetN, nJetMax);
+    Column* cJNeM = s.array<Short_t>(jet + "_neMultiplicity", nJetN, nJetMax);
+    Column* cJId = isV15 ? nullptr : s.array<Int_t>(jet + "_jetId", nJetN, nJetMax);
+    Column* cJMu1 = index("Jet_muonIdx1", nJetN, nJetMax);
+    Column* cJMu2 = index("Jet_muonIdx2", nJetN, nJetMax);
+    Column* cJEl1 = index("Jet_electronIdx1", nJetN, nJetMax);
+    Column* cJEl2 = index("Jet_electronIdx2", nJetN, nJetMax);
+
+    // ---------------- photons ----------------
+    Column* cNPho = counter("nPhoton");
+    auto phoF = [&](const std::string& v) { return s.array<Float_t>("Photon_" + v, "nPhoton", nPhoMax); };
+    Column* cPPt = phoF("pt");
+    Column* cPEta = phoF("eta");
+    Column* cPPhi = phoF("phi");
+    Column* cPMass = phoF("mass");
+    Column* cPHoe = phoF("hoe");
+    Column* cPR9 = phoF("r9");
+    Column* cPECorr = phoF("eCorr");
+    Column* cPEErr = phoF("energyErr");
+    Column* cPCut = small("Photon_cutBased", "nPhoton", nPhoMax);
+    Column* cPJet = index("Photon_jetIdx", "nPhoton", nPhoMax);
+    Column* cPGen = index("Photon_genPartIdx", "nPhoton", nPhoMax);
+    Column* cPMva = s.array<Bool_t>("Photon_mvaID_WP80", "nPhoton", nPhoMax);
+    Column* cPGain = s.array<UChar_t>("Photon_seedGain", "nPhoton", nPhoMax);
+    Column* cPPix = s.array<Bool_t>("Photon_pixelSeed", "nPhoton", nPhoMax);
+    Column* cPVeto = s.array<Bool_t>("Photon_electronVeto", "nPhoton", nPhoMax);
+
+    // ---------------- electrons ----------------
+    Column* cNEle = counter("nElectron");
+    auto eleF = [&](const std::string& v) { return s.array<Float_t>("Electron_" + v, "nElectron", nEleMax); };
+    Column* cEPt = eleF("pt");
+    Column* cEEta = eleF("eta");
+    Column* cEPhi = eleF("phi");
+    Column* cEMass = eleF("mass");
+    Column* cEDEta = eleF("deltaEtaSC");
+    Column* cECorr = eleF("eCorr");
+    Column* cEGain = eleF("seedGain");
+    Column* cEQ = s.array<Int_t>("Electron_charge", "nElectron", nEleMax);
+    Column* cECut = small("Electron_cutBased", "nElectron", nEleMax);
+
+    // ---------------- muons ----------------
+    Column* cNMu = counter("nMuon");
+    auto muF = [&](const std::string& v) { return s.array<Float_t>("Muon_" + v, "nMuon", nMuMax); };
+    Column* cMPt = muF("pt");
+    Column* cMEta = muF("eta");
+    Column* cMPhi = muF("phi");
+    Column* cMMass = muF("mass");
+    Column* cMIso = muF("pfRelIso04_all");
+    Column* cMTkIso = muF("tkRelIso");
+    Column* cMDxy = muF("dxy");
+    Column* cMDz = muF("dz");
+    Column* cMQ = s.array<Int_t>("Muon_charge", "nMuon", nMuMax);
+    Column* cMLay = small("Muon_nTrackerLayers", "nMuon", nMuMax);
+    Column* cMMed = s.array<Bool_t>("Muon_mediumId", "nMuon", nMuMax);
+    Column* cMTight = s.array<Bool_t>("Muon_tightId", "nMuon", nMuMax);
+    Column* cMHp = s.array<Bool_t>("Muon_highPurity", "nMuon", nMuMax);
+
+    // ---------------- MET ----------------
+    Column* cRawMetPt  = s.scalar<Float_t>(isPuppi ? "RawPuppiMET_pt"  : "RawMET_pt");
+    Column* cRawMetPhi = s.scalar<Float_t>(isPuppi ? "RawPuppiMET_phi" : "RawMET_phi");
+    Column* cMetPt     = s.scalar<Float_t>(isPuppi ? "PuppiMET_pt"     : "MET_pt");
+    Column* cMetPhi    = s.scalar<Float_t>(isPuppi ? "PuppiMET_phi"    : "MET_phi");
+
+    // ---------------- MC ----------------
+    Column *cGenW = nullptr, *cNTrue = nullptr, *cLheHt = nullptr;
+    Column *cNGen = nullptr, *cGPt = nullptr, *cGEta = nullptr, *cGPhi = nullptr, *cGMass = nullptr;
+    Column *cGPf = nullptr, *cGHf = nullptr, *cJPf = nullptr, *cJHf = nullptr, *cJGen = nullptr;
+    Column *cNGPho = nullptr, *cGPhoPt = nullptr, *cGPhoEta = nullptr, *cGPhoPhi = nullptr, *cGPhoMass = nullptr;
+    Column *cNGLep = nullptr, *cGLPt = nullptr, *cGLEta = nullptr, *cGLPhi = nullptr, *cGLMass = nullptr, *cGLId = nullptr;
+    if (o.isMC) {
+        cGenW  = s.scalar<Float_t>("genWeight");
+        cNTrue = s.scalar<Float_t>("Pileup_nTrueInt");
+        cLheHt = s.scalar<Float_t>("LHE_HT");
+
+        cNGen = counter(nGenN);
+        cGPt   = s.array<Float_t>(gen + "_pt",   nGenN, nGenMax);
+        cGEta  = s.array<Float_t>(gen + "_eta",  nGenN, nGenMax);
+        cGPhi  = s.array<Float_t>(gen + "_phi",  nGenN, nGenMax);
+        cGMass = s.array<Float_t>(gen + "_mass", nGenN, nGenMax);
+        cGPf = index(gen + "_partonFlavour", nGenN, nGenMax);
+        cGHf = index(gen + "_hadronFlavour", nGenN, nGenMax);
+
+        cJPf  = index(jet + "_partonFlavour", nJetN, nJetMax);
+        cJHf  = isV15 ? s.array<UChar_t>(jet + "_hadronFlavour", nJetN, nJetMax)
+                      : s.array<Int_t>(jet + "_hadronFlavour", nJetN, nJetMax);
+        cJGen = index(isAK8 ? "FatJet_genJetAK8Idx" : "Jet_genJetIdx", nJetN, nJetMax);
+
+        cNGPho    = counter("nGenIsolatedPhoton");
+        cGPhoPt   = s.array<Float_t>("GenIsolatedPhoton_pt",   "nGenIsolatedPhoton", nPhoMax);
+        cGPhoEta  = s.array<Float_t>("GenIsolatedPhoton_eta",  "nGenIsolatedPhoton", nPhoMax);
+        cGPhoPhi  = s.array<Float_t>("GenIsolatedPhoton_phi",  "nGenIsolatedPhoton", nPhoMax);
+        cGPhoMass = s.array<Float_t>("GenIsolatedPhoton_mass", "nGenIsolatedPhoton", nPhoMax);
+
+        cNGLep  = counter("nGenDressedLepton");
+        cGLPt   = s.array<Float_t>("GenDressedLepton_pt",   "nGenDressedLepton", nEleMax);
+        cGLEta  = s.array<Float_t>("GenDressedLepton_eta",  "nGenDressedLepton", nEleMax);
+        cGLPhi  = s.array<Float_t>("GenDressedLepton_phi",  "nGenDressedLepton", nEleMax);
+        cGLMass = s.array<Float_t>("GenDressedLepton_mass", "nGenDressedLepton", nEleMax);
+        cGLId   = s.array<Int_t>("GenDressedLepton_pdgId",  "nGenDressedLepton", nEleMax);
+    }
+
+    // ------------------------------------------------------------------
+    // Event loop
+    // ------------------------------------------------------------------
+    TRandom3 rng(o.seed);
+    const bool isZee = (o.channel == "ZeeJet");
+    const bool isZmm = (o.channel == "ZmmJet");
+    const bool isGam = (o.channel == "GamJet" || o.channel == "GamJetFake");
+    const bool isWe  = (o.channel == "Wqqe");
+    const bool isWm  = (o.channel == "Wqqm");
+    const unsigned nLumi = o.lumiLast - o.lumiFirst + 1;
+    double sumGenWeight = 0.0;
+
+    std::vector<Obj> jets, photons, electrons, muons;
+    for (long long iev = 0; iev < o.nEvents; ++iev) {
+        jets.clear();
+        photons.clear();
+        electrons.clear();
+        muons.clear();
+
+        cRun->set(o.run);
+        cLumi->set(o.lumiFirst + static_cast<unsigned>(iev / o.eventsPerLumi) % nLumi);
+        cEvent->set(static_cast<double>(iev + 1));
+        cPre->set(0.98);
+        cPreDn->set(0.97);
+        cPreUp->set(0.99);
+        cRho->set(rng.Uniform(5.0, 40.0));
+        const double pvz = rng.Gaus(0.0, 4.0);
+        cPVz->set(pvz);
+        cGVz->set(pvz + rng.Gaus(0.0, 0.01));
+        const int npv = std::min(120, 1 + rng.Poisson(30.0));
+        cNpv->set(npv);
+        cNpvG->set(std::max(1, npv - rng.Poisson(2.0)));
+        for (auto* c : cHlt) c->set(1.0);
+
+        // Reference object and the recoil it balances.
+        TLorentzVector ref;
+        double nuPt = 0.0, nuPhi = 0.0;
+        if (isZee || isZmm) {
+            const double m = isZee ? 0.000511 : 0.1057;
+            ref.SetPtEtaPhiM(15.0 + rng.Exp(60.0), rng.Gaus(0.0, 1.2), rng.Uniform(-M_PI, M_PI),
+                             std::max(60.0, 91.19 + rng.BreitWigner(0.0, 2.5)));
+            auto [l1, l2] = decay(rng, ref, m);
+            (isZee ? electrons : muons).push_back(l1);
+            (isZee ? electrons : muons).push_back(l2);
+        } else if (isGam) {
+            ref.SetPtEtaPhiM(40.0 + rng.Exp(150.0), rng.Gaus(0.0, 0.8), rng.Uniform(-M_PI, M_PI), 0.0);
+            photons.push_back(Obj{ref.Pt(), ref.Eta(), ref.Phi(), 0.0, 0, true});
+        } else if (isWe || isWm) {
+            const double m = isWe ? 0.000511 : 0.1057;
+            ref.SetPtEtaPhiM(30.0 + rng.Exp(40.0), rng.Gaus(0.0, 1.0), rng.Uniform(-M_PI, M_PI), m);
+            (isWe ? electrons : muons).push_back(Obj{ref.Pt(), ref.Eta(), ref.Phi(), m, rng.Rndm() < 0.5 ? 1 : -1, true});
+            nuPt = 20.0 + rng.Exp(30.0);
+            nuPhi = wrapPhi(ref.Phi() + rng.Gaus(M_PI, 0.8));
+        } else {
+            ref.SetPtEtaPhiM(30.0 + rng.Exp(200.0), rng.Gaus(0.0, 1.5), rng.Uniform(-M_PI, M_PI), 10.0);
+            jets.push_back(Obj{ref.Pt(), ref.Eta(), ref.Phi(), ref.M()});
+        }
+
+        // Recoil jet opposite the reference, then soft activity.
+        jets.push_back(Obj{ref.Pt() * std::max(0.2, rng.Gaus(1.0, 0.15)), rng.Gaus(0.0, 1.5),
+                           wrapPhi(ref.Phi() + M_PI + rng.Gaus(0.0, 0.1)), rng.Uniform(5.0, 20.0)});
+        const int nJet = poissonAtLeast(rng, o.meanJets, static_cast<int>(jets.size()), nJetMax);
+        while (static_cast<int>(jets.size()) < nJet) {
+            jets.push_back(Obj{15.0 + rng.Exp(20.0), rng.Uniform(-4.7, 4.7), rng.Uniform(-M_PI, M_PI),
+                               rng.Uniform(2.0, 8.0)});
+        }
+        std::sort(jets.begin(), jets.end(), [](const Obj& a, const Obj& b) { return a.pt > b.pt; });
+
+        auto fillExtra = [&](std::vector<Obj>& v, double mean, int max, double mass) {
+            const int n = poissonAtLeast(rng, mean, static_cast<int>(v.size()), max);
+            while (static_cast<int>(v.size()) < n) {
+                v.push_back(Obj{5.0 + rng.Exp(10.0), rng.Uniform(-2.5, 2.5), rng.Uniform(-M_PI, M_PI), mass,
+                                rng.Rndm() < 0.5 ? 1 : -1});
+            }
+            std::sort(v.begin(), v.end(), [](const Obj& a, const Obj& b) { return a.pt > b.pt; });
+        };
+        fillExtra(photons, o.meanPhotons, nPhoMax, 0.0);
+        fillExtra(electrons, o.meanLeptons, nEleMax, 0.000511);
+        fillExtra(muons, o.meanLeptons, nMuMax, 0.1057);
+
+        // ---------------- jets ----------------
+        double ht = 0.0;
+        cNJet->set(static_cast<double>(jets.size()));
+        for (int i = 0; i < static_cast<int>(jets.size()); ++i) {
+            const Obj& j = jets[i];
+            ht += j.pt;
+            cJPt->set(i, j.pt);
+            cJEta->set(i, j.eta);
+            cJPhi->set(i, j.phi);
+            cJMass->set(i, j.mass);
+            cJRaw->set(i, rng.Uniform(0.02, 0.15));
+            cJMuSub->set(i, rng.Uniform(0.0, 0.02));
+            cJArea->set(i, isAK8 ? rng.Gaus(2.0, 0.05) : rng.Gaus(0.5, 0.03));
+            cJB->set(i, rng.Rndm());
+            cJCvL->set(i, rng.Rndm());
+            cJCvB->set(i, rng.Rndm());
+            cJQG->set(i, rng.Rndm());
+            const double ch = rng.Uniform(0.4, 0.7);
+            const double ne = rng.Uniform(0.05, 0.2);
+            const double chEm = rng.Uniform(0.0, 0.1);
+            const double mu = rng.Uniform(0.0, 0.02);
+            cJChH->set(i, ch);
+            cJNeH->set(i, ne);
+            cJChEm->set(i, chEm);
+            cJMu->set(i, mu);
+            cJNeEm->set(i, std::max(0.0, 1.0 - ch - ne - chEm - mu));
+            cJChM->set(i, 1 + rng.Poisson(10.0));
+            cJNeM->set(i, 1 + rng.Poisson(6.0));
+            if (cJId) cJId->set(i, 6);
+            cJMu1->set(i, -1);
+            cJMu2->set(i, -1);
+            cJEl1->set(i, -1);
+            cJEl2->set(i, -1);
+        }
+
+        // ---------------- photons ----------------
+        cNPho->set(static_cast<double>(photons.size()));
+        for (int i = 0; i < static_cast<int>(photons.size()); ++i) {
+            const Obj& p = photons[i];
+            const bool lead = p.signal;
+            cPPt->set(i, p.pt);
+            cPEta->set(i, p.eta);
+            cPPhi->set(i, p.phi);
+            cPMass->set(i, 0.0);
+            cPHoe->set(i, lead ? 0.01 : rng.Uniform(0.0, 0.3));
+            cPR9->set(i, lead ? 0.95 : rng.Uniform(0.5, 1.0));
+            cPECorr->set(i, 1.0);
+            cPEErr->set(i, 0.02 * p.pt);
+            cPCut->set(i, lead ? 3 : rng.Integer(4));
+            cPJet->set(i, -1);
+            cPGen->set(i, o.isMC && lead ? 0 : -1);
+            cPMva->set(i, lead || rng.Rndm() < 0.3);
+            cPGain->set(i, 12);
+            cPPix->set(i, !lead && rng.Rndm() < 0.2);
+            cPVeto->set(i, lead || rng.Rndm() < 0.8);
+        }
+
+        // ---------------- electrons ----------------
+        cNEle->set(static_cast<double>(electrons.size()));
+        for (int i = 0; i < static_cast<int>(electrons.size()); ++i) {
+            const Obj& e = electrons[i];
+            const bool signal = e.signal;
+            cEPt->set(i, e.pt);
+            cEEta->set(i, e.eta);
+            cEPhi->set(i, e.phi);
+            cEMass->set(i, e.mass);
+            cEDEta->set(i, rng.Gaus(0.0, 0.01));
+            cECorr->set(i, 1.0);
+            cEGain->set(i, 12);
+            cEQ->set(i, e.charge);
+            cECut->set(i, signal ? 4 : rng.Integer(5));
+        }
+
+        // ---------------- muons ----------------
+        cNMu->set(static_cast<double>(muons.size()));
+        for (int i = 0; i < static_cast<int>(muons.size()); ++i) {
+            const Obj& m = muons[i];
+            const bool signal = m.signal;
+            cMPt->set(i, m.pt);
+            cMEta->set(i, m.eta);
+            cMPhi->set(i, m.phi);
+            cMMass->set(i, m.mass);
+            cMIso->set(i, signal ? 0.05 : rng.Uniform(0.0, 1.0));
+            cMTkIso->set(i, signal ? 0.03 : rng.Uniform(0.0, 1.0));
+            cMDxy->set(i, rng.Gaus(0.0, 0.002));
+            cMDz->set(i, rng.Gaus(0.0, 0.01));
+            cMQ->set(i, m.charge);
+            cMLay->set(i, 8 + rng.Integer(10));
+            cMMed->set(i, signal || rng.Rndm() < 0.5);
+            cMTight->set(i, signal || rng.Rndm() < 0.4);
+            cMHp->set(i, true);
+        }
+
+        // ---------------- MET ----------------
+        const double metPhi = nuPt > 0.0 ? nuPhi : rng.Uniform(-M_PI, M_PI);
+        const double metPt  = nuPt > 0.0 ? nuPt : std::abs(rng.Gaus(0.0, 20.0));
+        cRawMetPt->set(metPt * rng.Gaus(1.0, 0.05));
+        cRawMetPhi->set(metPhi);
+        cMetPt->set(metPt);
+        cMetPhi->set(metPhi);
+
+        // ---------------- MC ----------------
+        if (o.isMC) {
+            const double w = 1.0;
+            sumGenWeight += w;
+            cGenW->set(w);
+            cNTrue->set(std::max(1.0, rng.Gaus(30.0, 8.0)));
+            cLheHt->set(ht);
+
+            const int nGen = std::min(static_cast<int>(jets.size()), nGenMax);
+            cNGen->set(nGen);
+            for (int i = 0; i < nGen; ++i) {
+                const Obj& j = jets[i];
+                static const int kFlavour[] = {1, 2, 3, 4, 5, 21, 21, 21};
+                const int pf = kFlavour[rng.Integer(8)];
+                const int hf = (pf == 5 || pf == 4) ? pf : 0;
+                cGPt->set(i, j.pt / std::max(0.3, rng.Gaus(1.0, 0.1)));
+                cGEta->set(i, j.eta + rng.Gaus(0.0, 0.02));
+                cGPhi->set(i, wrapPhi(j.phi + rng.Gaus(0.0, 0.02)));
+                cGMass->set(i, j.mass);
+                cGPf->set(i, pf);
+                cGHf->set(i, hf);
+                cJPf->set(i, pf);
+                cJHf->set(i, hf);
+                cJGen->set(i, i);
+            }
+
+            int nGPho = 0;
+            for (const Obj& p : photons) {
+                if (!p.signal) continue;
+                cGPhoPt->set(nGPho, p.pt * rng.Gaus(1.0, 0.02));
+                cGPhoEta->set(nGPho, p.eta);
+                cGPhoPhi->set(nGPho, p.phi);
+                cGPhoMass->set(nGPho, 0.0);
+                ++nGPho;
+            }
+            cNGPho->set(nGPho);
+
+            int nGLep = 0;
+            auto fillGenLep = [&](const std::vector<Obj>& leps, int pdg) {
+                for (const Obj& l : leps) {
+                    if (!l.signal) continue;
+                    cGLPt->set(nGLep, l.pt * rng.Gaus(1.0, 0.01));
+                    cGLEta->set(nGLep, l.eta);
+                    cGLPhi->set(nGLep, l.phi);
+                    cGLMass->set(nGLep, l.mass);
+                    cGLId->set(nGLep, -pdg * l.charge);
+                    ++nGLep;
+                }
+            };
+            fillGenLep(electrons, 11);
+            fillGenLep(muons, 13);
+            cNGLep->set(nGLep);
+        }
+
+        events.Fill();
+    }
+    events.Write();
+
+    if (o.isMC) {
+        TTree runs("Runs", "synthetic Runs");
+        Long64_t genEventCount = o.nEvents;
+        Double_t genEventSumw = sumGenWeight;
+        UInt_t run = o.run;
+        runs.Branch("run", &run, "run/i");
+        runs.Branch("genEventCount", &genEventCount, "genEventCount/L");
+        runs.Branch("genEventSumw", &genEventSumw, "genEventSumw/D");
+        runs.Fill();
+        runs.Write();
+    }
+    fout.Close();
+
+    std::cout << "[makeSyntheticSkim] " << o.nEvents << " events ("
+              << (isV15 ? "NanoV15" : "NanoV9") << ", " << o.jetAlgo << ", " << o.channel
+              << (o.isMC ? ", MC" : ", Data") << ") -> " << o.out << '\n';
+    return 0;
+}
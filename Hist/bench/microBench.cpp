@@ -0,0 +1,397 @@
+// bench/microBench.cpp
+//
+// Micro-benchmarks of the per-event hot paths (make microbench). Each kernel
+// is called on fixed, deterministic inputs and reported as ns/call and heap
+// allocations/call, so a change to one subsystem can be judged on its own:
+//
+//   ScaleJetFunction  L1FastJet, L2Relative, L2Residual, L2L3Residual, JER
+//   PickEvent         passGoodLumi, passJetVetoMap
+//   SkimAdapter       afterGetEntry, alone and with every V15 collection required
+//   HistL3Residual    fillHistos
+//   MathHdm           calcResponse, and the bare HdmKernel::compute
+//   EtaIndex          build over 30 gen jets + two closest-match queries
+//   MathTTbar         minimizeChiSqr (with the per-event setEventObjects)
+//
+// Run from Hist/ (reads config/ and POG/ like runMain). The SkimAdapter
+// kernel needs a NanoV15 MC skim from bench/makeSyntheticSkim (-i).
+
+#include "GlobalFlag.h"
+#include "HistL3Residual.h"
+#include "HistL3ResidualInput.hpp"
+#include "MathHdm.h"
+#include "MathTTbar.h"
+#include "PairMatch.hpp"
+#include "PickEvent.h"
+#include "ScaleJetFunction.h"
+#include "SkimAdapter.h"
+#include "SkimTree.h"
+#include "VarBin.h"
+
+#include <TChain.h>
+#include <TLorentzVector.h>
+#include <TMemFile.h>
+#include <TRandom3.h>
+
+#include <nlohmann/json.hpp>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// ------------------------------------------------------------------
+// Allocation counting: every operator new in the process goes through here.
+// (Aligned new is not counted; nothing on these paths uses it.)
+// ------------------------------------------------------------------
+namespace {
+std::atomic<long long> gAllocs{0};
+std::atomic<long long> gAllocBytes{0};
+
+void* countedAlloc(std::size_t n) {
+    gAllocs.fetch_add(1, std::memory_order_relaxed);
+    gAllocBytes.fetch_add(static_cast<long long>(n), std::memory_order_relaxed);
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+} // namespace
+
+void* operator new(std::size_t n) { return countedAlloc(n); }
+void* operator new[](std::size_t n) { return countedAlloc(n); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+using json = nlohmann::json;
+using Clock = std::chrono::steady_clock;
+
+volatile double gSink = 0.0; // keeps results observable
+
+struct Result {
+    std::string name;
+    long long calls = 0;
+    double nsMin = 0.0;
+    double nsMedian = 0.0;
+    double allocsPerCall = 0.0;
+    double bytesPerCall = 0.0;
+};
+
+// Five timed batches of `reps` calls after one warm-up batch; f(i) gets the
+// call number so kernels can cycle through their fixed inputs.
+Result measure(const std::string& name, long long reps, const std::function<double(long long)>& f) {
+    constexpr int kBatches = 5;
+    for (long long i = 0; i < std::max(1LL, reps / 10); ++i) gSink = gSink + f(i);
+
+    std::vector<double> ns;
+    const long long a0 = gAllocs.load();
+    const long long b0 = gAllocBytes.load();
+    for (int b = 0; b < kBatches; ++b) {
+        const auto t0 = Clock::now();
+        double acc = 0.0;
+        for (long long i = 0; i < reps; ++i) acc += f(i);
+        const auto t1 = Clock::now();
+        gSink = gSink + acc;
+        ns.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / reps);
+    }
+    std::sort(ns.begin(), ns.end());
+
+    Result r;
+    r.name = name;
+    r.calls = reps * kBatches;
+    r.nsMin = ns.front();
+    r.nsMedian = ns[kBatches / 2];
+    r.allocsPerCall = static_cast<double>(gAllocs.load() - a0) / r.calls;
+    r.bytesPerCall = static_cast<double>(gAllocBytes.load() - b0) / r.calls;
+    return r;
+}
+
+struct Options {
+    long long reps = 20000;
+    std::string v15Skim;
+    std::string out;
+    std::string filter;
+};
+
+[[noreturn]] void usage(const char* prog) {
+    std::cerr << "Usage: " << prog << " [-n <calls per batch>] [-i <NanoV15 MC skim>] [-o <results.json>]"
+              << " [-f <name filter>]\n";
+    std::exit(1);
+}
+
+// Fixed jets for the SkimTree-based kernels: a balanced pair, two b jets and soft activity.
+void fillJets(SkimTree& t) {
+    static const float pt[]  = {182.0f, 151.0f, 74.0f, 58.0f, 41.0f, 33.0f, 24.0f, 17.0f};
+    static const float eta[] = {0.31f, -1.12f, 2.05f, -0.48f, 1.63f, -2.71f, 3.4f, -0.9f};
+    static const float phi[] = {0.5f, -2.6f, 1.9f, -0.7f, 2.8f, -1.4f, 0.1f, 3.0f};
+    static const float btag[] = {0.02f, 0.05f, 0.91f, 0.88f, 0.10f, 0.03f, 0.01f, 0.2f};
+    t.nJet = 8;
+    t.nGenJet = 8;
+    t.run = 315257;
+    t.luminosityBlock = 10;
+    t.event = 1;
+    t.Rho = 21.5f;
+    for (int i = 0; i < 8; ++i) {
+        t.Jet_pt[i] = t.Jet_ptNano[i] = pt[i];
+        t.Jet_eta[i] = eta[i];
+        t.Jet_phi[i] = phi[i];
+        t.Jet_mass[i] = t.Jet_massNano[i] = 0.1f * pt[i];
+        t.Jet_area[i] = 0.5f;
+        t.Jet_rawFactor[i] = 0.08f;
+        t.Jet_jetId[i] = 6;
+        t.Jet_chHEF[i] = 0.6f;
+        t.Jet_neHEF[i] = 0.1f;
+        t.Jet_chEmEF[i] = 0.05f;
+        t.Jet_neEmEF[i] = 0.2f;
+        t.Jet_muEF[i] = 0.01f;
+        t.Jet_chMultiplicity[i] = 12;
+        t.Jet_neMultiplicity[i] = 6;
+        t.Jet_btagDeepFlavB[i] = btag[i];
+        t.Jet_genJetIdx[i] = i;
+        t.GenJet_pt[i] = 0.97f * pt[i];
+        t.GenJet_eta[i] = eta[i];
+        t.GenJet_phi[i] = phi[i];
+        t.GenJet_mass[i] = 0.1f * pt[i];
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options o;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:i:o:f:h")) != -1) {
+        switch (opt) {
+            case 'n': o.reps = std::stoll(optarg); break;
+            case 'i': o.v15Skim = optarg; break;
+            case 'o': o.out = optarg; break;
+            case 'f': o.filter = optarg; break;
+            default: usage(argv[0]);
+        }
+    }
+    auto wanted = [&](const std::string& name) {
+        return o.filter.empty() || name.find(o.filter) != std::string::npos;
+    };
+
+    GlobalFlag gfDataDer("AK4Puppi_L3Residual_ZmmJet_2018A_Data_Synthetic_HistDerivationBase_1of1.root");
+    GlobalFlag gfDataClo("AK4Puppi_L3Residual_ZmmJet_2018A_Data_Synthetic_HistClosureBase_1of1.root");
+    GlobalFlag gfMc("AK4Puppi_L3Residual_ZmmJet_2018_MC_Synthetic_HistDerivationBase_1of1.root");
+    GlobalFlag gfWqqm("AK4Puppi_L3Residual_Wqqm_2018_MC_Synthetic_HistDerivationBase_1of1.root");
+
+    // Fixed per-call inputs, cycled with a power-of-two mask.
+    constexpr int kN = 1024;
+    constexpr int kMask = kN - 1;
+    TRandom3 rng(2024);
+    std::vector<double> jPt(kN), jEta(kN), jArea(kN), rho(kN);
+    std::vector<unsigned> lRun(kN), lLumi(kN);
+    std::vector<HistL3ResidualInput> l3In(kN);
+    std::vector<TLorentzVector> met(kN), ref(kN), jet1(kN), jetn(kN);
+    for (int i = 0; i < kN; ++i) {
+        jPt[i] = 15.0 + rng.Exp(80.0);
+        jEta[i] = rng.Uniform(-5.0, 5.0);
+        jArea[i] = rng.Gaus(0.5, 0.03);
+        rho[i] = rng.Uniform(5.0, 40.0);
+        lRun[i] = 315252 + rng.Integer(325175 - 315252);
+        lLumi[i] = 1 + rng.Integer(500);
+
+        HistL3ResidualInput& in = l3In[i];
+        in.ptTag = 15.0 + rng.Exp(60.0);
+        in.ptProbe = in.ptTag * rng.Gaus(1.0, 0.15);
+        in.ptMet = rng.Exp(20.0);
+        in.ptOther = rng.Exp(10.0);
+        in.ptUnclustered = rng.Exp(15.0);
+        in.etaProbe = rng.Uniform(-1.3, 1.3);
+        in.respDb = rng.Gaus(1.0, 0.15);
+        in.respMpf = rng.Gaus(1.0, 0.1);
+        in.respMpf1 = rng.Gaus(1.0, 0.1);
+        in.respMpfn = rng.Gaus(0.0, 0.05);
+        in.respMpfu = rng.Gaus(0.0, 0.05);
+        in.respMpfnu = rng.Gaus(0.0, 0.05);
+        in.weight = 1.0;
+
+        const double phiRef = rng.Uniform(-M_PI, M_PI);
+        ref[i].SetPtEtaPhiM(in.ptTag, rng.Gaus(0.0, 1.0), phiRef, 91.2);
+        jet1[i].SetPtEtaPhiM(in.ptProbe, in.etaProbe, phiRef + M_PI + rng.Gaus(0.0, 0.1), 10.0);
+        jetn[i].SetPtEtaPhiM(in.ptOther, rng.Uniform(-4.7, 4.7), rng.Uniform(-M_PI, M_PI), 3.0);
+        met[i].SetPtEtaPhiM(in.ptMet, 0.0, rng.Uniform(-M_PI, M_PI), 0.0);
+    }
+
+    std::vector<Result> results;
+    auto run = [&](const std::string& name, long long reps, const std::function<double(long long)>& f) {
+        if (!wanted(name)) return;
+        results.push_back(measure(name, reps, f));
+        const Result& r = results.back();
+        std::cout << "[microBench] " << std::left << std::setw(48) << r.name << std::right
+                  << std::fixed << std::setprecision(1) << std::setw(10) << r.nsMedian << " ns/call"
+                  << std::setprecision(2) << std::setw(9) << r.allocsPerCall << " allocs/call\n";
+    };
+
+    // ---------------- ScaleJetFunction ----------------
+    {
+        ScaleJetFunction der(gfDataDer);
+        ScaleJetFunction clo(gfDataClo);
+        run("ScaleJetFunction::getL1FastJetCorrection", o.reps, [&](long long i) {
+            const int k = i & kMask;
+            return der.getL1FastJetCorrection(jArea[k], jEta[k], jPt[k], rho[k]);
+        });
+        run("ScaleJetFunction::getL2RelativeCorrection", o.reps, [&](long long i) {
+            const int k = i & kMask;
+            return der.getL2RelativeCorrection(jEta[k], jPt[k]);
+        });
+        run("ScaleJetFunction::getL2ResidualCorrection", o.reps, [&](long long i) {
+            const int k = i & kMask;
+            return der.getL2ResidualCorrection(jEta[k], jPt[k]);
+        });
+        run("ScaleJetFunction::getL2L3ResidualCorrection", o.reps, [&](long long i) {
+            const int k = i & kMask;
+            return clo.getL2L3ResidualCorrection(jEta[k], jPt[k]);
+        });
+    }
+    {
+        ScaleJetFunction mc(gfMc);
+        SkimTree skimT(gfMc);
+        fillJets(skimT);
+        run("ScaleJetFunction::getJerResolution", o.reps, [&](long long i) {
+            return mc.getJerResolution(skimT, static_cast<int>(i & 7));
+        });
+        run("ScaleJetFunction::getJerCorrection(nom)", o.reps, [&](long long i) {
+            const int j = static_cast<int>(i & 7);
+            return mc.getJerCorrection(skimT, j, "nom", skimT.Jet_pt[j]);
+        });
+    }
+
+    // ---------------- PickEvent ----------------
+    {
+        PickEvent pick(gfDataDer);
+        SkimTree skimT(gfDataDer);
+        fillJets(skimT);
+        run("PickEvent::passGoodLumi", o.reps, [&](long long i) {
+            const int k = i & kMask;
+            return pick.passGoodLumi(lRun[k], lLumi[k]) ? 1.0 : 0.0;
+        });
+        run("PickEvent::passJetVetoMap", o.reps, [&](long long) {
+            return pick.passJetVetoMap(skimT) ? 1.0 : 0.0;
+        });
+    }
+
+    // ---------------- SkimAdapter ----------------
+    if (!o.v15Skim.empty() && wanted("SkimAdapter::")) {
+        SkimBranch br;
+        SkimAdapter adapter(gfMc, br);
+        TChain chain("Events");
+        chain.Add(o.v15Skim.c_str());
+        adapter.setupCommonBranches(&chain);
+        adapter.setupJetBranches(&chain);
+        adapter.setupLeptonBranches(&chain);
+        adapter.setupMCBranches(&chain);
+        adapter.setupMetBranches(&chain);
+        chain.GetEntry(0);
+        run("SkimAdapter::afterGetEntry(V15->V9)", o.reps, [&](long long) {
+            adapter.afterGetEntry();
+            return static_cast<double>(br.nJet);
+        });
+        run("SkimAdapter::afterGetEntry+require(all)", o.reps, [&](long long) {
+            adapter.afterGetEntry();
+            br.require(~0u);
+            return static_cast<double>(br.Jet_chMultiplicity[0]);
+        });
+    } else if (o.v15Skim.empty()) {
+        std::cout << "[microBench] no -i <NanoV15 skim>: SkimAdapter kernel skipped\n";
+    }
+
+    // ---------------- HistL3Residual ----------------
+    {
+        TMemFile mem("microBench.root", "RECREATE");
+        VarBin varBin(gfMc);
+        HistL3Residual hist(&mem, "passL3Residual", varBin);
+        run("HistL3Residual::fillHistos", o.reps, [&](long long i) {
+            hist.fillHistos(l3In[i & kMask]);
+            return 0.0;
+        });
+    }
+
+    // ---------------- MathHdm ----------------
+    {
+        MathHdm hdm(gfMc);
+        run("MathHdm::calcResponse", o.reps, [&](long long i) {
+            const int k = i & kMask;
+            hdm.calcResponse(met[k], ref[k], jet1[k], jetn[k]);
+            return hdm.getMpf();
+        });
+
+        std::vector<P2> metT, refT, jet1T, jetnT;
+        for (int k = 0; k <= kMask; ++k) {
+            metT.push_back(P2::of(met[k]));
+            refT.push_back(P2::of(ref[k]));
+            jet1T.push_back(P2::of(jet1[k]));
+            jetnT.push_back(P2::of(jetn[k]));
+        }
+        run("HdmKernel::compute", o.reps, [&](long long i) {
+            const int k = i & kMask;
+            return HdmKernel::compute(metT[k], refT[k], jet1T[k], jetnT[k]).mpf;
+        });
+    }
+
+    // ---------------- EtaIndex ----------------
+    {
+        constexpr int kGen = 30;
+        std::vector<float> gEta(kGen * (kMask + 1)), gPhi(gEta.size()), gPt(gEta.size());
+        for (std::size_t j = 0; j < gEta.size(); ++j) {
+            gEta[j] = rng.Uniform(-5.0, 5.0);
+            gPhi[j] = rng.Uniform(-M_PI, M_PI);
+            gPt[j]  = 5.0 + rng.Exp(30.0);
+        }
+        EtaIndex genJets;
+        run("EtaIndex::build+closest", o.reps, [&](long long i) {
+            const int k = (i & kMask) * kGen;
+            genJets.build(kGen, &gEta[k], &gPhi[k], &gPt[k], [](int) { return true; });
+            const int i1 = genJets.closest(gEta[k] + 0.05, gPhi[k], 0.2,
+                                           [](const EtaIndex::Item& g) { return g.pt < 10.f; });
+            const int i2 = genJets.closest(gEta[k + 1] - 0.05, gPhi[k + 1], 0.2,
+                                           [&](const EtaIndex::Item& g) { return g.idx == i1 || g.pt < 10.f; });
+            return static_cast<double>(i1 + i2);
+        });
+    }
+
+    // ---------------- MathTTbar ----------------
+    {
+        MathTTbar ttbar(gfWqqm, 0.71);
+        ttbar.setMass(0.105658367, 80.4, 172.0);
+        SkimTree skimT(gfWqqm);
+        fillJets(skimT);
+        const std::vector<int> indexJets = {0, 1, 2, 3, 4, 5};
+        TLorentzVector p4Lep, p4Met;
+        p4Lep.SetPtEtaPhiM(45.0, 0.4, 1.0, 0.105658367);
+        p4Met.SetPtEtaPhiM(52.0, 0.0, -1.9, 0.0);
+        run("MathTTbar::minimizeChiSqr", std::max(1LL, o.reps / 10), [&](long long) {
+            ttbar.setEventObjects(p4Lep, p4Met, indexJets);
+            ttbar.setResolution(0.0, 0.0, 24.0, 34.0, 30.0, {}, false);
+            ttbar.minimizeChiSqr(skimT);
+            return ttbar.getChiSqr();
+        });
+    }
+
+    if (!o.out.empty()) {
+        json doc = json::array();
+        for (const auto& r : results) {
+            doc.push_back({{"name", r.name}, {"calls", r.calls},
+                           {"nsPerCallMin", r.nsMin}, {"nsPerCallMedian", r.nsMedian},
+                           {"allocsPerCall", r.allocsPerCall}, {"bytesPerCall", r.bytesPerCall}});
+        }
+        std::ofstream out(o.out);
+        out << json{{"reps", o.reps}, {"kernels", doc}}.dump(2) << '\n';
+        std::cout << "[microBench] results -> " << o.out << '\n';
+    }
+    return 0;
+}
@@ -0,0 +1,344 @@
+# runBench.py
+#
+# End-to-end throughput benchmark of runMain on synthetic skims (make bench).
+#
+#   1. builds a work area (bench/work by default) with a copy of config/,
+#      the repository POG/ inputs and constant stubs for the POG files that
+#      are not shipped (BTV btagging.json, EGM scale/smearing JSON and
+#      efficiency maps),
+#   2. writes deterministic NanoV9 (AK4Chs) and NanoV15 (AK4Puppi) skims with
+#      bench/makeSyntheticSkim and the matching input/json/FilesSkim_*.json,
+#   3. runs every channel's module chain with `runMain -B` and collects
+#      events/s, per-module seconds and peak RSS into one JSON file.
+#
+# Usage (from Hist/):
+#   python3 bench/runBench.py [--events 20000] [--channels ZmmJet,GamJet]
+#                             [--algos AK4Chs,AK4Puppi] [--kinds MC,Data]
+#                             [--runmain-args "-z"] [--out bench/results.json]
+import argparse
+import gzip
+import json
+import os
+import platform
+import resource
+import shutil
+import subprocess
+import sys
+import time
+
+sys.dont_write_bytecode = True
+
+HIST_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Channel -> derivation level its module chain is built for (fwk/Factory.cpp).
+CHANNEL_LEVEL = {
+    "DiJet":    "L2Residual",
+    "ZmmJet":   "L3Residual",
+    "ZeeJet":   "L3Residual",
+    "GamJet":   "L3Residual",
+    "MultiJet": "L3Residual",
+    "Wqqe":     "L3Residual",
+    "Wqqm":     "L3Residual",
+}
+
+# Data needs an era token; runs are taken from the golden JSON of that era.
+DATA_ERA = {
+    "2016Pre":  ("2016PreB", 0),
+    "2016Post": ("2016PostF", 278769),
+    "2017":     ("2017B", 0),
+    "2018":     ("2018A", 0),
+}
+
+SAMPLE = "Synthetic"
+
+
+# ----------------------------------------------------------------------
+# Work area
+# ----------------------------------------------------------------------
+def setup_workdir(work):
+    os.makedirs(os.path.join(work, "input", "json"), exist_ok=True)
+    os.makedirs(os.path.join(work, "skims"), exist_ok=True)
+    os.makedirs(os.path.join(work, "output"), exist_ok=True)
+
+    # A private copy: runMain writes config/RunsTree.json for MC samples.
+    cfg = os.path.join(work, "config")
+    if os.path.isdir(cfg):
+        shutil.rmtree(cfg)
+    shutil.copytree(os.path.join(HIST_DIR, "config"), cfg)
+
+    # POG/: real files are linked, missing ones are stubbed next to them.
+    pog_src = os.path.join(HIST_DIR, "POG")
+    for root, _, files in os.walk(pog_src):
+        rel = os.path.relpath(root, pog_src)
+        dst_dir = os.path.join(work, "POG", rel)
+        os.makedirs(dst_dir, exist_ok=True)
+        for f in files:
+            dst = os.path.join(dst_dir, f)
+            if not os.path.lexists(dst):
+                os.symlink(os.path.join(root, f), dst)
+
+
+def _year_key(year):
+    return "2016" if year.startswith("2016") else year
+
+
+def _load(work, name):
+    with open(os.path.join(work, "config", name)) as f:
+        return json.load(f)
+
+
+# ----------------------------------------------------------------------
+# Correction stubs (constant 1.0, inputs as the loaders evaluate them)
+# ----------------------------------------------------------------------
+def _write_correction_stub(path, corrections):
+    doc = {
+        "schema_version": 2,
+        "description": "runBench stub: every correction returns 1.0",
+        "corrections": [
+            {
+                "name": name,
+                "version": 1,
+                "inputs": [{"name": n, "type": t} for n, t in inputs],
+                "output": {"name": "sf", "type": "real"},
+                "data": 1.0,
+            }
+            for name, inputs in corrections
+        ],
+    }
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    opener = gzip.open if path.endswith(".gz") else open
+    with opener(path, "wt") as f:
+        json.dump(doc, f)
+
+
+def _write_hist_stub(path, hists):
+    import ROOT
+    ROOT.gROOT.SetBatch(True)
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    f = ROOT.TFile.Open(path, "UPDATE" if os.path.exists(path) else "RECREATE")
+    for name, dim in hists:
+        d, _, base = name.rpartition("/")
+        tdir = f.mkdir(d, "", True) if d else f
+        if dim == 2:
+            # x = supercluster eta, y = pT, as ScaleElectron/PhotonFunction read them
+            h = ROOT.TH2F(base, base, 10, -2.5, 2.5, 10, 10.0, 500.0)
+        else:
+            h = ROOT.TH1F(base, base, 4, 0.0, 4.0)
+        for b in range(h.GetNcells()):
+            h.SetBinContent(b, 1.0)
+            h.SetBinError(b, 0.01)
+        tdir.WriteTObject(h, base, "Overwrite")
+    f.Close()
+
+
+def write_stubs(work, year):
+    """Stub every POG input of `year` the repository does not ship."""
+    y = year
+    stubs = []
+
+    # Shipped inputs are symlinks into POG/; anything else is a stub from a previous run.
+    def need(path):
+        full = os.path.join(work, path)
+        return path in stubs or not os.path.islink(full)
+
+    btv = _load(work, "ScaleBtag.json")[y]
+    if need(btv["btvJsonPath"]):
+        inputs = [("systematic", "string"), ("working_point", "string"),
+                  ("flavor", "int"), ("abseta", "real"), ("pt", "real")]
+        _write_correction_stub(os.path.join(work, btv["btvJsonPath"]),
+                               [("deepJet_mujets", inputs), ("deepJet_incl", inputs)])
+        stubs.append(btv["btvJsonPath"])
+
+    ele = _load(work, "ScaleElectronLoader.json")[y]
+    if need(ele["eleSsJsonPath"]):
+        _write_correction_stub(os.path.join(work, ele["eleSsJsonPath"]),
+                               [(ele["eleSsName"], [("seedGain", "real"), ("scEta", "real")])])
+        stubs.append(ele["eleSsJsonPath"])
+    ele_maps = [(ele["eleIdSfPath"], ele["eleIdSfHist"]), (ele["eleRecoSfPath"], ele["eleRecoSfHist"])]
+    ele_maps += [(p, ele["eleTrigSfHist"]) for p in ele["eleTrigSfPath"].values()]
+    for path, hist in ele_maps:
+        if need(path):
+            _write_hist_stub(os.path.join(work, path), [(hist, 2)])
+            stubs.append(path)
+
+    pho = _load(work, "ScalePhotonLoader.json")[y]
+    if need(pho["phoSsJsonPath"]):
+        inputs = [("syst", "string"), ("seedGain", "int"), ("run", "real"),
+                  ("eta", "real"), ("r9", "real"), ("pt", "real")]
+        _write_correction_stub(os.path.join(work, pho["phoSsJsonPath"]), [(pho["phoSsName"], inputs)])
+        stubs.append(pho["phoSsJsonPath"])
+    for key, dim in (("phoId", 2), ("phoPs", 1), ("phoCs", 1)):
+        path, hist = pho[key + "SfPath"], pho[key + "SfHist"]
+        if need(path):
+            _write_hist_stub(os.path.join(work, path), [(hist, dim)])
+            stubs.append(path)
+
+    return sorted(set(stubs))
+
+
+# ----------------------------------------------------------------------
+# Synthetic skims
+# ----------------------------------------------------------------------
+def hlt_names(work, algo, channel, year):
+    name = f"Hlt{channel}{algo}.json" if (algo == "AK8Puppi" and channel == "DiJet") else f"Hlt{channel}.json"
+    cfg = _load(work, name).get(_year_key(year), [])
+    return list(cfg) if isinstance(cfg, (list, dict)) else []
+
+
+def golden_run(work, year, min_run):
+    cfg = _load(work, "PickEvent.json")[year]
+    with open(os.path.join(work, cfg["goldenLumiJsonPath"])) as f:
+        golden = json.load(f)
+    for run in sorted(golden, key=int):
+        if int(run) >= min_run:
+            first, last = golden[run][0]
+            return int(run), int(first), int(last)
+    raise RuntimeError(f"golden_run: no run >= {min_run} for {year}")
+
+
+def sample_key(algo, channel, year, kind):
+    period = DATA_ERA[year][0] if kind == "Data" else year
+    return f"{algo}_{CHANNEL_LEVEL[channel]}_{channel}_{period}_{kind}_{SAMPLE}"
+
+
+def make_skim(args, work, algo, channel, year, kind):
+    key = sample_key(algo, channel, year, kind)
+    out = os.path.join(work, "skims", f"{key}_{args.events}ev_s{args.seed}.root")
+    if os.path.exists(out) and not args.regenerate:
+        return out
+
+    cmd = [args.generator, "-o", out, "-a", algo, "-c", channel, "-y", year,
+           "-n", str(args.events), "-s", str(args.seed),
+           "-J", str(args.jets), "-P", str(args.photons), "-L", str(args.leptons)]
+    hlt = hlt_names(work, algo, channel, year)
+    if hlt:
+        cmd += ["-H", ",".join(hlt)]
+    if kind == "MC":
+        cmd += ["-m"]
+    else:
+        run, first, last = golden_run(work, year, DATA_ERA[year][1])
+        cmd += ["-r", str(run), "-l", f"{first}:{last}"]
+    subprocess.run(cmd, check=True)
+    return out
+
+
+def write_file_json(work, algo, channel, year, skims):
+    """One FilesSkim/FilesHist pair per (algo, level, channel, year), as input/getRootFiles.py writes them."""
+    level = CHANNEL_LEVEL[channel]
+    files_skim, files_hist = {}, {}
+    for kind, path in skims.items():
+        key = sample_key(algo, channel, year, kind)
+        files_skim[key] = [{"xsecOrLumi": 1.0, "nEvents": 1.0}, [path]]
+        files_hist[f"{key}_HistBase"] = [f"{key}_HistBase_1of1.root"]
+    base = f"{algo}_{level}_{channel}_{year}.json"
+    with open(os.path.join(work, "input", "json", "FilesSkim_" + base), "w") as f:
+        json.dump(files_skim, f, indent=4)
+    with open(os.path.join(work, "input", "json", "FilesHistDerivation_" + base), "w") as f:
+        json.dump(files_hist, f, indent=4)
+
+
+# ----------------------------------------------------------------------
+# Runs
+# ----------------------------------------------------------------------
+def run_job(args, work, io_name):
+    report = os.path.join(work, "output", io_name.replace(".root", "_bench.json"))
+    log = os.path.join(work, "output", io_name.replace(".root", ".log"))
+    cmd = [args.runmain] + args.runmain_args.split() + ["-B", report, io_name]
+
+    t0 = time.time()
+    with open(log, "w") as flog:
+        proc = subprocess.Popen(cmd, cwd=work, stdout=flog, stderr=subprocess.STDOUT)
+        _, status, usage = os.wait4(proc.pid, 0)
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    wall = time.time() - t0
+
+    result = {
+        "ioName": io_name,
+        "command": " ".join(cmd),
+        "exitCode": proc.returncode,
+        "processWallSeconds": wall,
+        "processPeakRssKb": usage.ru_maxrss,
+        "userSeconds": usage.ru_utime,
+        "systemSeconds": usage.ru_stime,
+        "log": os.path.relpath(log, work),
+    }
+    if os.path.exists(report):
+        with open(report) as f:
+            jobs = json.load(f).get("jobs", [])
+        if jobs:
+            result.update(jobs[0])
+    return result
+
+
+def print_summary(results):
+    print(f"\n{'ioName':<70} {'events':>8} {'ev/s':>10} {'RSS MB':>8}")
+    for r in results:
+        print(f"{r['ioName']:<70} {r.get('events', 0):>8} "
+              f"{r.get('eventsPerSecond', 0.0):>10.1f} {r['processPeakRssKb'] / 1024.0:>8.1f}"
+              + ("" if r["exitCode"] == 0 else f"  FAILED ({r['exitCode']}, see {r['log']})"))
+        modules = sorted(((k, v) for k, v in r.get("timers", {}).items() if k.startswith("module:")),
+                         key=lambda kv: -kv[1])
+        for k, v in modules:
+            print(f"    {k[len('module:'):]:<66} {v:>10.3f} s")
+
+
+def main():
+    p = argparse.ArgumentParser(description="runMain throughput benchmark on synthetic skims")
+    p.add_argument("--events", type=int, default=20000)
+    p.add_argument("--seed", type=int, default=12345)
+    p.add_argument("--jets", type=float, default=6.0, help="mean jet multiplicity")
+    p.add_argument("--photons", type=float, default=2.0, help="mean photon multiplicity")
+    p.add_argument("--leptons", type=float, default=2.0, help="mean electron and muon multiplicity")
+    p.add_argument("--channels", default=",".join(CHANNEL_LEVEL))
+    p.add_argument("--algos", default="AK4Chs,AK4Puppi", help="AK4Chs -> NanoV9, AK4Puppi -> NanoV15")
+    p.add_argument("--kinds", default="MC,Data")
+    p.add_argument("--year", default="2018")
+    p.add_argument("--runmain-args", default="", help='extra runMain options, e.g. "-z"')
+    p.add_argument("--work", default=os.path.join(HIST_DIR, "bench", "work"))
+    p.add_argument("--out", default=os.path.join(HIST_DIR, "bench", "results.json"))
+    p.add_argument("--runmain", default=os.path.join(HIST_DIR, "runMain"))
+    p.add_argument("--generator", default=os.path.join(HIST_DIR, "bench", "makeSyntheticSkim"))
+    p.add_argument("--regenerate", action="store_true", help="rewrite skims that already exist")
+    args = p.parse_args()
+
+    for exe in (args.runmain, args.generator):
+        if not os.access(exe, os.X_OK):
+            sys.exit(f"runBench: {exe} not built; run `make bench` from Hist/")
+
+    work = os.path.abspath(args.work)
+    setup_workdir(work)
+    stubs = write_stubs(work, args.year)
+    print(f"[runBench] work area {work}, {len(stubs)} stubbed POG inputs")
+
+    channels = [c for c in args.channels.split(",") if c]
+    unknown = [c for c in channels if c not in CHANNEL_LEVEL]
+    if unknown:
+        sys.exit(f"runBench: unknown channel(s) {unknown}; known: {list(CHANNEL_LEVEL)}")
+
+    io_names = []
+    for algo in args.algos.split(","):
+        for channel in channels:
+            skims = {kind: make_skim(args, work, algo, channel, args.year, kind)
+                     for kind in args.kinds.split(",")}
+            write_file_json(work, algo, channel, args.year, skims)
+            io_names += [f"{sample_key(algo, channel, args.year, kind)}_HistBase_1of1.root" for kind in skims]
+
+    results = [run_job(args, work, name) for name in io_names]
+    print_summary(results)
+
+    doc = {
+        "host": {"node": platform.node(), "machine": platform.machine(),
+                 "python": platform.python_version(), "cpus": os.cpu_count()},
+        "config": {k: v for k, v in vars(args).items() if k not in ("work", "out")},
+        "stubbedInputs": stubs,
+        "harnessPeakRssKb": resource.getrusage(resource.RUSAGE_SELF).ru_maxrss,
+        "runs": results,
+    }
+    with open(args.out, "w") as f:
+        json.dump(doc, f, indent=2)
+    print(f"\n[runBench] {sum(r['exitCode'] == 0 for r in results)} / {len(results)} jobs OK -> {args.out}")
+    return 0 if all(r["exitCode"] == 0 for r in results) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -28,8 +28,23 @@ outDir=$2
 #for correctionlib
 export LD_LIBRARY_PATH=$(pwd):$LD_LIBRARY_PATH
 
-echo "./runMain oName"
-./runMain ${oName}
+#Checkpoint/resume: pull a previous attempt's sidecar (condor retry on a fresh slot)
+#and push the sidecar back to outDir periodically while the job runs.
+#Only ZmmJet L3Residual runs on the per-event Driver loop; runMain rejects -k/-K otherwise.
+ckptArgs=""
+ckptPusher=""
+if [ -n "${_CONDOR_SCRATCH_DIR}" ] && [[ ${oName} == *_L3Residual_ZmmJet_* ]]; then
+    mkdir -p output
+    xrdcp -f ${outDir}/${oName}.ckpt output/${oName}.ckpt 2>/dev/null && echo "Found checkpoint"
+    ckptArgs="-k 20 -K"
+    ( while sleep 1200; do
+        [ -f output/${oName}.ckpt ] && xrdcp -f output/${oName}.ckpt ${outDir}/${oName}.ckpt
+      done ) &
+    ckptPusher=$!
+fi
+
+echo "./runMain ${ckptArgs} oName"
+./runMain ${ckptArgs} ${oName}
 
 printf "Done histograming at ";/bin/date
 #---------------------------------------------
@@ -38,7 +53,14 @@ printf "Done histograming at ";/bin/date
 if [ -z ${_CONDOR_SCRATCH_DIR} ] ; then
     echo "Running Interactively" ;
 else
+    [ -n "${ckptPusher}" ] && kill ${ckptPusher} 2>/dev/null
     xrdcp -f output/${oName} ${outDir}
+    if [ -n "${ckptPusher}" ]; then
+        xrdfs $(echo ${outDir} | cut -d/ -f1-3) rm $(echo ${outDir} | cut -d/ -f4-)/${oName}.ckpt 2>/dev/null
+    fi
+    if [ -f output/EventCache_${oName} ]; then
+        xrdcp -f output/EventCache_${oName} ${outDir}
+    fi
     echo "Cleanup"
     cd ..
     rm -rf Hist
@@ -1,5 +1,6 @@
 #include "CategorizePhoton.h"
 #include "ReadConfig.h"
+#include "fwk/LoggerService.h"
 #include "HelperDelta.hpp"
 
 #include <cmath>
@@ -57,12 +58,6 @@ void CategorizePhoton::loadConfig(const std::string& filename) {
 }
 
 // ----------------------------------------------------------------------
-void CategorizePhoton::printDebug(const std::string& msg) const {
-    if (isDebug_) {
-        std::cout << "[CategorizePhoton] " << msg << '\n';
-    }
-}
-
 // ----------------------------------------------------------------------
 // Public interface
 // ----------------------------------------------------------------------
@@ -76,20 +71,20 @@ CategorizePhoton::categorize(const SkimTree& skimT, int phoIdx) const {
     }
 
     if (phoIdx < 0 || phoIdx >= skimT.nPhoton) {
-        printDebug("WARNING: phoIdx out of range: " + std::to_string(phoIdx) +
-                   " (nPhoton = " + std::to_string(skimT.nPhoton) + ")");
+        FWK_DEBUG("[CategorizePhoton]", "WARNING: phoIdx out of range: ", phoIdx,
+                   " (nPhoton = ", skimT.nPhoton, ")");
         return cat;
     }
 
     cat = categorizeFromGenMatch(skimT, phoIdx);
 
     if (isDebug_) {
-        printDebug("phoIdx=" + std::to_string(phoIdx) +
-                   " -> genuine="        + std::to_string(cat.isGenuine) +
-                   ", misIDEle="         + std::to_string(cat.isMisIdEle) +
-                   ", hadronicPhoton="   + std::to_string(cat.isHadronicPhoton) +
-                   ", hadronicFake="     + std::to_string(cat.isHadronicFake) +
-                   ", puPhoton="         + std::to_string(cat.isPuPhoton));
+        FWK_DEBUG("[CategorizePhoton]", "phoIdx=", phoIdx,
+                   " -> genuine=", cat.isGenuine,
+                   ", misIDEle=", cat.isMisIdEle,
+                   ", hadronicPhoton=", cat.isHadronicPhoton,
+                   ", hadronicFake=", cat.isHadronicFake,
+                   ", puPhoton=", cat.isPuPhoton);
     }
 
     return cat;
@@ -110,9 +105,9 @@ CategorizePhoton::categorizeFromCone(const SkimTree& skimT, int phoIdx) const {
     const float recoPhi = skimT.Photon_phi[phoIdx];
 
     if (isDebug_) {
-        printDebug("No valid direct gen match. Searching cone around reco photon. nGenPart=" +
-                   std::to_string(skimT.nGenPart) +
-                   " recoPt=" + std::to_string(recoPt));
+        FWK_DEBUG("[CategorizePhoton]", "No valid direct gen match. Searching cone around reco photon. nGenPart=",
+                   skimT.nGenPart,
+                   " recoPt=", recoPt);
     }
 
     for (int genIdx = 0; genIdx < skimT.nGenPart; ++genIdx) {
@@ -139,12 +134,12 @@ CategorizePhoton::categorizeFromCone(const SkimTree& skimT, int phoIdx) const {
         const double dRval = HelperDelta::DELTAR(genPhi, recoPhi, genEta, recoEta);
 
         if (isDebug_) {
-            printDebug("  genIdx=" + std::to_string(genIdx) +
-                       " pdgId=" + std::to_string(genPID) +
-                       " pt=" + std::to_string(genPt) +
-                       " eta=" + std::to_string(genEta) +
-                       " phi=" + std::to_string(genPhi) +
-                       " dR=" + std::to_string(dRval));
+            FWK_DEBUG("[CategorizePhoton]", "  genIdx=", genIdx,
+                       " pdgId=", genPID,
+                       " pt=", genPt,
+                       " eta=", genEta,
+                       " phi=", genPhi,
+                       " dR=", dRval);
         }
 
         if (dRval < maxDeltaRGenMatch_) {
@@ -184,19 +179,20 @@ CategorizePhoton::Category
 CategorizePhoton::categorizeFromGenMatch(const SkimTree& skimT, int phoIdx) const {
     Category cat;  // all flags false
 
+    skimT.require(SkimBranch::kPhoton | SkimBranch::kGenPart);
     // --- 1) Get direct gen match index (Photon_genPartIdx) ---
     int mcMatchInd = -1;
     if (skimT.Photon_genPartIdx) {
         mcMatchInd = skimT.Photon_genPartIdx[phoIdx];
     } else {
         // If branch does not exist / is not filled, treat as "no match"
-        printDebug("Photon_genPartIdx not available; treating as no direct match.");
+        FWK_DEBUG("[CategorizePhoton]", "Photon_genPartIdx not available; treating as no direct match.");
         mcMatchInd = -1;
     }
 
     // Guard against out-of-range indices
     if (mcMatchInd >= skimT.nGenPart || mcMatchInd < -1) {
-        printDebug("mcMatchInd out of range -> reset to -1");
+        FWK_DEBUG("[CategorizePhoton]", "mcMatchInd out of range -> reset to -1");
         mcMatchInd = -1;
     }
 
@@ -205,11 +201,11 @@ CategorizePhoton::categorizeFromGenMatch(const SkimTree& skimT, int phoIdx) cons
     const float recoPhi = skimT.Photon_phi[phoIdx];
 
     if (isDebug_) {
-        printDebug("phoIdx=" + std::to_string(phoIdx) +
-                   " mcMatchInd=" + std::to_string(mcMatchInd) +
-                   " pt="  + std::to_string(recoPt) +
-                   " eta=" + std::to_string(recoEta) +
-                   " phi=" + std::to_string(recoPhi));
+        FWK_DEBUG("[CategorizePhoton]", "phoIdx=", phoIdx,
+                   " mcMatchInd=", mcMatchInd,
+                   " pt=", recoPt,
+                   " eta=", recoEta,
+                   " phi=", recoPhi);
     }
 
     // ------------------------------------------------------------------
@@ -225,15 +221,15 @@ CategorizePhoton::categorizeFromGenMatch(const SkimTree& skimT, int phoIdx) cons
         }
 
         if (isDebug_) {
-            printDebug("Direct gen match: genPt=" + std::to_string(genPtMatch) +
-                       " recoPt=" + std::to_string(recoPt) +
-                       " ptRatio=" + std::to_string(ptRatio) +
-                       " minGenPtOverRecoPt_=" + std::to_string(minGenPtOverRecoPt_));
+            FWK_DEBUG("[CategorizePhoton]", "Direct gen match: genPt=", genPtMatch,
+                       " recoPt=", recoPt,
+                       " ptRatio=", ptRatio,
+                       " minGenPtOverRecoPt_=", minGenPtOverRecoPt_);
         }
 
         if (ptRatio < minGenPtOverRecoPt_) {
             if (isDebug_) {
-                printDebug("Direct gen match fails pT-ratio requirement; "
+                FWK_DEBUG("[CategorizePhoton]", "Direct gen match fails pT-ratio requirement; "
                            "falling back to cone-based categorisation.");
             }
             mcMatchInd = -1;
@@ -277,9 +273,9 @@ CategorizePhoton::categorizeFromGenMatch(const SkimTree& skimT, int phoIdx) cons
     const bool parentagePass = (maxPDGID < 37);
 
     if (isDebug_) {
-        printDebug("mcMatchPDGID=" + std::to_string(mcMatchPDGID) +
-                   " maxMotherPDGID=" + std::to_string(maxPDGID) +
-                   " parentagePass=" + std::to_string(parentagePass));
+        FWK_DEBUG("[CategorizePhoton]", "mcMatchPDGID=", mcMatchPDGID,
+                   " maxMotherPDGID=", maxPDGID,
+                   " parentagePass=", parentagePass);
     }
 
     // Photon match
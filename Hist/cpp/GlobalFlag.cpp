@@ -158,8 +158,12 @@ void GlobalFlag::parseFlags() {
     // (You can expand later to "MadGraph", "MG", "amcatnlo", etc. as separate tokens.)
     if (hasToken(toks, "MG") || hasToken(toks, "MadGraph") || hasToken(toks, "Madgraph")) isMG_ = true;
 
-    // Currently manual bookkeeping flag, keep behavior
-    isBookKeep_ = true;
+    // Per-step jet/MET four-vectors (ScaleJet/ScaleMet bookkeeping) are read only by
+    // HistScaleJet/HistScaleMet, which the L2Residual/JerSF and L3Residual GamJet
+    // Run() loops fill. Other jobs skip them and get the fixed JecSteps instances.
+    isBookKeep_ = (jecDerivationLevel_ == JecDerivationLevel::L2Residual) ||
+                  (jecDerivationLevel_ == JecDerivationLevel::JerSF) ||
+                  (jecDerivationLevel_ == JecDerivationLevel::L3Residual && channel_ == Channel::GamJet);
 
     if(jecDerivationLevel_==JecDerivationLevel::L2Residual){
         jecApplicationLevel_ = JecApplicationLevel::L2Rel;
@@ -240,11 +244,10 @@ void GlobalFlag::validateFlagsOrThrow() const {
     }
 
     // Era rules:
-    // - Data SHOULD have an era (2018A...), because you typically run per-era datasets.
+    // - Data with an era (2018A...) runs that era's corrections for every event.
+    // - Year-only Data (2018) spans all eras of the year; the run-dependent
+    //   corrections pick the era per event from the run number (ScaleJetLoader).
     // - MC MAY be year-only (2018), allow era NONE.
-    if (isData_ && isNone(era_, Era::NONE)) {
-        throw std::runtime_error("GlobalFlag: Data requires an era token (e.g. 2018A). ioName=" + ioName_);
-    }
 
     // NanoVersion should be determinable for supported algos
     if (nanoVer_ == NanoVersion::Unknown) {
@@ -370,6 +373,7 @@ void GlobalFlag::printFlags(std::ostream& os) const {
 
     os << "debug      = " << (isDebug_ ? "true" : "false") << "\n";
     os << "nDebug     = " << nDebug_ << "\n";
+    os << "prefetch   = " << prefetchFiles_ << " file(s) ahead\n";
     os << "Data/MC    = " << (isData_ ? "Data" : "MC") << "\n";
 
     os << "JetAlgo    = " << getJetAlgoStr() << "\n";
@@ -379,7 +383,7 @@ void GlobalFlag::printFlags(std::ostream& os) const {
     os << "Channel    = " << getChannelStr() << "\n";
 
     os << "Year       = " << getYearStr() << "\n";
-    os << "Era        = " << getEraStr() << "\n";
+    os << "Era        = " << (spansEras() ? "all eras of the year (per-run IOV)" : getEraStr()) << "\n";
 
     os << "Systematic = " << getDirStr() << "\n";
 
@@ -5,6 +5,7 @@
 HemVeto::HemVeto(const GlobalFlag& globalFlags)
   : globalFlags_(globalFlags)
   , isMC_(globalFlags_.isMC())
+  , isYear2018_(globalFlags_.getYearStr() == "2018")
 {
     loadConfig_("config/HemVeto.json");
 }
@@ -44,12 +45,21 @@ void HemVeto::loadConfig_(const std::string& filename) {
     }
 }
 
-bool HemVeto::isHemVeto(const SkimTree& skimT) const {
+bool HemVeto::appliesToRun(unsigned int run) const {
     // master switch / year logic
-    if (!applyHemVeto_ || globalFlags_.getYearStr() != "2018") return false;
+    if (!applyHemVeto_ || !isYear2018_) return false;
 
     // require data-run ≥ threshold
-    if (!isMC_ && skimT.run < runThreshold_) return false;
+    if (!isMC_ && run < runThreshold_) return false;
+    return true;
+}
+
+bool HemVeto::isHemVeto(const SkimTree& skimT) const {
+    return isHemVeto(skimT, appliesToRun(skimT.run));
+}
+
+bool HemVeto::isHemVeto(const SkimTree& skimT, bool runInHemPeriod) const {
+    if (!runInHemPeriod) return false;
 
     // count electrons in HEM region
     int nEle = 0;
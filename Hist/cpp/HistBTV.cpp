@@ -172,6 +172,7 @@ void HistBTV::FillHistograms(
    mvar_["p1Jet1MuefInRefPt" ]  = muEF;
 
     // Determine the flavor of the jet
+    if (isMC_) skimT->require(SkimBranch::kGenJetFlavour);
     int flv = (isMC_ ? skimT->GenJet_partonFlavour[iGenJet] : 99);
 
     // Evaluate tagging conditions based on jet properties
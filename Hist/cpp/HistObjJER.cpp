@@ -230,16 +230,22 @@ void HistObjJER::InitializeHistograms(TDirectory* origDir,
     origDir->cd();
 }
 
-void HistObjJER::Fill(TLorentzVector p4Gen, TLorentzVector p4Reco, double rho, double weight)
+void HistObjJER::Fill(const TLorentzVector& p4Gen, const TLorentzVector& p4Reco, double rho, double weight)
 {
-    const double ptReco  = p4Reco.Pt();
-    const double etaReco = p4Reco.Eta();
-    const double phiReco = p4Reco.Phi();
+    fill_(p4Gen.Pt(), p4Gen.Eta(), p4Gen.Phi(),
+          p4Reco.Pt(), p4Reco.Eta(), p4Reco.Phi(), rho, weight);
+}
 
-    const double ptGen  = p4Gen.Pt();
-    const double etaGen = p4Gen.Eta();
-    const double phiGen = p4Gen.Phi();
+void HistObjJER::Fill(const P4& p4Gen, const P4& p4Reco, double rho, double weight)
+{
+    fill_(p4Gen.pt, p4Gen.eta, p4Gen.phi,
+          p4Reco.pt, p4Reco.eta, p4Reco.phi, rho, weight);
+}
 
+void HistObjJER::fill_(double ptGen, double etaGen, double phiGen,
+                       double ptReco, double etaReco, double phiReco,
+                       double rho, double weight)
+{
     if (ptGen <= 0.0)  return;
     if (ptReco <= 0.0) return;
 
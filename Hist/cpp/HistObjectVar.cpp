@@ -121,6 +121,7 @@ void HistObjectVar::FillElectron(const SkimTree& skimT, double weight)
 
 void HistObjectVar::FillPhoton(const SkimTree& skimT, double weight)
 {
+    skimT.require(SkimBranch::kPhoton);
     for (int ind = 0; ind < skimT.nPhoton; ++ind) {
         double pt = skimT.Photon_pt[ind];
         double eta = skimT.Photon_eta[ind];
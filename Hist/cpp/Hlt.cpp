@@ -1,7 +1,10 @@
 #include "Hlt.h"
+#include "ResourceCache.h"
+#include <algorithm>
 #include <fstream>
 #include <nlohmann/json.hpp>
 #include <iostream>
+#include <stdexcept>
 using json = nlohmann::json;
 
 // Constructor implementation
@@ -12,6 +15,7 @@ Hlt::Hlt(const GlobalFlag& globalFlags)
       isDebug_(globalFlags_.isDebug()) {
 
     loadConfig();
+    buildTrigIds();
 }
 
 void Hlt::loadConfig() {
@@ -34,20 +38,19 @@ void Hlt::loadConfig() {
                                     globalFlags_.getJetAlgoStr()+ ".json";
     }
     std::cout<<"[Hlt]: "<<configFile<<"\n";
-    std::ifstream ifs(configFile);
-    if (!ifs.is_open()) {
+    std::shared_ptr<const json> jPtr;
+    try {
+        jPtr = ResourceCache::json(configFile);
+    } catch (const std::runtime_error&) {
         std::cerr << "Error: Could not open " << configFile << std::endl;
         return;
-    }
-    
-    json j;
-    try {
-        ifs >> j;
     } catch (json::parse_error& e) {
         std::cerr << "JSON parse error in " << configFile << ": " << e.what() << std::endl;
         return;
     }
     
+    const json& j = *jPtr;
+
     // Ensure the JSON contains the current year.
     if (!j.contains(yearStr)) {
         std::cerr << "Error: " << configFile << " does not contain configuration for year " << yearStr << std::endl;
@@ -55,7 +58,7 @@ void Hlt::loadConfig() {
     }
     
     // Retrieve the configuration for the active year.
-    auto yearConfig = j.at(yearStr);
+    const json& yearConfig = j.at(yearStr);
     
     // For channels with a simple trigger list.
     if (channel_ == GlobalFlag::Channel::ZeeJet ||
@@ -70,7 +73,7 @@ void Hlt::loadConfig() {
     else if (channel_ == GlobalFlag::Channel::GamJet) {
         for (auto& item : yearConfig.items()) {
             const std::string& key = item.key();
-            json value = item.value();
+            const json& value = item.value();
             double ptMin = value.at("ptMin").get<double>();
             double ptMax = value.at("ptMax").get<double>();
             double lumi  = value.at("lumi" ).get<double>();
@@ -83,7 +86,7 @@ void Hlt::loadConfig() {
             channel_ == GlobalFlag::Channel::DiJet) {
         for (auto& item : yearConfig.items()) {
             const std::string& key = item.key();
-            json value = item.value();
+            const json& value = item.value();
             int trigPt = value.at("trigPt").get<int>();
             double ptMin = value.at("ptMin").get<double>();
             double ptMax = value.at("ptMax").get<double>();
@@ -96,25 +99,45 @@ void Hlt::loadConfig() {
     }
 }
 
-const std::vector<std::string> Hlt::getTrigNames() const {
-    std::vector<std::string> tNames;
+void Hlt::buildTrigIds() {
+    // List channels keep the config order; the map-based channels are sorted
+    // by name, so every Hlt instance gives a trigger the same id.
+    trigNames_.clear();
+    trigRangesPt_.clear();
+    trigRangesPtEta_.clear();
     if (channel_ == GlobalFlag::Channel::ZeeJet ||
         channel_ == GlobalFlag::Channel::ZmmJet ||
         channel_ == GlobalFlag::Channel::GamJetFake ||
         channel_ == GlobalFlag::Channel::Wqqe ||
         channel_ == GlobalFlag::Channel::Wqqm) {
-        tNames = trigList_;
+        trigNames_ = trigList_;
     } else if (channel_ == GlobalFlag::Channel::GamJet) {
-        for (const auto& trig : trigMapRangePt_) {
-            tNames.push_back(trig.first);
-        }
+        for (const auto& [name, range] : trigMapRangePt_) trigNames_.push_back(name);
+        std::sort(trigNames_.begin(), trigNames_.end());
+        for (const auto& name : trigNames_) trigRangesPt_.push_back(trigMapRangePt_.at(name));
     } else if (channel_ == GlobalFlag::Channel::MultiJet ||
               channel_ == GlobalFlag::Channel::DiJet) {
-        for (const auto& trig : trigMapRangePtEta_) {
-            tNames.push_back(trig.first);
-        }
+        for (const auto& [name, range] : trigMapRangePtEta_) trigNames_.push_back(name);
+        std::sort(trigNames_.begin(), trigNames_.end());
+        for (const auto& name : trigNames_) trigRangesPtEta_.push_back(trigMapRangePtEta_.at(name));
+    }
+
+    if (trigNames_.size() > kMaxTrigIds) {
+        throw std::runtime_error("Hlt::buildTrigIds - " + std::to_string(trigNames_.size()) +
+                                 " triggers, at most " + std::to_string(kMaxTrigIds) +
+                                 " fit in a TrigMask");
+    }
+
+    hltLumiWeights_.clear();
+    hltLumiWeights_.reserve(trigNames_.size());
+    for (const auto& name : trigNames_) hltLumiWeights_.push_back(getHltLumiWeight(name));
+}
+
+int Hlt::getTrigId(const std::string& hltName) const {
+    for (std::size_t i = 0; i < trigNames_.size(); ++i) {
+        if (trigNames_[i] == hltName) return static_cast<int>(i);
     }
-    return tNames;
+    return -1;
 }
 
 double Hlt::getHltLumi(const std::string& hltName) const {
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <stdexcept>
 #include "ReadConfig.h"
+#include "ResourceCache.h"
 
 JecUncBandLoader::JecUncBandLoader(const GlobalFlag& globalFlags)
     : globalFlags_(globalFlags),
@@ -42,7 +43,7 @@ void JecUncBandLoader::loadConfig(const std::string& filename) {
 void JecUncBandLoader::loadJesUncBandRef() {
     std::cout << "==> loadJesUncBandRef()\n";
     try {
-        loadedJesUncBandRef_ = correction::CorrectionSet::from_file(jesUncBandJsonPath_)->at(jesUncBandName_);
+        loadedJesUncBandRef_ = ResourceCache::correctionSet(jesUncBandJsonPath_)->at(jesUncBandName_);
     } catch (const std::exception& e) {
         std::cout << "\nEXCEPTION: JecUncBandLoader::loadJesUncBandRef\n";
         std::cout << "Check " << jesUncBandJsonPath_ << " or " << jesUncBandName_ << '\n';
@@ -55,7 +56,7 @@ void JecUncBandLoader::loadJesUncBandRef() {
 void JecUncBandLoader::loadJerSfUncBandRef() {
     std::cout << "==> loadJerSfUncBandRef()\n";
     try {
-        loadedJerSfUncBandRef_ = correction::CorrectionSet::from_file(jerSfUncBandJsonPath_)->at(jerSfUncBandName_);
+        loadedJerSfUncBandRef_ = ResourceCache::correctionSet(jerSfUncBandJsonPath_)->at(jerSfUncBandName_);
     } catch (const std::exception& e) {
         std::cout << "\nEXCEPTION: JecUncBandLoader::loadJerSfUncBandRef\n";
         std::cout << "Check " << jerSfUncBandJsonPath_ << " or " << jerSfUncBandName_ << '\n';
@@ -0,0 +1,65 @@
+#include "JetQuality.h"
+
+#include <cmath>
+
+JetQuality::JetQuality(const GlobalFlag& globalFlags)
+    : useLegacyJetId_(globalFlags.getNanoVersion() == GlobalFlag::NanoVersion::V9) {}
+
+void JetQuality::fill(SkimTree& skimT) const {
+    skimT.require(SkimBranch::kJetMultiplicity);
+    if (useLegacyJetId_) fill_<true>(skimT);
+    else                 fill_<false>(skimT);
+}
+
+// One pass over the jet arrays. Every selection is written as a plain boolean
+// expression (no early returns, no per-jet strings) and the Nano version is a
+// template parameter, so the loop stays branch-light and can be vectorised;
+// the ID cuts are those of PickJet.
+template <bool LegacyJetId>
+void JetQuality::fill_(SkimTree& skimT) {
+    const int n = static_cast<int>(skimT.nJet);
+
+    for (int i = 0; i < n; ++i) {
+        const float absEta = std::fabs(skimT.Jet_eta[i]);
+
+        bool tight;
+        bool tightLepVeto;
+        if constexpr (LegacyJetId) {
+            // Jet_jetId: 0=fail, 2=loose, 4=tight, 6=tightLepVeto
+            const int jetId = skimT.Jet_jetId[i];
+            tight        = (jetId >= 4);
+            tightLepVeto = (jetId >= 6);
+        } else {
+            const float neHEF  = skimT.Jet_neHEF[i];
+            const float neEmEF = skimT.Jet_neEmEF[i];
+            const float chHEF  = skimT.Jet_chHEF[i];
+            const int   chMult = skimT.Jet_chMultiplicity[i];
+            const int   neMult = skimT.Jet_neMultiplicity[i];
+
+            const bool r1 = (absEta <= 2.6f);
+            const bool r2 = (absEta > 2.6f) & (absEta <= 2.7f);
+            const bool r3 = (absEta > 2.7f) & (absEta <= 3.0f);
+            const bool r4 = (absEta > 3.0f);
+
+            const bool c1 = (neHEF < 0.99f) & (neEmEF < 0.9f) & (chMult + neMult > 1) &
+                            (chHEF > 0.01f) & (chMult > 0);
+            const bool c2 = (neHEF < 0.90f) & (neEmEF < 0.99f);
+            const bool c3 = (neHEF < 0.99f);
+            const bool c4 = (neMult >= 2) & (neEmEF < 0.4f);
+
+            tight = (r1 & c1) | (r2 & c2) | (r3 & c3) | (r4 & c4);
+
+            const bool lepVeto = (absEta > 2.7f) |
+                                 ((skimT.Jet_muEF[i] < 0.8f) & (skimT.Jet_chEmEF[i] < 0.8f));
+            tightLepVeto = tight & lepVeto;
+        }
+
+        std::uint32_t m = 0;
+        m |= tight        ? IdTight        : 0u;
+        m |= tightLepVeto ? IdTightLepVeto : 0u;
+
+        skimT.Jet_qualityMask[i] = m;
+    }
+
+    skimT.hasJetQualityMask = true;
+}
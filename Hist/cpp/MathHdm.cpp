@@ -1,7 +1,6 @@
 #include "MathHdm.h"
 
 #include "MathGuard.hpp"
-#include "TMath.h"
 
 #include <cmath>
 #include <iostream>
@@ -23,7 +22,7 @@ MathHdm::MathHdm(const GlobalFlag& globalFlags)
 
 //---------------------------------------------------------------------
 // calcResponse:
-//   Computes derived 4-vectors and scalar variables based on the inputs.
+//   HDM responses from the transverse components of the inputs.
 //---------------------------------------------------------------------
 void MathHdm::calcResponse(const TLorentzVector& p4CorrMet,
                            const TLorentzVector& p4Ref,
@@ -32,7 +31,6 @@ void MathHdm::calcResponse(const TLorentzVector& p4CorrMet,
 {
     MathGuard g("MathHdm", "calcResponse", isDebug_);
 
-    // Validate inputs before caching
     g.cacheP4("p4CorrMet(in)", p4CorrMet)
      .cacheP4("p4Ref(in)",     p4Ref)
      .cacheP4("p4Jet1(in)",    p4Jet1)
@@ -43,141 +41,67 @@ void MathHdm::calcResponse(const TLorentzVector& p4CorrMet,
     g.requireFiniteP4(p4Jet1,    "p4Jet1");
     g.requireFiniteP4(p4Jetn,    "p4Jetn");
 
-    // Cache inputs
-    p4CorrMet_ = p4CorrMet;
-    p4Ref_     = p4Ref;
-    p4Jet1_    = p4Jet1;
-    p4Jetn_    = p4Jetn;
-
-    // Cache post-copied state (very useful if something mutates later)
-    g.cacheP4("p4CorrMet(cached)", p4CorrMet_)
-     .cacheP4("p4Ref(cached)",     p4Ref_)
-     .cacheP4("p4Jet1(cached)",    p4Jet1_)
-     .cacheP4("p4Jetn(cached)",    p4Jetn_);
-
-    p4Conservation_ = p4CorrMet_ + (p4Ref_ + p4Jet1_ + p4Jetn_);
-    g.cacheP4("p4Conservation", p4Conservation_);
-
-    const double ptRef = p4Ref_.Pt();
-    g.cacheScalar("ptRef", ptRef);
-    g.requireFiniteScalar(ptRef, "ptRef");
-    if (ptRef <= kEps) {
-        g.fail("invalid p4Ref.Pt() (<=0) -> cannot compute HDM responses");
-    }
+    calcResponse_(P2::of(p4CorrMet), P2::of(p4Ref), P2::of(p4Jet1), P2::of(p4Jetn), g);
+}
+
+void MathHdm::calcResponse(const P2& met, const P2& ref, const P2& jet1, const P2& jetn)
+{
+    MathGuard g("MathHdm", "calcResponse", isDebug_);
+    calcResponse_(met, ref, jet1, jetn, g);
+}
+
+void MathHdm::calcResponse_(const P2& met, const P2& ref, const P2& jet1, const P2& jetn,
+                            MathGuard& g)
+{
+    met_  = met;
+    ref_  = ref;
+    jet1_ = jet1;
+    jetn_ = jetn;
 
-    const double ptRefSqr = ptRef * ptRef;
-    g.cacheScalar("ptRefSqr", ptRefSqr);
+    const double ptRefSqr = ref.norm2();
+    g.cacheScalar("ref.px", ref.px).cacheScalar("ref.py", ref.py);
     g.requireFiniteScalar(ptRefSqr, "ptRefSqr");
     if (ptRefSqr <= kEps) {
         g.fail("invalid ptRef^2 (<=0) -> cannot compute HDM responses");
     }
 
-    // Eq.8 of hdm_2023082.pdf // Eq.11 of JME-21-001
-    p4Metu_  = -(p4CorrMet_ + p4Ref_ + p4Jet1_ + p4Jetn_);
-    p4Met1_  = -(p4Ref_ + p4Jet1_);
-    p4Metn_  = -p4Jetn_;
-    p4Metnu_ = p4Metn_ + 1.1 * p4Metu_;
-
-    g.cacheP4("p4Metu(preT)",  p4Metu_)
-     .cacheP4("p4Met1(preT)",  p4Met1_)
-     .cacheP4("p4Metn(preT)",  p4Metn_)
-     .cacheP4("p4Metnu(preT)", p4Metnu_);
-
-    // Transverse versions for dot products (your existing behavior)
-    makeTransverse(p4CorrMet_);
-    makeTransverse(p4Met1_);
-    makeTransverse(p4Metn_);
-    makeTransverse(p4Metu_);
-    makeTransverse(p4Metnu_);
-
-    g.cacheP4("p4CorrMet(T)", p4CorrMet_)
-     .cacheP4("p4Met1(T)",    p4Met1_)
-     .cacheP4("p4Metn(T)",    p4Metn_)
-     .cacheP4("p4Metu(T)",    p4Metu_)
-     .cacheP4("p4Metnu(T)",   p4Metnu_);
-
-    // Re-check vectors after modifications
-    g.requireFiniteP4(p4CorrMet_, "p4CorrMet_(transverse)");
-    g.requireFiniteP4(p4Met1_,    "p4Met1_(transverse)");
-    g.requireFiniteP4(p4Metn_,    "p4Metn_(transverse)");
-    g.requireFiniteP4(p4Metu_,    "p4Metu_(transverse)");
-    g.requireFiniteP4(p4Metnu_,   "p4Metnu_(transverse)");
-
-    // Basic variables
-    bal_   = p4Jet1_.Pt() / ptRef;
-
-    // Guard denominators explicitly right before divisions
-    g.requireDenNotSmall(ptRef,    "ptRef",    kEps);
-    g.requireDenNotSmall(ptRefSqr, "ptRefSqr", kEps);
-
-    mpf_   = 1.0 + p4CorrMet_.Vect().Dot(p4Ref_.Vect()) / ptRefSqr;
-    mpf1_  = 1.0 + p4Met1_.Vect().Dot(p4Ref_.Vect())    / ptRefSqr;
-    mpfn_  =        p4Metn_.Vect().Dot(p4Ref_.Vect())    / ptRefSqr;
-    mpfu_  =        p4Metu_.Vect().Dot(p4Ref_.Vect())    / ptRefSqr;
-    mpfnu_ =        p4Metnu_.Vect().Dot(p4Ref_.Vect())   / ptRefSqr;
-
-    g.cacheScalar("bal",   bal_)
-     .cacheScalar("mpf",   mpf_)
-     .cacheScalar("mpf1",  mpf1_)
-     .cacheScalar("mpfn",  mpfn_)
-     .cacheScalar("mpfu",  mpfu_)
-     .cacheScalar("mpfnu", mpfnu_);
-
-    g.requireFiniteScalar(bal_,   "bal");
-    g.requireFiniteScalar(mpf_,   "mpf");
-    g.requireFiniteScalar(mpf1_,  "mpf1");
-    g.requireFiniteScalar(mpfn_,  "mpfn");
-    g.requireFiniteScalar(mpfu_,  "mpfu");
-    g.requireFiniteScalar(mpfnu_, "mpfnu");
-
-    // MPFX: rotate p4Ref by +90 degrees in phi.
-    p4Refx_ = p4Ref_;
-    double newPhi = p4Ref_.Phi() + 0.5 * TMath::Pi();
-    newPhi = TMath::ATan2(std::sin(newPhi), std::cos(newPhi));
-
-    g.cacheScalar("p4Ref.Phi()", p4Ref_.Phi());
-    g.cacheScalar("newPhi", newPhi);
-    g.requireFiniteScalar(newPhi, "newPhi");
-
-    p4Refx_.SetPhi(newPhi);
-    g.cacheP4("p4Refx", p4Refx_);
-    g.requireFiniteP4(p4Refx_, "p4Refx");
-
-    mpfx_   = 1.0 + p4CorrMet_.Vect().Dot(p4Refx_.Vect()) / ptRefSqr;
-    mpf1x_  = 1.0 + p4Met1_.Vect().Dot(p4Refx_.Vect())    / ptRefSqr;
-    mpfnPt_ =        p4Metn_.Vect().Dot(p4Refx_.Vect())    / ptRefSqr;
-    mpfux_  =        p4Metu_.Vect().Dot(p4Refx_.Vect())    / ptRefSqr;
-    mpfnux_ =        p4Metnu_.Vect().Dot(p4Refx_.Vect())   / ptRefSqr;
-
-    g.cacheScalar("mpfx",   mpfx_)
-     .cacheScalar("mpf1x",  mpf1x_)
-     .cacheScalar("mpfnPt", mpfnPt_)
-     .cacheScalar("mpfux",  mpfux_)
-     .cacheScalar("mpfnux", mpfnux_);
-
-    g.requireFiniteScalar(mpfx_,   "mpfx");
-    g.requireFiniteScalar(mpf1x_,  "mpf1x");
-    g.requireFiniteScalar(mpfnPt_, "mpfnPt");
-    g.requireFiniteScalar(mpfux_,  "mpfux");
-    g.requireFiniteScalar(mpfnux_, "mpfnux");
-
-    // Sanity check for HDM identities
-    const double checkSum = mpf1_ + mpfn_ - mpfu_;
-    g.cacheScalar("checkSum(mpf1+mpfn+mpfu)", checkSum);
-    g.requireFiniteScalar(checkSum, "checkSum");
-
-    const double diff = checkSum - mpf_;
-    g.cacheScalar("diff(checkSum-mpf)", diff);
-    g.requireFiniteScalar(diff, "diff");
-
+    resp_ = HdmKernel::compute(met, ref, jet1, jetn);
+
+    g.cacheScalar("bal",    resp_.bal)
+     .cacheScalar("mpf",    resp_.mpf)
+     .cacheScalar("mpf1",   resp_.mpf1)
+     .cacheScalar("mpfn",   resp_.mpfn)
+     .cacheScalar("mpfu",   resp_.mpfu)
+     .cacheScalar("mpfnu",  resp_.mpfnu)
+     .cacheScalar("mpfx",   resp_.mpfx)
+     .cacheScalar("mpf1x",  resp_.mpf1x)
+     .cacheScalar("mpfnPt", resp_.mpfnPt)
+     .cacheScalar("mpfux",  resp_.mpfux)
+     .cacheScalar("mpfnux", resp_.mpfnux);
+
+    g.requireFiniteScalar(resp_.bal,    "bal");
+    g.requireFiniteScalar(resp_.mpf,    "mpf");
+    g.requireFiniteScalar(resp_.mpf1,   "mpf1");
+    g.requireFiniteScalar(resp_.mpfn,   "mpfn");
+    g.requireFiniteScalar(resp_.mpfu,   "mpfu");
+    g.requireFiniteScalar(resp_.mpfnu,  "mpfnu");
+    g.requireFiniteScalar(resp_.mpfx,   "mpfx");
+    g.requireFiniteScalar(resp_.mpf1x,  "mpf1x");
+    g.requireFiniteScalar(resp_.mpfnPt, "mpfnPt");
+    g.requireFiniteScalar(resp_.mpfux,  "mpfux");
+    g.requireFiniteScalar(resp_.mpfnux, "mpfnux");
+
+    // Sanity check for HDM identities: Met1 + Metn - Metu = MET
+    const double diff = resp_.mpf1 + resp_.mpfn - resp_.mpfu - resp_.mpf;
+    g.cacheScalar("diff(mpf1+mpfn-mpfu-mpf)", diff);
     if (std::fabs(diff) > 1e-4) {
         std::ostringstream oss;
-        oss << "HDM identity failed: mpf != mpf1+mpfn+mpfu "
+        oss << "HDM identity failed: mpf != mpf1+mpfn-mpfu "
             << "(diff=" << diff
-            << ", mpf=" << mpf_
-            << ", mpf1=" << mpf1_
-            << ", mpfn=" << mpfn_
-            << ", mpfu=" << mpfu_ << ")";
+            << ", mpf=" << resp_.mpf
+            << ", mpf1=" << resp_.mpf1
+            << ", mpfn=" << resp_.mpfn
+            << ", mpfu=" << resp_.mpfu << ")";
         g.fail(oss.str());
     }
 
@@ -186,38 +110,18 @@ void MathHdm::calcResponse(const TLorentzVector& p4CorrMet,
     }
 }
 
-//---------------------------------------------------------------------
-// makeTransverse:
-//   Sets the Pz component of a TLorentzVector to zero.
-//---------------------------------------------------------------------
-void MathHdm::makeTransverse(TLorentzVector& vec)
-{
-    vec.SetPz(0.0);
-    // Intentionally do NOT touch E here; downstream uses Vect().Dot(...)
-}
-
 void MathHdm::printInputs() const
 {
-    std::cout << "MathHdm: Input 4-Vectors:\n";
-    std::cout << "p4CorrMet: pt=" << p4CorrMet_.Pt()
-              << ", eta=" << p4CorrMet_.Eta()
-              << ", phi=" << p4CorrMet_.Phi() << "\n";
-
-    std::cout << "p4Ref:     pt=" << p4Ref_.Pt()
-              << ", eta=" << p4Ref_.Eta()
-              << ", phi=" << p4Ref_.Phi() << "\n";
-
-    std::cout << "p4Jet1:    pt=" << p4Jet1_.Pt()
-              << ", eta=" << p4Jet1_.Eta()
-              << ", phi=" << p4Jet1_.Phi() << "\n";
-
-    std::cout << "p4Jetn:    pt=" << p4Jetn_.Pt()
-              << ", eta=" << p4Jetn_.Eta()
-              << ", phi=" << p4Jetn_.Phi() << "\n";
-
-    std::cout << "p4Conservation: pt=" << p4Conservation_.Pt()
-              << ", eta=" << p4Conservation_.Eta()
-              << ", phi=" << p4Conservation_.Phi() << "\n\n";
+    const auto print = [](const char* name, const P2& v) {
+        std::cout << name << " px=" << v.px << ", py=" << v.py << ", pt=" << v.pt() << "\n";
+    };
+    std::cout << "MathHdm: transverse inputs:\n";
+    print("met: ", met_);
+    print("ref: ", ref_);
+    print("jet1:", jet1_);
+    print("jetn:", jetn_);
+    print("sum: ", met_ + ref_ + jet1_ + jetn_);
+    std::cout << "\n";
 }
 
 // Builds an axis that is A + B in the transverse plane, normalized to unit length.
@@ -1,6 +1,7 @@
 #include "MathL2Residual.h"
 
 #include "MathGuard.hpp"
+#include "HelperP4.hpp"
 
 #include <cmath>
 #include <limits>
@@ -130,11 +131,11 @@ HistL2ResidualInput MathL2Residual::computeResponse(const TLorentzVector& p4TagO
     in.relMpfResp = g.safeOnePlusOverOneMinus(asymmB, "asymmB", kEps);
 
     // Flatten η for MPF axes (transverse plane only)
-    p4CorrMet.SetPtEtaPhiM(p4CorrMet.Pt(), 0., p4CorrMet.Phi(), 0.);
-    p4SumTnP.SetPtEtaPhiM(p4SumTnP.Pt(), 0., p4SumTnP.Phi(), 0.);
-    p4Probe.SetPtEtaPhiM(p4Probe.Pt(), 0., p4Probe.Phi(), 0.);
-    p4Tag.SetPtEtaPhiM(p4Tag.Pt(), 0., p4Tag.Phi(), 0.);
-    p4SumOther.SetPtEtaPhiM(p4SumOther.Pt(), 0., p4SumOther.Phi(), 0.);
+    HelperP4::flattenEta(p4CorrMet);
+    HelperP4::flattenEta(p4SumTnP);
+    HelperP4::flattenEta(p4Probe);
+    HelperP4::flattenEta(p4Tag);
+    HelperP4::flattenEta(p4SumOther);
 
     g.cacheP4("met(flat)",   p4CorrMet);
     g.cacheP4("sumTnP(flat)",p4SumTnP);
@@ -200,11 +201,10 @@ HistL2ResidualInput MathL2Residual::computeResponse(const TLorentzVector& p4TagO
         mathHdm_.mpfResponse(p4Unclustered, p4P, ptTag, zero);
 
     // MPF on tag axis (T)
-    TLorentzVector p4Tagx_ = p4Tag;
-    double newPhi = p4Tag.Phi() + 0.5 * TMath::Pi();
-    newPhi = TMath::ATan2(std::sin(newPhi), std::cos(newPhi));
-    p4Tagx_.SetPhi(newPhi);
-    in.respMetOnTagx   = 1.0 + p4CorrMet.Vect().Dot(p4Tagx_.Vect()) / (ptTag*ptTag);
+    // Tag rotated by +pi/2 in the transverse plane: (px, py) -> (-py, px).
+    // Both vectors are flat here, so only the transverse dot product contributes.
+    const double dotMetTagx = -p4CorrMet.Px() * p4Tag.Py() + p4CorrMet.Py() * p4Tag.Px();
+    in.respMetOnTagx   = 1.0 + dotMetTagx / (ptTag*ptTag);
 
     auto p4T = mathHdm_.buildUnitAxis(p4Tag, TLorentzVector());
     g.cacheP4("axis(tag)", p4T);
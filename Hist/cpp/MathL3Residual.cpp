@@ -36,11 +36,11 @@ HistL3ResidualInput MathL3Residual::computeResponse(const TLorentzVector& p4TagO
     g.requireFiniteP4(p4CorrMetOrig,  "p4CorrMetOrig");
     g.requireFiniteP4(p4SumOtherOrig, "p4SumOtherOrig");
 
-    // Make local copies so we can safely modify η etc.
-    TLorentzVector p4Tag      = p4TagOrig;
-    TLorentzVector p4Probe    = p4ProbeOrig;
-    TLorentzVector p4CorrMet  = p4CorrMetOrig;
-    TLorentzVector p4SumOther = p4SumOtherOrig;
+    // Nothing below modifies the inputs: bind references instead of copying TObjects.
+    const TLorentzVector& p4Tag      = p4TagOrig;
+    const TLorentzVector& p4Probe    = p4ProbeOrig;
+    const TLorentzVector& p4CorrMet  = p4CorrMetOrig;
+    const TLorentzVector& p4SumOther = p4SumOtherOrig;
 
 
     const double ptTag   = p4Tag.Pt();
@@ -57,28 +57,33 @@ HistL3ResidualInput MathL3Residual::computeResponse(const TLorentzVector& p4TagO
         g.fail("invalid ptProbe (<0)");
     }
 
-    TLorentzVector p4SumTnP      = p4Probe + p4Tag;
-    TLorentzVector p4Unclustered = -(p4CorrMet + p4SumTnP + p4SumOther);
+    // Transverse components are all the responses need
+    const P2 met   = P2::of(p4CorrMet);
+    const P2 tag   = P2::of(p4Tag);
+    const P2 probe = P2::of(p4Probe);
+    const P2 other = P2::of(p4SumOther);
+    const P2 unclustered = -(met + tag + probe + other);
 
-    g.cacheP4("sumTnP(3D)",      p4SumTnP);
-    g.cacheP4("unclustered(3D)", p4Unclustered);
+    g.cacheScalar("unclustered.px", unclustered.px)
+     .cacheScalar("unclustered.py", unclustered.py);
 
     // Fill basic inputs
     HistL3ResidualInput in;
     in.ptTag         = ptTag;
     in.ptProbe       = ptProbe;
     in.etaProbe      = p4Probe.Eta();
-    in.ptMet         = p4CorrMet.Pt();
-    in.ptOther       = p4SumOther.Pt();
-    in.ptUnclustered = p4Unclustered.Pt();
-
-    mathHdm_.calcResponse(p4CorrMet, p4Tag, p4Probe, p4SumOther);
-    in.respDb    = mathHdm_.getBal();  
-    in.respMpf   = mathHdm_.getMpf();  
-    in.respMpf1  = mathHdm_.getMpf1(); 
-    in.respMpfn  = mathHdm_.getMpfn(); 
-    in.respMpfu  = mathHdm_.getMpfu(); 
-    in.respMpfnu = mathHdm_.getMpfnu();
+    in.ptMet         = met.pt();
+    in.ptOther       = other.pt();
+    in.ptUnclustered = unclustered.pt();
+
+    mathHdm_.calcResponse(met, tag, probe, other);
+    const HdmResponses& r = mathHdm_.getResponses();
+    in.respDb    = r.bal;
+    in.respMpf   = r.mpf;
+    in.respMpf1  = r.mpf1;
+    in.respMpfn  = r.mpfn;
+    in.respMpfu  = r.mpfu;
+    in.respMpfnu = r.mpfnu;
 
     if (globalFlags_.isDebug()) {
         printInputs(in);
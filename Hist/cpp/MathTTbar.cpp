@@ -68,26 +68,10 @@ void MathTTbar::setResolution(double resLep, double resMet, double resHadW, doub
     useResolutions_ = useRes;
 }
 
-double MathTTbar::calcChiSqr(const SkimTree& skimT,
-                             int iHadB, int iLepB,
-                             int iJet1, int iJet2,
-                             double pzMetHypo)
+double MathTTbar::calcChiSqr(const P4& hadB, const P4& lepB,
+                             const P4& jet1, const P4& jet2,
+                             const P4& lep, const P4& metHypo) const
 {
-    // Work on a local copy of the MET four-vector so that p4Met_ is not overwritten.
-    TLorentzVector metHyp = p4Met_;
-    metHyp.SetXYZM(metHyp.Px(), metHyp.Py(), pzMetHypo, 0.0); // neutrino massless
-
-    // Build the jet four-vectors
-    TLorentzVector p4HadB, p4LepB, p4Jet1, p4Jet2;
-    p4HadB.SetPtEtaPhiM( skimT.Jet_pt[iHadB],  skimT.Jet_eta[iHadB],
-                         skimT.Jet_phi[iHadB], skimT.Jet_mass[iHadB]); 
-    p4LepB.SetPtEtaPhiM( skimT.Jet_pt[iLepB],  skimT.Jet_eta[iLepB],
-                         skimT.Jet_phi[iLepB], skimT.Jet_mass[iLepB]); 
-    p4Jet1.SetPtEtaPhiM( skimT.Jet_pt[iJet1],  skimT.Jet_eta[iJet1],
-                         skimT.Jet_phi[iJet1], skimT.Jet_mass[iJet1]); 
-    p4Jet2.SetPtEtaPhiM( skimT.Jet_pt[iJet2],  skimT.Jet_eta[iJet2],
-                         skimT.Jet_phi[iJet2], skimT.Jet_mass[iJet2]); 
-
     // For now the uncertainties are fixed; real analyses might do more dynamic resolution usage.
     double sigma2HadW = resHadW_ * resHadW_;
     double sigma2HadT = resHadT_ * resHadT_;
@@ -100,15 +84,21 @@ double MathTTbar::calcChiSqr(const SkimTree& skimT,
         // sigma2LepT = sigmaLepB*sigmaLepB + resMet_*resMet_ + resLep_*resLep_;
     }
 
-    // Reconstruct the candidate four-vectors
-    TLorentzVector p4HadT = p4HadB + p4Jet1 + p4Jet2;
-    TLorentzVector p4HadW = p4Jet1 + p4Jet2;
-    TLorentzVector p4LepT = p4LepB + p4Lep_ + metHyp;
+    // Reconstruct the candidate four-vectors (components only; the χ² needs just the masses)
+    P4Sum p4HadW;
+    p4HadW.add(jet1);
+    p4HadW.add(jet2);
+    P4Sum p4HadT = p4HadW;
+    p4HadT.add(hadB);
+    P4Sum p4LepT;
+    p4LepT.add(lepB);
+    p4LepT.add(lep);
+    p4LepT.add(metHypo);
 
     // Compute the χ² using the differences from the expected masses.
-    double chiSq = std::pow(p4HadT.M() - massT_, 2) / sigma2HadT +
-                   std::pow(p4HadW.M() - massW_, 2) / sigma2HadW +
-                   std::pow(p4LepT.M() - massT_, 2) / sigma2LepT;
+    double chiSq = std::pow(p4HadT.mass() - massT_, 2) / sigma2HadT +
+                   std::pow(p4HadW.mass() - massW_, 2) / sigma2HadW +
+                   std::pow(p4LepT.mass() - massT_, 2) / sigma2LepT;
 
     return chiSq;
 }
@@ -196,6 +186,25 @@ int MathTTbar::minimizeChiSqr(const SkimTree& skimT)
     chiSqr_ = std::numeric_limits<double>::max();
     double comboChi2 = 9e9;
 
+    // Build every four-vector once; the combination loop below only sums components.
+    auto jetP4 = [&skimT](int idx) {
+        return P4::fromPtEtaPhiM(skimT.Jet_pt[idx],  skimT.Jet_eta[idx],
+                                 skimT.Jet_phi[idx], skimT.Jet_mass[idx]);
+    };
+    const P4 p4B[2] = { jetP4(indexJetsB_[0]), jetP4(indexJetsB_[1]) };
+    std::vector<P4> p4NonB;
+    p4NonB.reserve(indexJetsNonB_.size());
+    for (int idx : indexJetsNonB_) p4NonB.push_back(jetP4(idx));
+
+    const P4 p4Lep = P4::fromPxPyPzE(p4Lep_.Px(), p4Lep_.Py(), p4Lep_.Pz(), p4Lep_.E());
+    std::vector<P4> p4MetHypos; // massless neutrino, one per pz solution
+    p4MetHypos.reserve(pzMets.size());
+    for (double pz : pzMets) {
+        const double px = p4Met_.Px();
+        const double py = p4Met_.Py();
+        p4MetHypos.push_back(P4::fromPxPyPzE(px, py, pz, std::sqrt(px * px + py * py + pz * pz)));
+    }
+
     // indexJetsB_.size()==2 by construction, but let's do a small loop to consider permutations
     //   iHadB = indexJetsB_[0], iLepB = indexJetsB_[1]
     //   OR iHadB = indexJetsB_[1], iLepB = indexJetsB_[0]
@@ -203,6 +212,8 @@ int MathTTbar::minimizeChiSqr(const SkimTree& skimT)
     for (int pass=0; pass<2; pass++){
         int iHadB = (pass==0 ? indexJetsB_[0] : indexJetsB_[1]);
         int iLepB = (pass==0 ? indexJetsB_[1] : indexJetsB_[0]);
+        const P4& hadB = p4B[pass==0 ? 0 : 1];
+        const P4& lepB = p4B[pass==0 ? 1 : 0];
 
         for (size_t i = 0; i < indexJetsNonB_.size(); ++i) {
             for (size_t j = i+1; j < indexJetsNonB_.size(); ++j) {
@@ -210,8 +221,10 @@ int MathTTbar::minimizeChiSqr(const SkimTree& skimT)
                 int iJet2 = indexJetsNonB_[j];
 
                 // Loop over neutrino pz solutions
-                for (double testNuPz : pzMets) {
-                    comboChi2 = calcChiSqr(skimT, iHadB, iLepB, iJet1, iJet2, testNuPz);
+                for (size_t k = 0; k < pzMets.size(); ++k) {
+                    const double testNuPz = pzMets[k];
+                    comboChi2 = calcChiSqr(hadB, lepB, p4NonB[i], p4NonB[j],
+                                           p4Lep, p4MetHypos[k]);
                     if (comboChi2 < chiSqr_) {
                         chiSqr_ = comboChi2;
                         indexHadB_ = iHadB;
@@ -2,6 +2,7 @@
 
 #include "PickGuard.hpp"
 #include "ReadConfig.h"
+#include "fwk/LoggerService.h"
 
 #include <algorithm>
 #include <cmath>
@@ -43,6 +44,7 @@ void PickDiJet::loadConfig(const std::string& filename) {
         minPtTnP_   = config.getValue<double>({"diJetPick","minPtTnPForAK8"});
     }
     jetIdLabel_ = config.getValue<std::string>({"diJetPick","jetIdLabel"});
+    jetIdWp_ = PickJet::parseWorkingPoint(jetIdLabel_);
     minPtOther_ = config.getValue<double>({"diJetPick","minPtOther"});
     maxEtaTag_  = config.getValue<double>({"diJetPick","maxEtaTag"});
     useDeterministicSwap_ = config.getValue<bool>({"diJetPick","useDeterministicSwap"});
@@ -63,10 +65,6 @@ void PickDiJet::validateConfig_() const {
     }
 }
 
-void PickDiJet::printDebug(const std::string& msg) const {
-    if (isDebug_) std::cout << "[PickDiJet] " << msg << "\n";
-}
-
 void PickDiJet::resetOutputs_() {
     indexTag_   = -1;
     indexProbe_ = -1;
@@ -103,8 +101,8 @@ void PickDiJet::pickJets(const SkimTree& skimT) {
 
     resetOutputs_();
 
-    g.require(skimT.nJet >= 0, "NEG_NJET", "skimT.nJet is negative: " + std::to_string(skimT.nJet));
-    printDebug("Starting pickJets() with nJet=" + std::to_string(skimT.nJet));
+    g.require(skimT.nJet >= 0, "NEG_NJET", [&] { return "skimT.nJet is negative: " + std::to_string(skimT.nJet); });
+    FWK_DEBUG("[PickDiJet]", "Starting pickJets() with nJet=", skimT.nJet);
 
     // 1) collect all jets passing pT & Id
     std::vector<int> good;
@@ -113,7 +111,7 @@ void PickDiJet::pickJets(const SkimTree& skimT) {
     for (int i = 0; i < skimT.nJet; ++i) {
         const double pt  = skimT.Jet_pt[i];
         if (pt < minPtTnP_) continue;
-        if (!pickJet_.passId(skimT, i, jetIdLabel_)) continue;
+        if (!pickJet_.passId(skimT, i, jetIdWp_)) continue;
         const double eta = skimT.Jet_eta[i];
         const double phi = skimT.Jet_phi[i];
         const double m   = skimT.Jet_mass[i];
@@ -128,7 +126,7 @@ void PickDiJet::pickJets(const SkimTree& skimT) {
     }
 
     if (good.size() < 2) {
-        printDebug("→ fewer than two jets pass pT/id → event rejected");
+        FWK_DEBUG("[PickDiJet]", "→ fewer than two jets pass pT/id → event rejected");
         return;
     }
 
@@ -160,17 +158,18 @@ void PickDiJet::pickJets(const SkimTree& skimT) {
                         "probeJet");
 
     if (std::abs(p4Tag_.Eta()) > maxEtaTag_) {
-        printDebug("→ tag |η| too large → reject (|eta|=" + std::to_string(std::abs(p4Tag_.Eta())) + ")");
+        FWK_DEBUG("[PickDiJet]", "→ tag |η| too large → reject (|eta|=", std::abs(p4Tag_.Eta()), ")");
         resetOutputs_();
         return;
     }
 
-    printDebug("→ Tag idx=" + std::to_string(indexTag_) +
-               ", Probe idx=" + std::to_string(indexProbe_) +
-               ", Tag pt=" + std::to_string(p4Tag_.Pt()) +
-               ", Probe pt=" + std::to_string(p4Probe_.Pt()));
+    FWK_DEBUG("[PickDiJet]", "→ Tag idx=", indexTag_,
+               ", Probe idx=", indexProbe_,
+               ", Tag pt=", p4Tag_.Pt(),
+               ", Probe pt=", p4Probe_.Pt());
 
-    // 4) sum all other jets above minPtOther_
+    // 4) sum all other jets above minPtOther_ (component sums, one TLV at the end)
+    P4Sum sumOther;
     for (int i = 0; i < skimT.nJet; ++i) {
         if (i == indexTag_ || i == indexProbe_) continue;
 
@@ -186,9 +185,9 @@ void PickDiJet::pickJets(const SkimTree& skimT) {
 
         if (pt < minPtOther_) continue;
 
-        const TLorentzVector p4 = g.makeP4(pt, eta, phi, m, "otherJet");
-        p4SumOther_ += p4;
+        sumOther.add(g.makeKin(pt, eta, phi, m, "otherJet"));
     }
+    p4SumOther_ = HelperP4::toTLorentzVector(sumOther.get());
 
     // sanity on sum
     g.requireFinite(p4SumOther_.Pt(),  "p4SumOther.Pt()");
@@ -202,7 +201,7 @@ void PickDiJet::pickJets(const SkimTree& skimT) {
     g.require(hasTagProbe() ? (p4Tag_.Pt() > 0 && p4Probe_.Pt() > 0) : true,
           "BAD_OUTPUTS", "hasTagProbe but tag/probe pT not > 0");
 
-    printDebug("→ summed other jets with pT > " + std::to_string(minPtOther_) +
-               " : sumOtherPt=" + std::to_string(p4SumOther_.Pt()));
+    FWK_DEBUG("[PickDiJet]", "→ summed other jets with pT > ", minPtOther_,
+               " : sumOtherPt=", p4SumOther_.Pt());
 }
 
@@ -1,5 +1,7 @@
 #include "PickEvent.h"
 #include "ReadConfig.h"
+#include "fwk/LoggerService.h"
+#include "ResourceCache.h"
 #include <fstream>
 #include <stdexcept>
 
@@ -32,17 +34,6 @@ PickEvent::PickEvent(const GlobalFlag& globalFlags)
 PickEvent::~PickEvent() = default;
 
 // Helper function for printing debug messages
-void PickEvent::printDebug(const std::string& message) const {
-    if (isDebug_) {
-        std::cout << message << '\n';
-    }
-}
-
-void PickEvent::printWarn(const std::string& msg) const
-{
-    std::cerr << "[WARN] " << msg << "\n";
-}
-
 //============================================================
 // Config for jet veto + golden lumi
 //============================================================
@@ -56,6 +47,7 @@ void PickEvent::loadConfig(const std::string& filename) {
     jetVetoName_        = config.getValue<std::string>({yearKey, "jetVetoName"});
     jetVetoKey_         = config.getValue<std::string>({yearKey, "jetVetoKey"});
     jetIdLabel_         = config.getValue<std::string>({yearKey, "jetIdLabel"});
+    jetIdWp_ = PickJet::parseWorkingPoint(jetIdLabel_);
     goldenLumiJsonPath_ = config.getValue<std::string>({yearKey, "goldenLumiJsonPath"});
     doPtHatFilter_ = config.getValue<bool>({"pthatFilter", "doPtHatFilter"});
     maxDiffPVzGenVtxz_ = config.getValue<double>({"diffPVzGenVtxz", "maxDiff"});
@@ -73,68 +65,65 @@ void PickEvent::loadConfig(const std::string& filename) {
 // HLT
 //============================================================
 
-// Small helper to format a vector<string>
-static std::string joinStrings(const std::vector<std::string>& v,
-                               const std::string& sep = ", ")
+bool PickEvent::passHlt(const std::shared_ptr<SkimTree>& skimT)
 {
-    std::ostringstream os;
-    for (size_t i = 0; i < v.size(); ++i) {
-        if (i) os << sep;
-        os << v[i];
-    }
-    return os.str();
+    FWK_DEBUG("[PickEvent]", "<- PickEvent::passHlt ->");
+    passedHltMask_ = skimT->getTrigMask();
+    return passedHltMask_ != 0;
 }
 
-bool PickEvent::passHlt(const std::shared_ptr<SkimTree>& skimT)
+std::vector<std::string> PickEvent::getPassedHlts() const
 {
-    printDebug("<- PickEvent::passHlt ->");
-    passedHlts_.clear();
-
-    const std::string* names = skimT->getTrigNames();
-    const size_t n = skimT->getNumTrigNames();
+    std::vector<std::string> names;
+    const auto& trigNames = hlt_.getTrigNames();
+    Hlt::forEachTrig(passedHltMask_, [&](std::size_t id) { names.push_back(trigNames[id]); });
+    return names;
+}
 
-    for (size_t i = 0; i < n; ++i) {
-        const auto& trigName = names[i];
-        const int trigValue  = static_cast<int>(skimT->getTrigValue(trigName));
-        if (trigValue) passedHlts_.push_back(trigName);
-    }
+std::string PickEvent::getPassedHlt() const
+{
+    return passedHltId_ < 0 ? std::string() : hlt_.getTrigNames()[passedHltId_];
+}
 
-    return !passedHlts_.empty();
+// Names of the triggers in mask, for the multiple-match warning only
+static std::string joinTrigNames(const Hlt& hlt, Hlt::TrigMask mask)
+{
+    std::ostringstream os;
+    bool first = true;
+    Hlt::forEachTrig(mask, [&](std::size_t id) {
+        if (!first) os << ", ";
+        os << hlt.getTrigNames()[id];
+        first = false;
+    });
+    return os.str();
 }
 
 auto PickEvent::passHltWithPt(const std::shared_ptr<SkimTree>& skimT,
                               const double& pt) -> bool
 {
-    printDebug("<- PickEvent::passHltWithPt ->");
+    FWK_DEBUG("[PickEvent]", "<- PickEvent::passHltWithPt ->");
 
-    passedHlt_.clear();
-    std::vector<std::string> matched;
+    passedHltId_ = -1;
+    Hlt::TrigMask matched = 0;
 
-    const auto& trigs = hlt_.getTrigMapRangePt();
-
-    for (const auto& [trigName, trigRangePt] : trigs) {
-        const int trigValue = static_cast<int>(skimT->getTrigValue(trigName));
-        if (!trigValue) continue;
-
-        if (pt >= trigRangePt.ptMin && pt < trigRangePt.ptMax) {
-            matched.push_back(trigName);
-            printDebug(trigName + ", pt = " + std::to_string(pt) +
-                       " : " + std::to_string(trigValue));
+    const auto& ranges = hlt_.getTrigRangesPt();
+    Hlt::forEachTrig(skimT->getTrigMask(), [&](std::size_t id) {
+        const TrigRangePt& r = ranges[id];
+        if (pt >= r.ptMin && pt < r.ptMax) {
+            matched |= Hlt::TrigMask{1} << id;
+            FWK_DEBUG("[PickEvent]", hlt_.getTrigNames()[id], ", pt = ", pt);
         }
-    }
+    });
 
-    if (matched.empty()) return false;
+    if (!matched) return false;
 
-    if (matched.size() > 1) {
-        std::ostringstream warn;
-        warn << "PickEvent::passHltWithPt - Multiple HLTs matched. "
-             << "pt=" << pt
-             << ", matched: [" << joinStrings(matched)
-             << "]. Using the first one.";
-        printWarn(warn.str());
+    if (matched & (matched - 1)) {
+        FWK_WARN_LIMITED("PickEvent::passHltWithPt:multi", 20, "[PickEvent]",
+                         "passHltWithPt - Multiple HLTs matched. pt=", pt,
+                         ", matched: [", joinTrigNames(hlt_, matched), "]. Using the first one.");
     }
 
-    passedHlt_ = matched.front();
+    passedHltId_ = __builtin_ctzll(matched);
     return true;
 }
 
@@ -142,42 +131,36 @@ auto PickEvent::passHltWithPtEta(const std::shared_ptr<SkimTree>& skimT,
                                  const double& pt,
                                  const double& eta) -> bool
 {
-    printDebug("<- PickEvent::passHltWithPtEta ->");
+    FWK_DEBUG("[PickEvent]", "<- PickEvent::passHltWithPtEta ->");
 
-    passedHlt_.clear();
-    std::vector<std::string> matched;
+    passedHltId_ = -1;
+    Hlt::TrigMask matched = 0;
 
-    const auto& trigs = hlt_.getTrigMapRangePtEta();
+    const auto& ranges = hlt_.getTrigRangesPtEta();
     const double absEta = std::abs(eta);
 
-    for (const auto& [trigName, trigRangePtEta] : trigs) {
-        const int trigValue = static_cast<int>(skimT->getTrigValue(trigName));
-        if (!trigValue) continue;
+    Hlt::forEachTrig(skimT->getTrigMask(), [&](std::size_t id) {
+        const TrigRangePtEta& r = ranges[id];
+        if (pt >= r.ptMin &&
+            pt <  r.ptMax &&
+            absEta >= r.absEtaMin &&
+            absEta <  r.absEtaMax) {
 
-        if (pt >= trigRangePtEta.ptMin &&
-            pt <  trigRangePtEta.ptMax &&
-            absEta >= trigRangePtEta.absEtaMin &&
-            absEta <  trigRangePtEta.absEtaMax) {
-
-            matched.push_back(trigName);
-            printDebug(trigName + ", pt = " + std::to_string(pt) +
-                       ", eta = " + std::to_string(eta) +
-                       " : " + std::to_string(trigValue));
+            matched |= Hlt::TrigMask{1} << id;
+            FWK_DEBUG("[PickEvent]", hlt_.getTrigNames()[id], ", pt = ", pt,
+                       ", eta = ", eta);
         }
-    }
+    });
 
-    if (matched.empty()) return false;
+    if (!matched) return false;
 
-    if (matched.size() > 1) {
-        std::ostringstream warn;
-        warn << "PickEvent::passHltWithPtEta - Multiple HLTs matched. "
-             << "pt=" << pt << ", eta=" << eta
-             << ", matched: [" << joinStrings(matched)
-             << "]. Using the first one.";
-        printWarn(warn.str());
+    if (matched & (matched - 1)) {
+        FWK_WARN_LIMITED("PickEvent::passHltWithPtEta:multi", 20, "[PickEvent]",
+                         "passHltWithPtEta - Multiple HLTs matched. pt=", pt, ", eta=", eta,
+                         ", matched: [", joinTrigNames(hlt_, matched), "]. Using the first one.");
     }
 
-    passedHlt_ = matched.front();
+    passedHltId_ = __builtin_ctzll(matched);
     return true;
 }
 
@@ -185,7 +168,7 @@ void PickEvent::loadJetVetoRef() {
     std::cout << "==> PickEvent::loadJetVetoRef()" << '\n';
     try {
         loadedJetVetoRef_ =
-            correction::CorrectionSet::from_file(jetVetoJsonPath_)->at(jetVetoName_);
+            ResourceCache::correctionSet(jetVetoJsonPath_)->at(jetVetoName_);
     } catch (const std::exception& e) {
         std::cerr << "\nEXCEPTION: PickEvent::loadJetVetoRef()\n";
         std::cerr << "Check " << jetVetoJsonPath_ << " or " << jetVetoName_ << '\n';
@@ -196,11 +179,11 @@ void PickEvent::loadJetVetoRef() {
 
 void PickEvent::loadGoldenLumiJson() {
     std::cout << "==> PickEvent::loadGoldenLumiJson()" << '\n';
-    std::ifstream file(goldenLumiJsonPath_);
-    if (!file.is_open()) {
+    try {
+        loadedGoldenLumiJson_ = ResourceCache::json(goldenLumiJsonPath_);
+    } catch (const std::runtime_error&) {
         throw std::runtime_error("Cannot open golden lumi JSON: " + goldenLumiJsonPath_);
     }
-    file >> loadedGoldenLumiJson_;
 }
 
 //============================================================
@@ -215,8 +198,8 @@ bool PickEvent::passGoodLumi(unsigned int run, unsigned int lumi) const {
         std::cout << "Run = " << run << ", Lumi = " << lumi<<"\n";
     }
     try {
-        auto it = loadedGoldenLumiJson_.find(std::to_string(run));
-        if (it == loadedGoldenLumiJson_.end()) {
+        auto it = loadedGoldenLumiJson_->find(std::to_string(run));
+        if (it == loadedGoldenLumiJson_->end()) {
             if (isDebug_) {
                 std::cout << "Run " << run << " not in golden JSON\n";
             }
@@ -248,7 +231,7 @@ bool PickEvent::passJetVetoMap(const SkimTree& skimT) const {
         for (int i = 0; i != skimT.nJet; ++i) {
             if (std::abs(skimT.Jet_eta[i]) > maxEtaInMap) continue;
             if (std::abs(skimT.Jet_phi[i]) > maxPhiInMap) continue;
-            if (!pickJet_.passId(skimT, i, jetIdLabel_)) continue;
+            if (!pickJet_.passId(skimT, i, jetIdWp_)) continue;
 
             auto jvNumber =
                 loadedJetVetoRef_->evaluate({jetVetoKey_,
@@ -320,14 +303,14 @@ bool PickEvent::passPtHatFilter(const SkimTree& skimT, double leadJetPt) const {
     // Protect divisions / pathological values
     if (isMG && isRun3) {
         if (lheHT <= 0.0) {
-            printDebug("Run3 MG: LHE_HT <= 0, failing filter for safety.");
+            FWK_DEBUG("[PickEvent]", "Run3 MG: LHE_HT <= 0, failing filter for safety.");
             return false;
         }
     }
 
     // --- Your logic, verbatim in structure ---
     if (isMG && !isRun3 && (2.0 * pthatmax > lheHT)) {
-        printDebug("Fail: MG !Run3: 2*Pileup_pthatmax > LHE_HT");
+        FWK_DEBUG("[PickEvent]", "Fail: MG !Run3: 2*Pileup_pthatmax > LHE_HT");
         return false;
     }
 
@@ -336,13 +319,13 @@ bool PickEvent::passPtHatFilter(const SkimTree& skimT, double leadJetPt) const {
         const double rhs = 2.5 / std::pow(lheHT / 40.0, 2) + 1.5;
 
         if (lhs > rhs) {
-            printDebug("Fail: MG Run3 patch: 2*leadJetPt/LHE_HT > 2.5/pow(LHE_HT/40,2)+1.5");
+            FWK_DEBUG("[PickEvent]", "Fail: MG Run3 patch: 2*leadJetPt/LHE_HT > 2.5/pow(LHE_HT/40,2)+1.5");
             return false; // Run3 MG patch for missing Pileup_pthatmax
         }
     }
 
     if (!isMG && (pthatmax > genBin)) {
-        printDebug("Fail: !MG: Pileup_pthatmax > Generator_binvar");
+        FWK_DEBUG("[PickEvent]", "Fail: !MG: Pileup_pthatmax > Generator_binvar");
         return false;
     }
 
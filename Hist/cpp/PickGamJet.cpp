@@ -2,6 +2,7 @@
 
 #include "PickGuard.hpp"
 #include "ReadConfig.h"
+#include "fwk/LoggerService.h"
 
 #include <algorithm>
 #include <cmath>
@@ -25,10 +26,6 @@ PickGamJet::PickGamJet(const GlobalFlag& globalFlags)
 
 PickGamJet::~PickGamJet() = default;
 
-void PickGamJet::printDebug(const std::string& message) const {
-    if (isDebug_) std::cout << "[PickGamJet] " << message << '\n';
-}
-
 void PickGamJet::resetReco_() {
     pickedPhotons_.clear();
     pickedJetsP4_.clear();
@@ -58,6 +55,7 @@ void PickGamJet::loadConfig(const std::string& filename) {
     minPtJet_         = config.getValue<double>({"jetPick", "minPt"});
     maxEtaProbeJet_ = config.getValue<double>({"jetPick", "maxEtaProbe"});
     jetIdLabel_       = config.getValue<std::string>({"jetPick", "jetIdLabel"});
+    jetIdWp_ = PickJet::parseWorkingPoint(jetIdLabel_);
     minDeltaRrefJet_  = config.getValue<double>({"jetPick", "minDeltaR"});
     applyJetIdToJet2_ = config.getValue<bool>({"jetPick","applyJetIdToJet2"}); 
     applyEtaToJet2_   = config.getValue<bool>({"jetPick","applyEtaToJet2"}); 
@@ -100,9 +98,10 @@ void PickGamJet::pickPhotons(const SkimTree& skimT) {
     resetReco_();
     pickedPhotons_.clear();
 
-    g.require(skimT.nPhoton >= 0, "NEG_NPHOTON", "skimT.nPhoton is negative: " + std::to_string(skimT.nPhoton));
-    printDebug("Starting pickPhotons, nPhoton=" + std::to_string(skimT.nPhoton));
+    g.require(skimT.nPhoton >= 0, "NEG_NPHOTON", [&] { return "skimT.nPhoton is negative: " + std::to_string(skimT.nPhoton); });
+    FWK_DEBUG("[PickGamJet]", "Starting pickPhotons, nPhoton=", skimT.nPhoton);
 
+    skimT.require(SkimBranch::kPhoton);
     for (int phoInd = 0; phoInd < skimT.nPhoton; ++phoInd) {
         const double pt      = skimT.Photon_pt[phoInd];
         const double eta     = skimT.Photon_eta[phoInd];
@@ -130,17 +129,17 @@ void PickGamJet::pickPhotons(const SkimTree& skimT) {
         if (pass) pickedPhotons_.push_back(phoInd);
 
         if (isDebug_) {
-            printDebug("Photon " + std::to_string(phoInd) +
-                       " id=" + std::to_string(id) +
-                       " pt=" + std::to_string(pt) +
-                       " absEta=" + std::to_string(absEta) +
-                       " hoe=" + std::to_string(hoe) +
-                       " r9=" + std::to_string(r9) +
+            FWK_DEBUG("[PickGamJet]", "Photon ", phoInd,
+                       " id=", id,
+                       " pt=", pt,
+                       " absEta=", absEta,
+                       " hoe=", hoe,
+                       " r9=", r9,
                        (pass ? "  PASS" : "  fail"));
         }
     }
 
-    printDebug("Total Photons Selected: " + std::to_string(pickedPhotons_.size()));
+    FWK_DEBUG("[PickGamJet]", "Total Photons Selected: ", pickedPhotons_.size());
 }
 
 // Tag object picking (Photon -> Tag p4)
@@ -179,7 +178,7 @@ void PickGamJet::pickTag(const SkimTree& skimT) {
     if (pickedTagIndex_ != -1) {
         g.requireIndexInRange(pickedTagIndex_, skimT.nPhoton, "pickedPhotons_(front)");
         phoJetIdx_ = skimT.Photon_jetIdx[pickedTagIndex_];
-        printDebug("photon->jetIdx = " + std::to_string(phoJetIdx_));
+        FWK_DEBUG("[PickGamJet]", "photon->jetIdx = ", phoJetIdx_);
     }
 
     pickedTagP4 = g.makeP4(
@@ -189,12 +188,12 @@ void PickGamJet::pickTag(const SkimTree& skimT) {
         skimT.Photon_mass[leadIdx],
         "Photon_p4"
     );
-    printDebug("Leading photon selected as tag: idx=" +
-               std::to_string(leadIdx) +
-               ", pt=" + std::to_string(maxPt));
+    FWK_DEBUG("[PickGamJet]", "Leading photon selected as tag: idx=",
+               leadIdx,
+               ", pt=", maxPt);
 
     g.requireFinite(pickedTagP4.Pt(), "pickedTagP4");
-    printDebug("Total Tag Objects Selected: 1");
+    FWK_DEBUG("[PickGamJet]", "Total Tag Objects Selected: 1");
 }
 
 
@@ -232,14 +231,14 @@ void PickGamJet::pickJets(const SkimTree& skimT, const TLorentzVector& p4Tag) {
     pickedJetsIndex_.clear();
     pickedJetsP4_.clear();
 
-    g.require(skimT.nJet >= 0, "NEG_NJET", "skimT.nJet is negative: " + std::to_string(skimT.nJet));
+    g.require(skimT.nJet >= 0, "NEG_NJET", [&] { return "skimT.nJet is negative: " + std::to_string(skimT.nJet); });
 
     // Basic sanity for reference p4 (DeltaR uses eta/phi)
     g.requireFinite(p4Tag.Pt(),  "p4Tag.Pt()");
     g.requireFinite(p4Tag.Eta(), "p4Tag.Eta()");
     g.requireFinite(p4Tag.Phi(), "p4Tag.Phi()");
 
-    printDebug("pickJets: Starting, nJet=" + std::to_string(skimT.nJet));
+    FWK_DEBUG("[PickGamJet]", "pickJets: Starting, nJet=", skimT.nJet);
 
     // Collect jet candidates passing basic pt and not being the photon-associated jet
     std::vector<int> cand;
@@ -267,8 +266,8 @@ void PickGamJet::pickJets(const SkimTree& skimT, const TLorentzVector& p4Tag) {
     int iJet1 = (cand.size() >= 1) ? cand[0] : -1;
     int iJet2 = (cand.size() >= 2) ? cand[1] : -1;
 
-    printDebug("Top-2 pt candidates: iJet1=" + std::to_string(iJet1) +
-               " iJet2=" + std::to_string(iJet2));
+    FWK_DEBUG("[PickGamJet]", "Top-2 pt candidates: iJet1=", iJet1,
+               " iJet2=", iJet2);
 
     auto passDeltaR = [&](int jetIdx) -> bool {
         if (jetIdx < 0) return false;
@@ -288,7 +287,7 @@ void PickGamJet::pickJets(const SkimTree& skimT, const TLorentzVector& p4Tag) {
     auto passJetIdEta = [&](int jetIdx, bool applyId, bool applyEta) -> bool {
         if (jetIdx < 0) return false;
 
-        if (applyId && !pickJet_.passId(skimT, jetIdx, jetIdLabel_)) return false;
+        if (applyId && !pickJet_.passId(skimT, jetIdx, jetIdWp_)) return false;
 
         if (applyEta) {
             const double eta = skimT.Jet_eta[jetIdx];
@@ -301,52 +300,53 @@ void PickGamJet::pickJets(const SkimTree& skimT, const TLorentzVector& p4Tag) {
     // Apply JetID/eta (always to jet1; optional to jet2)
     if (globalFlags_.getJecDerivationLevel() == GlobalFlag::JecDerivationLevel::L3Residual) {
         if (iJet1 != -1 && !passJetIdEta(iJet1, true, true)) {
-            printDebug("iJet1 fails JetID/eta -> drop");
+            FWK_DEBUG("[PickGamJet]", "iJet1 fails JetID/eta -> drop");
             iJet1 = -1;
         }
     }else{
         if (iJet1 != -1 && !passJetIdEta(iJet1, true, false)) {// no eta-cut for L2Residual
-            printDebug("iJet1 fails JetID/eta -> drop");
+            FWK_DEBUG("[PickGamJet]", "iJet1 fails JetID/eta -> drop");
             iJet1 = -1;
         }
     }
     if (iJet2 != -1 && (applyJetIdToJet2_ || applyEtaToJet2_) &&
         !passJetIdEta(iJet2, applyJetIdToJet2_, applyEtaToJet2_)) {
-        printDebug("iJet2 fails JetID/eta -> drop");
+        FWK_DEBUG("[PickGamJet]", "iJet2 fails JetID/eta -> drop");
         iJet2 = -1;
     }
 
     // Apply DeltaR cut to both
     if (iJet1 != -1 && !passDeltaR(iJet1)) {
-        printDebug("iJet1 fails dR(ref,jet) -> drop");
+        FWK_DEBUG("[PickGamJet]", "iJet1 fails dR(ref,jet) -> drop");
         iJet1 = -1;
     }
     if (iJet2 != -1 && !passDeltaR(iJet2)) {
-        printDebug("iJet2 fails dR(ref,jet) -> drop");
+        FWK_DEBUG("[PickGamJet]", "iJet2 fails dR(ref,jet) -> drop");
         iJet2 = -1;
     }
 
-    printDebug("After JetID/eta/dR: iJet1=" + std::to_string(iJet1) +
-               " iJet2=" + std::to_string(iJet2));
+    FWK_DEBUG("[PickGamJet]", "After JetID/eta/dR: iJet1=", iJet1,
+               " iJet2=", iJet2);
 
     // Build p4 outputs: always return 3 vectors [jet1, jet2, sumOther]
-    TLorentzVector p4Jet1(0,0,0,0), p4Jet2(0,0,0,0), p4SumOther(0,0,0,0);
+    P4 p4Jet1, p4Jet2;
+    P4Sum sumOther;
 
     for (int i = 0; i < skimT.nJet; ++i) {
-        const auto p4 = g.makeP4(skimT.Jet_pt[i],
-                                 skimT.Jet_eta[i],
-                                 skimT.Jet_phi[i],
-                                 skimT.Jet_mass[i],
-                                 "Jet_p4");
+        const P4 p4 = g.makeKin(skimT.Jet_pt[i],
+                                skimT.Jet_eta[i],
+                                skimT.Jet_phi[i],
+                                skimT.Jet_mass[i],
+                                "Jet_p4");
 
         if (i == iJet1)       p4Jet1 = p4;
         else if (i == iJet2)  p4Jet2 = p4;
-        else                  p4SumOther += p4;
+        else                  sumOther.add(p4);
     }
 
-    pickedJetsP4_.push_back(p4Jet1);
-    pickedJetsP4_.push_back(p4Jet2);
-    pickedJetsP4_.push_back(p4SumOther);
+    pickedJetsP4_.push_back(HelperP4::toTLorentzVector(p4Jet1));
+    pickedJetsP4_.push_back(HelperP4::toTLorentzVector(p4Jet2));
+    pickedJetsP4_.push_back(HelperP4::toTLorentzVector(sumOther.get()));
 
     pickedJetsIndex_.push_back(iJet1);
     pickedJetsIndex_.push_back(iJet2);
@@ -359,7 +359,7 @@ void PickGamJet::pickJets(const SkimTree& skimT, const TLorentzVector& p4Tag) {
         g.requireIndexInRange(idx, skimT.nJet, "pickedJetsIndex_");
     }
 
-    printDebug("pickJets: done. pickedJetsIndex_.size=" + std::to_string(pickedJetsIndex_.size()));
+    FWK_DEBUG("[PickGamJet]", "pickJets: done. pickedJetsIndex_.size=", pickedJetsIndex_.size());
 }
 
 void PickGamJet::pickGenPhotons(const SkimTree& skimT) {
@@ -369,9 +369,9 @@ void PickGamJet::pickGenPhotons(const SkimTree& skimT) {
     pickedGenPhotons_.clear();
 
     g.require(skimT.nGenIsolatedPhoton >= 0, "NEG_NGENPHO",
-              "nGenIsolatedPhoton is negative: " + std::to_string(skimT.nGenIsolatedPhoton));
+              [&] { return "nGenIsolatedPhoton is negative: " + std::to_string(skimT.nGenIsolatedPhoton); });
 
-    printDebug("pickGenPhotons: nGenIsolatedPhoton=" + std::to_string(skimT.nGenIsolatedPhoton));
+    FWK_DEBUG("[PickGamJet]", "pickGenPhotons: nGenIsolatedPhoton=", skimT.nGenIsolatedPhoton);
 
     // Current behavior: keep all (pdgIdGenPho_ currently unused).
     for (int i = 0; i < skimT.nGenIsolatedPhoton; ++i) {
@@ -379,7 +379,7 @@ void PickGamJet::pickGenPhotons(const SkimTree& skimT) {
         pickedGenPhotons_.push_back(i);
     }
 
-    printDebug("Total Gen Photons Selected: " + std::to_string(pickedGenPhotons_.size()));
+    FWK_DEBUG("[PickGamJet]", "Total Gen Photons Selected: ", pickedGenPhotons_.size());
 }
 
 void PickGamJet::pickGenTags(const SkimTree& skimT, const TLorentzVector& p4Tag) {
@@ -410,6 +410,6 @@ void PickGamJet::pickGenTags(const SkimTree& skimT, const TLorentzVector& p4Tag)
     }
 
     g.requireAllFinite(pickedGenTags_, "pickedGenTags_");
-    printDebug("Total Gen Tag Objects Picked: " + std::to_string(pickedGenTags_.size()));
+    FWK_DEBUG("[PickGamJet]", "Total Gen Tag Objects Picked: ", pickedGenTags_.size());
 }
 
@@ -1,5 +1,6 @@
 #include "PickGamJetFake.h"
 #include "ReadConfig.h"
+#include "fwk/LoggerService.h"
 #include "HelperDelta.hpp"
 
 // Constructor implementation
@@ -46,14 +47,8 @@ void PickGamJetFake::loadConfig(const std::string& filename) {
 }
 
 // HelperDelta function for debug printing
-void PickGamJetFake::printDebug(const std::string& message) const {
-    if (isDebug_) {
-        std::cout << message << '\n';
-    }
-}
-
 void PickGamJetFake::pickJets(const SkimTree& skimT) {
-    printDebug("pickJetsForFakeGamma: Starting Selection, nJet = " + std::to_string(skimT.nJet));
+    FWK_DEBUG("[PickGamJetFake]", "pickJetsForFakeGamma: Starting Selection, nJet = ", skimT.nJet);
 
     pickedJetsIndex_.clear();
     pickedJetsP4_.clear();
@@ -103,9 +98,9 @@ void PickGamJetFake::pickJets(const SkimTree& skimT) {
         iJet3 = candIndices[2];
     }
 
-    printDebug("After picking top-3 pT jets: iJet1 = " + std::to_string(iJet1) +
-                ", iJet2 = " + std::to_string(iJet2) +
-                ", iJet3 = " + std::to_string(iJet3));
+    FWK_DEBUG("[PickGamJetFake]", "After picking top-3 pT jets: iJet1 = ", iJet1,
+                ", iJet2 = ", iJet2,
+                ", iJet3 = ", iJet3);
 
     //-----------------------------------------
     // 5) Store the final picked jet indices
@@ -159,15 +154,16 @@ void PickGamJetFake::pickJets(const SkimTree& skimT) {
     pickedJetsP4_.push_back(p4Jet3);
     pickedJetsP4_.push_back(p4Jetn);
 
-    printDebug("pickJetsForFakeGamma: Done.");
+    FWK_DEBUG("[PickGamJetFake]", "pickJetsForFakeGamma: Done.");
 }
 
 
 // Reference object picking 
 TLorentzVector PickGamJetFake::getMatchedGenJetP4(const SkimTree& skimT, const int& iJet) {
-    printDebug("\n pickRef: Starting Selection");
+    FWK_DEBUG("[PickGamJetFake]", "\n pickRef: Starting Selection");
     TLorentzVector p4GenJet;
     if (iJet < 0 || iJet >= skimT.nJet) return p4GenJet;
+    skimT.require(SkimBranch::kJetGen);
     int iGenJet = skimT.Jet_genJetIdx[iJet];
     if (iGenJet >=0 && iGenJet < skimT.nGenJet) {
         p4GenJet.SetPtEtaPhiM(skimT.GenJet_pt[iGenJet], skimT.GenJet_eta[iGenJet], 
@@ -187,23 +183,24 @@ TLorentzVector PickGamJetFake::getMatchedGenJetP4(const SkimTree& skimT, const i
         if (p4GenJet.DeltaR(p4Jet) < maxDeltaRgenJet_ &&  
             p4GenJet.Pt() > minPtGenJet_ && 
             std::abs(p4GenJet.Eta()) < maxEtaGenJet_ ) {
-            printDebug("Jet index added to reference = " + std::to_string(iJet));
-            printDebug("GenJet index added to reference = " + std::to_string(iGenJet));
-            printDebug("Reco pt = " + std::to_string(skimT.Jet_pt[iJet]));
-            printDebug("GenJet pt = " + std::to_string(pt));
-            printDebug("UE offset = " + std::to_string(offset));
+            FWK_DEBUG("[PickGamJetFake]", "Jet index added to reference = ", iJet);
+            FWK_DEBUG("[PickGamJetFake]", "GenJet index added to reference = ", iGenJet);
+            FWK_DEBUG("[PickGamJetFake]", "Reco pt = ", skimT.Jet_pt[iJet]);
+            FWK_DEBUG("[PickGamJetFake]", "GenJet pt = ", pt);
+            FWK_DEBUG("[PickGamJetFake]", "UE offset = ", offset);
         }
     }
-    printDebug("pickRef: Done.\n");
+    FWK_DEBUG("[PickGamJetFake]", "pickRef: Done.\n");
     return p4GenJet;
 }
 
 
 //For monitoring and scale of EM jet: Photon selection
 void PickGamJetFake::pickPhotons(const SkimTree& skimT) {
-    printDebug("Starting Selection, nPhoton = "+std::to_string(skimT.nPhoton));
+    FWK_DEBUG("[PickGamJetFake]", "Starting Selection, nPhoton = ", skimT.nPhoton);
     pickedPhotons_.clear();
 
+    skimT.require(SkimBranch::kPhoton);
     for (int phoInd = 0; phoInd < skimT.nPhoton; ++phoInd) {
         double pt  = skimT.Photon_pt[phoInd];
         double absEta = std::abs(skimT.Photon_eta[phoInd]);
@@ -216,22 +213,21 @@ void PickGamJetFake::pickPhotons(const SkimTree& skimT) {
         if(pt > minPtPho_ && absEta < maxEtaPho_ && r9 < maxR9Pho_ && r9 > minR9Pho_ && hoe < maxHoePho_ && id==tightIdPho_ && eleVeto==isEleVetoPho_ && pixelSeed==hasPixelSeedPho_){
             pickedPhotons_.push_back(phoInd);
         }
-        printDebug(
-            "Photon " + std::to_string(phoInd) + 
-            ", Id  = " + std::to_string(id) + 
-            ", pt  = " + std::to_string(pt) + 
-            ", absEta  = " + std::to_string(absEta) + 
-            ", hoe  = " + std::to_string(hoe) + 
-            ", r9  = " + std::to_string(r9)
+        FWK_DEBUG("[PickGamJetFake]", "Photon ", phoInd, 
+            ", Id  = ", id, 
+            ", pt  = ", pt, 
+            ", absEta  = ", absEta, 
+            ", hoe  = ", hoe, 
+            ", r9  = ", r9
        );
     }
-    printDebug("Total Photons Selected: " + std::to_string(pickedPhotons_.size()));
+    FWK_DEBUG("[PickGamJetFake]", "Total Photons Selected: ", pickedPhotons_.size());
 }
 
 TLorentzVector PickGamJetFake::getMatchedGenPhotonP4(const SkimTree& skimT, int phoInd) const {
     TLorentzVector zero;
     if (phoInd < 0 || phoInd >= skimT.nPhoton) {
-        printDebug("getMatchedGenPhotonP4: invalid phoInd = " + std::to_string(phoInd));
+        FWK_DEBUG("[PickGamJetFake]", "getMatchedGenPhotonP4: invalid phoInd = ", phoInd);
         return zero;
     }
 
@@ -291,6 +287,7 @@ TLorentzVector PickGamJetFake::getMatchedGenPhotonP4(const SkimTree& skimT, int
     // =====================================================
     std::unordered_map<int, std::vector<int>> motherToGammas;
     motherToGammas.reserve(64);
+    skimT.require(SkimBranch::kGenPart);
     for (int i = 0; i < skimT.nGenPart; ++i) {
         if (skimT.GenPart_pdgId[i] != 22) continue; // photons only
         const int mom = skimT.GenPart_genPartIdxMother[i];
@@ -405,22 +402,22 @@ TLorentzVector PickGamJetFake::getMatchedGenPhotonP4(const SkimTree& skimT, int
             const double sc = score(cands[i]);
             if (sc < bestScore) { best = &cands[i]; bestScore = sc; }
         }
-        printDebug("getMatchedGenPhotonP4: picked '" + best->tag
-                   + "'  dR=" + std::to_string(best->dR)
-                   + "  pTgen=" + std::to_string(best->p4.Pt())
-                   + "  pTreco=" + std::to_string(recoPt)
-                   + "  rel|ΔpT|=" + std::to_string(best->dPtRel)
-                   + "  R_core=" + std::to_string(R_core)
-                   + "  R_adapt=" + std::to_string(R_adapt)
-                   + "  eta_max=" + std::to_string(eta_max)
-                   + "  phi_max=" + std::to_string(phi_max));
+        FWK_DEBUG("[PickGamJetFake]", "getMatchedGenPhotonP4: picked '", best->tag,
+                  "'  dR=", best->dR,
+                  "  pTgen=", best->p4.Pt(),
+                  "  pTreco=", recoPt,
+                  "  rel|ΔpT|=", best->dPtRel,
+                  "  R_core=", R_core,
+                  "  R_adapt=", R_adapt,
+                  "  eta_max=", eta_max,
+                  "  phi_max=", phi_max);
         return best->p4;
     }
 
     // =====================================================
     // 6) No match
     // =====================================================
-    printDebug("getMatchedGenPhotonP4: no gen match within ΔR < " + std::to_string(maxDR));
+    FWK_DEBUG("[PickGamJetFake]", "getMatchedGenPhotonP4: no gen match within ΔR < ", maxDR);
     return zero;
 }
 
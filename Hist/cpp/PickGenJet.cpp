@@ -1,6 +1,8 @@
 #include "PickGenJet.h"
 
+#include "PairMatch.hpp"
 #include "ReadConfig.h"
+#include "fwk/LoggerService.h"
 
 #include <cmath>
 #include <sstream>
@@ -18,11 +20,6 @@ PickGenJet::PickGenJet(const GlobalFlag& globalFlags)
     validateConfig_();
 }
 
-void PickGenJet::printDebug_(const std::string& msg) const {
-    if (!isDebug_) return;
-    std::cout << "[PickGenJet] " << msg << "\n";
-}
-
 void PickGenJet::requireFinite_(double x, const std::string& what) {
     if (!std::isfinite(x)) {
         throw std::runtime_error("PickGenJet - non-finite value for: " + what);
@@ -55,16 +52,27 @@ void PickGenJet::validateConfig_() const {
     }
 }
 
+void PickGenJet::indexGenJets(const SkimTree& skimT, EtaIndex& genJets) {
+    genJets.build(static_cast<int>(skimT.nGenJet), skimT.GenJet_eta, skimT.GenJet_phi, skimT.GenJet_pt,
+                  [&](int i) {
+                      requireFinite_(skimT.GenJet_eta[i], "GenJet_eta(genMatch)");
+                      requireFinite_(skimT.GenJet_phi[i], "GenJet_phi(genMatch)");
+                      return true;
+                  });
+}
+
 PickGenJet::Result PickGenJet::matchByRecoIndices(const SkimTree& skimT,
                                                   int iJet1, int iJet2,
                                                   const TLorentzVector& p4Jet1,
-                                                  const TLorentzVector& p4Jet2) const
+                                                  const TLorentzVector& p4Jet2,
+                                                  const EtaIndex* genJets) const
 {
     // Distangle from call site: if not MC, do nothing and return default result.
     if (!globalFlags_.isMC()) return Result{};
 
     const bool want1 = (iJet1 != -1);
     const bool want2 = (iJet2 != -1);
+    if (genJets) return matchIndexed_(skimT, want1, want2, p4Jet1, p4Jet2, *genJets);
     return matchImpl_(skimT, want1, want2, p4Jet1, p4Jet2);
 }
 
@@ -88,9 +96,9 @@ PickGenJet::Result PickGenJet::matchImpl_(const SkimTree& skimT,
         throw std::runtime_error("PickGenJet::match - skimT.nGenJet is negative");
     }
 
-    printDebug_("match: nGenJet=" + std::to_string(skimT.nGenJet) +
-                " want1=" + std::to_string(want1) +
-                " want2=" + std::to_string(want2));
+    FWK_DEBUG("[PickGenJet]", "match: nGenJet=", skimT.nGenJet,
+                " want1=", want1,
+                " want2=", want2);
 
     if (want1) {
         requireFinite_(p4Jet1.Pt(),  "p4Jet1.Pt(genMatch)");
@@ -167,12 +175,58 @@ PickGenJet::Result PickGenJet::matchImpl_(const SkimTree& skimT,
         }
     }
 
-    printDebug_("match: iGenJet1=" + std::to_string(res.iGenJet1) +
-                " iGenJet2=" + std::to_string(res.iGenJet2));
+    FWK_DEBUG("[PickGenJet]", "match: iGenJet1=", res.iGenJet1,
+                " iGenJet2=", res.iGenJet2);
 
     return res;
 }
 
+// Same selection as matchImpl_, as cone queries on the shared gen-jet index:
+// jet1 takes the closest gen jet with pt >= minPt, jet2 the closest remaining
+// one with pt > minPt.
+PickGenJet::Result PickGenJet::matchIndexed_(const SkimTree& skimT,
+                                             bool want1, bool want2,
+                                             const TLorentzVector& p4Jet1,
+                                             const TLorentzVector& p4Jet2,
+                                             const EtaIndex& genJets) const
+{
+    FWK_DEBUG("[PickGenJet]", "matchIndexed: nGenJet=", skimT.nGenJet,
+                " want1=", want1,
+                " want2=", want2);
+
+    Result res;
+    if (want1) {
+        requireFinite_(p4Jet1.Pt(),  "p4Jet1.Pt(genMatch)");
+        requireFinite_(p4Jet1.Eta(), "p4Jet1.Eta(genMatch)");
+        requireFinite_(p4Jet1.Phi(), "p4Jet1.Phi(genMatch)");
+        res.iGenJet1 = genJets.closest(p4Jet1.Eta(), p4Jet1.Phi(), maxDeltaRgenJet_,
+                                       [&](const EtaIndex::Item& g) { return g.pt < minPtGenJet_; });
+        if (res.iGenJet1 != -1) {
+            const int i = res.iGenJet1;
+            res.p4GenJet1 = makeP4_(skimT.GenJet_pt[i], skimT.GenJet_eta[i],
+                                    skimT.GenJet_phi[i], skimT.GenJet_mass[i]);
+        }
+    }
+    if (want2) {
+        requireFinite_(p4Jet2.Pt(),  "p4Jet2.Pt(genMatch)");
+        requireFinite_(p4Jet2.Eta(), "p4Jet2.Eta(genMatch)");
+        requireFinite_(p4Jet2.Phi(), "p4Jet2.Phi(genMatch)");
+        res.iGenJet2 = genJets.closest(p4Jet2.Eta(), p4Jet2.Phi(), maxDeltaRgenJet_,
+                                       [&](const EtaIndex::Item& g) {
+                                           return g.idx == res.iGenJet1 || !(g.pt > minPtGenJet_);
+                                       });
+        if (res.iGenJet2 != -1) {
+            const int i = res.iGenJet2;
+            res.p4GenJet2 = makeP4_(skimT.GenJet_pt[i], skimT.GenJet_eta[i],
+                                    skimT.GenJet_phi[i], skimT.GenJet_mass[i]);
+        }
+    }
+
+    FWK_DEBUG("[PickGenJet]", "matchIndexed: iGenJet1=", res.iGenJet1,
+                " iGenJet2=", res.iGenJet2);
+
+    return res;
+}
 
 // General match for single jet 
 TLorentzVector PickGenJet:: matchedP4GenJet(const SkimTree& skimT,
@@ -1,5 +1,7 @@
 // cpp/PickJet.cpp
 #include "PickJet.h"
+#include "JetQuality.h"
+#include "fwk/LoggerService.h"
 
 #include <algorithm>
 #include <cmath>
@@ -12,12 +14,6 @@ PickJet::PickJet(const GlobalFlag& globalFlags)
 {
 }
 
-void PickJet::printDebug(const std::string& message) const {
-    if (globalFlags_.isDebug()) {
-        std::cout << "[PickJet] " << message << '\n';
-    }
-}
-
 // -------------------------------------------------------------
 // Version helpers
 // -------------------------------------------------------------
@@ -34,6 +30,17 @@ bool PickJet::passId(const SkimTree& skimT,
                      int iJ,
                      WorkingPoint wp) const
 {
+    // Fast path: bits computed once per event by JetQuality (after ScaleJet).
+    if (skimT.hasJetQualityMask) {
+        switch (wp) {
+            case WorkingPoint::Tight:
+                return JetQuality::has(skimT, iJ, JetQuality::IdTight);
+            case WorkingPoint::TightLepVeto:
+                return JetQuality::has(skimT, iJ, JetQuality::IdTightLepVeto);
+            default:
+                return false;
+        }
+    }
 
     switch (wp) {
         case WorkingPoint::Tight:
@@ -45,24 +52,31 @@ bool PickJet::passId(const SkimTree& skimT,
     }
 }
 
-bool PickJet::passId(const SkimTree& skimT,
-                     int iJ,
-                     const std::string& label) const
-{
+PickJet::WorkingPoint PickJet::parseWorkingPoint(const std::string& label) {
     // Allow label from config: "Tight", "tight", "TightLepVeto", "tightlepveto", etc.
     std::string l = label;
     std::transform(l.begin(), l.end(), l.begin(), ::tolower);
 
     if (l == "tight") {
-        return passId(skimT, iJ, WorkingPoint::Tight);
+        return WorkingPoint::Tight;
     } else if (l == "tightlepveto" || l == "tightlep" || l == "tight_lepveto") {
-        return passId(skimT, iJ, WorkingPoint::TightLepVeto);
+        return WorkingPoint::TightLepVeto;
     }
+    return WorkingPoint::Unknown;
+}
 
-    if (globalFlags_.isDebug()) {
-        printDebug("Unknown JetId label: '" + label + "', returning false");
+bool PickJet::passId(const SkimTree& skimT,
+                     int iJ,
+                     const std::string& label) const
+{
+    const WorkingPoint wp = parseWorkingPoint(label);
+    if (wp == WorkingPoint::Unknown) {
+        if (globalFlags_.isDebug()) {
+            FWK_DEBUG("[PickJet]", "Unknown JetId label: '", label, "', returning false");
+        }
+        return false;
     }
-    return false; 
+    return passId(skimT, iJ, wp);
 }
 
 // -------------------------------------------------------------
@@ -75,9 +89,9 @@ bool PickJet::passTight(const SkimTree& skimT, int iJ) const {
 
     if (globalFlags_.isDebug()) {
         const float eta = skimT.Jet_eta[iJ];
-        printDebug("jet " + std::to_string(iJ) +
-                   " (eta=" + std::to_string(eta) +
-                   "): passTight=" + (pass ? "true" : "false"));
+        FWK_DEBUG("[PickJet]", "jet ", iJ,
+                   " (eta=", eta,
+                   "): passTight=", (pass ? "true" : "false"));
     }
 
     return pass;
@@ -90,9 +104,9 @@ bool PickJet::passTightLepVeto(const SkimTree& skimT, int iJ) const {
 
     if (globalFlags_.isDebug()) {
         const float eta = skimT.Jet_eta[iJ];
-        printDebug("jet " + std::to_string(iJ) +
-                   " (eta=" + std::to_string(eta) +
-                   "): passTightLepVeto=" + (pass ? "true" : "false"));
+        FWK_DEBUG("[PickJet]", "jet ", iJ,
+                   " (eta=", eta,
+                   "): passTightLepVeto=", (pass ? "true" : "false"));
     }
 
     return pass;
@@ -118,6 +132,7 @@ bool PickJet::passTightManual_(const SkimTree& skimT, int iJ) const {
     const float neHEF          = skimT.Jet_neHEF[iJ];
     const float neEmEF         = skimT.Jet_neEmEF[iJ];
     const float chHEF          = skimT.Jet_chHEF[iJ];
+    skimT.require(SkimBranch::kJetMultiplicity);
     const Short_t chMultiplicity = skimT.Jet_chMultiplicity[iJ];
     const Short_t neMultiplicity = skimT.Jet_neMultiplicity[iJ];
 
@@ -140,16 +155,15 @@ bool PickJet::passTightManual_(const SkimTree& skimT, int iJ) const {
     }
 
     if (globalFlags_.isDebug()) {
-        printDebug(
-            "[passTightManual] jet " + std::to_string(iJ) +
-            " eta=" + std::to_string(eta) +
-            " absEta=" + std::to_string(absEta) +
-            " neHEF=" + std::to_string(neHEF) +
-            " neEmEF=" + std::to_string(neEmEF) +
-            " chHEF=" + std::to_string(chHEF) +
-            " chMult=" + std::to_string(chMultiplicity) +
-            " neMult=" + std::to_string(neMultiplicity) +
-            " → pass=" + std::string(pass ? "true" : "false")
+        FWK_DEBUG("[PickJet]", "[passTightManual] jet ", iJ,
+            " eta=", eta,
+            " absEta=", absEta,
+            " neHEF=", neHEF,
+            " neEmEF=", neEmEF,
+            " chHEF=", chHEF,
+            " chMult=", chMultiplicity,
+            " neMult=", neMultiplicity,
+            " → pass=", std::string(pass ? "true" : "false")
         );
     }
 
@@ -166,10 +180,9 @@ bool PickJet::passTightLepVetoManual_(const SkimTree& skimT, int iJ) const {
 
     if (!passTightId) {
         if (globalFlags_.isDebug()) {
-            printDebug(
-                "[passTightLepVetoManual] jet " + std::to_string(iJ) +
-                " eta=" + std::to_string(eta) +
-                " absEta=" + std::to_string(absEta) +
+            FWK_DEBUG("[PickJet]", "[passTightLepVetoManual] jet ", iJ,
+                " eta=", eta,
+                " absEta=", absEta,
                 " passTightId=false → pass=false"
             );
         }
@@ -186,13 +199,12 @@ bool PickJet::passTightLepVetoManual_(const SkimTree& skimT, int iJ) const {
                (chEmEF < 0.8f);
 
         if (globalFlags_.isDebug()) {
-            printDebug(
-                "[passTightLepVetoManual] jet " + std::to_string(iJ) +
-                " eta=" + std::to_string(eta) +
-                " absEta=" + std::to_string(absEta) +
-                " muEF=" + std::to_string(muEF) +
-                " chEmEF=" + std::to_string(chEmEF) +
-                " passTightId=true → pass=" + (pass ? "true" : "false")
+            FWK_DEBUG("[PickJet]", "[passTightLepVetoManual] jet ", iJ,
+                " eta=", eta,
+                " absEta=", absEta,
+                " muEF=", muEF,
+                " chEmEF=", chEmEF,
+                " passTightId=true → pass=", (pass ? "true" : "false")
             );
         }
     } else {
@@ -200,10 +212,9 @@ bool PickJet::passTightLepVetoManual_(const SkimTree& skimT, int iJ) const {
         pass = true;
 
         if (globalFlags_.isDebug()) {
-            printDebug(
-                "[passTightLepVetoManual] jet " + std::to_string(iJ) +
-                " eta=" + std::to_string(eta) +
-                " absEta=" + std::to_string(absEta) +
+            FWK_DEBUG("[PickJet]", "[passTightLepVetoManual] jet ", iJ,
+                " eta=", eta,
+                " absEta=", absEta,
                 " region: |eta|>2.7 (inherits Tight) → pass=true"
             );
         }
@@ -2,6 +2,7 @@
 #include "HelperDelta.hpp"
 #include <TMath.h>
 #include "ReadConfig.h"
+#include "fwk/LoggerService.h"
 
 // Constructor: you can load these from JSON if you like,
 // or just hard‐code the defaults shown here:
@@ -29,17 +30,13 @@ void PickMultiJet::loadConfig(const std::string& filename) {
     // Jet pick configuration
     minPtProbe_      = config.getValue<double>({"pickJet","minPtProbe"});
     jetIdLabel_     = config.getValue<std::string>({"pickJet", "jetIdLabel"});
+    jetIdWp_ = PickJet::parseWorkingPoint(jetIdLabel_);
     maxEtaRecoil_   = config.getValue<double>({"pickJet","maxEtaRecoil"});
     minPtRecoil_    = config.getValue<double>({"pickJet","minPtRecoil"});
     minPtOther_     = config.getValue<double>({"pickJet","minPtOther"});
     minDPhiRecoil_  = config.getValue<double>({"pickJet","minDPhiRecoil"});
 }
 
-void PickMultiJet::printDebug(const std::string& msg) const {
-    if (isDebug_) std::cout << "[PickMultiJet] " << msg << "\n";
-    //std::cout << "[PickMultiJet] " << msg << "\n";
-}
-
 void PickMultiJet::pickJets(const SkimTree& skimT) {
     // reset everything
     iProbe_            = -1;
@@ -51,7 +48,7 @@ void PickMultiJet::pickJets(const SkimTree& skimT) {
     vetoFwd_            = false;
     ptHardestInRecoil_  = 0.0;
 
-    printDebug("Starting pick() with nJet=" + std::to_string(skimT.nJet));
+    FWK_DEBUG("[PickMultiJet]", "Starting pick() with nJet=", skimT.nJet);
 
     // 1) find highest-pT jet
     double maxPt = 0.0;
@@ -62,17 +59,17 @@ void PickMultiJet::pickJets(const SkimTree& skimT) {
             iProbe_ = i;
         }
     }
-    printDebug("Found lead jet idx=" + std::to_string(iProbe_) +
-               " pt=" + std::to_string(maxPt));
+    FWK_DEBUG("[PickMultiJet]", "Found lead jet idx=", iProbe_,
+               " pt=", maxPt);
 
     // 2) require pT & ID
     if (iProbe_ < 0 || maxPt < minPtProbe_) {
-        printDebug("→ no valid lead or below pT threshold");
+        FWK_DEBUG("[PickMultiJet]", "→ no valid lead or below pT threshold");
         iProbe_ = -1;
         return;
     }
-    if (!pickJet_.passId(skimT, iProbe_, jetIdLabel_)) {
-        printDebug("→ lead fails jetId, rejecting");
+    if (!pickJet_.passId(skimT, iProbe_, jetIdWp_)) {
+        FWK_DEBUG("[PickMultiJet]", "→ lead fails jetId, rejecting");
         iProbe_ = -1;
         return;
     }
@@ -99,8 +96,8 @@ void PickMultiJet::pickJets(const SkimTree& skimT) {
 
         // recoil criteria
         if (pt > minPtRecoil_ && fabs(eta) < maxEtaRecoil_ && dphi > minDPhiRecoil_) {
-            if (!pickJet_.passId(skimT, i, jetIdLabel_)) {
-                printDebug("→ a recoil jet fails ID, rejecting whole event");
+            if (!pickJet_.passId(skimT, i, jetIdWp_)) {
+                FWK_DEBUG("[PickMultiJet]", "→ a recoil jet fails ID, rejecting whole event");
                 // treat as event‐level fail:
                 iProbe_ = -1;
                 return;
@@ -124,8 +121,8 @@ void PickMultiJet::pickJets(const SkimTree& skimT) {
         }
     }
 
-    printDebug("→ recoil count=" + std::to_string(recoilIndices_.size()) +
-               " vetoNear=" + std::to_string(vetoNear_) +
-               " vetoFwd="  + std::to_string(vetoFwd_));
+    FWK_DEBUG("[PickMultiJet]", "→ recoil count=", recoilIndices_.size(),
+               " vetoNear=", vetoNear_,
+               " vetoFwd=", vetoFwd_);
 }
 
@@ -1,6 +1,7 @@
 // cpp/PickWqqe.cpp
 #include "PickWqqe.h"
 #include "ReadConfig.h"
+#include "fwk/LoggerService.h"
 #include <cmath>
 #include <iostream>
 
@@ -25,20 +26,16 @@ void PickWqqe::loadConfig(const std::string& filename) {
     jetMinPt_         = config.getValue<double>({"jetMinPt"});
     jetMaxEta_        = config.getValue<double>({"jetMaxEta"});
     jetIdLabel_       = config.getValue<std::string>({"jetIdLabel"});
+    jetIdWp_ = PickJet::parseWorkingPoint(jetIdLabel_);
 
 }
 
 // Helper function for debug printing
-void PickWqqe::printDebug(const std::string& message){
-    if (globalFlags_.isDebug()) {
-        std::cout << message << '\n';
-    }
-}
-
 void PickWqqe::pickElectrons(const SkimTree& skimT) {
-    printDebug("Starting pickElectrons, nElectron = " + std::to_string(skimT.nElectron));
+    FWK_DEBUG("[PickWqqe]", "Starting pickElectrons, nElectron = ", skimT.nElectron);
     pickedElectrons_.clear();
 
+    skimT.require(SkimBranch::kElectron);
     for (int eleInd = 0; eleInd < skimT.nElectron; ++eleInd) {
         double eta = skimT.Electron_eta[eleInd];
         double absEta = std::abs(eta);
@@ -54,15 +51,15 @@ void PickWqqe::pickElectrons(const SkimTree& skimT) {
         bool eleSel = (passEtaEBEEGap && absEta <= maxEtaEle_ && pt >= minPtEle_ && passTightID);
         if (eleSel) {
             pickedElectrons_.push_back(eleInd);
-            printDebug("Electron " + std::to_string(eleInd) + " selected: pt = " +
-                       std::to_string(pt) + ", eta = " + std::to_string(eta));
+            FWK_DEBUG("[PickWqqe]", "Electron ", eleInd, " selected: pt = ",
+                       pt, ", eta = ", eta);
         } else {
-            printDebug("Electron " + std::to_string(eleInd) + " rejected: pt = " +
-                       std::to_string(pt) + ", eta = " + std::to_string(eta));
+            FWK_DEBUG("[PickWqqe]", "Electron ", eleInd, " rejected: pt = ",
+                       pt, ", eta = ", eta);
         }
     }
 
-    printDebug("Total Electrons Picked: " + std::to_string(pickedElectrons_.size()));
+    FWK_DEBUG("[PickWqqe]", "Total Electrons Picked: ", pickedElectrons_.size());
 }
 
 void PickWqqe::pickJets(const SkimTree& skimT, double minBJetDisc) {
@@ -75,7 +72,7 @@ void PickWqqe::pickJets(const SkimTree& skimT, double minBJetDisc) {
         
         if (pt < jetMinPt_)                 continue;
         if (std::abs(eta) > jetMaxEta_)     continue;
-        if (!pickJet_.passId(skimT, i, jetIdLabel_)) continue;
+        if (!pickJet_.passId(skimT, i, jetIdWp_)) continue;
 
         pickedJets_.push_back(i);
         if (skimT.Jet_btagDeepFlavB[i] > minBJetDisc)
@@ -26,6 +26,7 @@ void PickWqqm::loadConfig(const std::string& filename) {
     jetMinPt_         = cfg.getValue<double>({"jetMinPt"});
     jetMaxEta_        = cfg.getValue<double>({"jetMaxEta"});
     jetIdLabel_       = cfg.getValue<std::string>({"jetIdLabel"});
+    jetIdWp_ = PickJet::parseWorkingPoint(jetIdLabel_);
 
 }
 
@@ -60,7 +61,7 @@ void PickWqqm::pickJets(const SkimTree& skimT, double minBJetDisc) {
         
         if (pt < jetMinPt_)                 continue;
         if (std::abs(eta) > jetMaxEta_)     continue;
-        if (!pickJet_.passId(skimT, i, jetIdLabel_)) continue;
+        if (!pickJet_.passId(skimT, i, jetIdWp_)) continue;
 
         pickedJets_.push_back(i);
         if (skimT.Jet_btagDeepFlavB[i] > minBJetDisc)
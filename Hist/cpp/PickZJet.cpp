@@ -2,6 +2,7 @@
 
 #include "PickGuard.hpp"
 #include "ReadConfig.h"
+#include "fwk/LoggerService.h"
 #include "HelperDelta.hpp"
 
 #include <algorithm>
@@ -23,10 +24,6 @@ PickZJet::PickZJet(const GlobalFlag& globalFlags)
     validateConfig_();
 }
 
-void PickZJet::printDebug(const std::string& msg) const {
-    if (isDebug_) std::cout << "[PickZJet] " << msg << '\n';
-}
-
 void PickZJet::loadConfig(const std::string& filename) {
     ReadConfig config(filename);
 
@@ -41,6 +38,7 @@ void PickZJet::loadConfig(const std::string& filename) {
     maxEtaProbeJet_      = config.getValue<double>({"jetPick", "maxEtaProbe"});
     minDeltaRtoLepton_   = config.getValue<double>({"jetPick", "minDeltaRtoLepton"});
     jetIdLabel_          = config.getValue<std::string>({"jetPick", "jetIdLabel"});
+    jetIdWp_ = PickJet::parseWorkingPoint(jetIdLabel_);
     requiredJet_lepIdx1_ = config.getValue<int>({"jetPick", "requiredJet_lepIdx1"});
     requiredJet_lepIdx2_ = config.getValue<int>({"jetPick", "requiredJet_lepIdx2"});
 
@@ -102,38 +100,38 @@ std::vector<TLorentzVector> PickZJet::pickRecoZ(
     g.requireNonNull(lep_charge, "lep_charge");
 
     const std::size_t nLep = pickedLeptons.size();
-    printDebug("pickRecoZ: nLeptons = " + std::to_string(nLep));
+    FWK_DEBUG("[PickZJet]", "pickRecoZ: nLeptons = ", nLep);
 
     if (nLep < static_cast<std::size_t>(nLepMin_)) return outTags;
 
     if (nLep > static_cast<std::size_t>(nLepMax_)) {
-        printDebug("pickRecoZ: more than nLepMax -> veto event.");
+        FWK_DEBUG("[PickZJet]", "pickRecoZ: more than nLepMax -> veto event.");
         return outTags;
     }
 
     bool foundBest = false;
-    TLorentzVector bestP4;
+    P4 bestP4;
     double bestDiff = std::numeric_limits<double>::max();
 
     for (std::size_t a = 0; a < nLep; ++a) {
         const int idxA = pickedLeptons[a];
-        g.require(idxA >= 0, "NEG_INDEX", "negative lepton index in pickedLeptons: idx=" + std::to_string(idxA));
+        g.require(idxA >= 0, "NEG_INDEX", [&] { return "negative lepton index in pickedLeptons: idx=" + std::to_string(idxA); });
 
         for (std::size_t b = a + 1; b < nLep; ++b) {
             const int idxB = pickedLeptons[b];
-            g.require(idxB >= 0, "NEG_INDEX", "negative lepton index in pickedLeptons: idx=" + std::to_string(idxB));
+            g.require(idxB >= 0, "NEG_INDEX", [&] { return "negative lepton index in pickedLeptons: idx=" + std::to_string(idxB); });
 
             // Opposite-sign requirement (or reject 0-charge)
             if (lep_charge[idxA] * lep_charge[idxB] >= 0) continue;
 
-            const auto p4A = g.makeP4(lep_pt[idxA], lep_eta[idxA], lep_phi[idxA], lep_mass[idxA], "lepA");
-            const auto p4B = g.makeP4(lep_pt[idxB], lep_eta[idxB], lep_phi[idxB], lep_mass[idxB], "lepB");
+            const P4 p4A = g.makeKin(lep_pt[idxA], lep_eta[idxA], lep_phi[idxA], lep_mass[idxA], "lepA");
+            const P4 p4B = g.makeKin(lep_pt[idxB], lep_eta[idxB], lep_phi[idxB], lep_mass[idxB], "lepB");
 
-            const TLorentzVector p4Tag = p4A + p4B;
+            const P4 p4Tag = p4A + p4B;
 
-            const double mass = p4Tag.M();
-            const double pt   = p4Tag.Pt();
-            const double eta  = std::abs(p4Tag.Eta());
+            const double mass = p4Tag.m;
+            const double pt   = p4Tag.pt;
+            const double eta  = std::abs(p4Tag.eta);
             g.requireFinite(mass, "recoZ.mass");
             g.requireFinite(pt,   "recoZ.pt");
 
@@ -153,11 +151,11 @@ std::vector<TLorentzVector> PickZJet::pickRecoZ(
     }
 
     if (foundBest) {
-        outTags.push_back(bestP4);
-        printDebug("pickRecoZ: candidate mass=" + std::to_string(bestP4.M()) +
-                   " pt=" + std::to_string(bestP4.Pt()));
+        outTags.push_back(HelperP4::toTLorentzVector(bestP4));
+        FWK_DEBUG("[PickZJet]", "pickRecoZ: candidate mass=", bestP4.m,
+                   " pt=", bestP4.pt);
     } else {
-        printDebug("pickRecoZ: no valid OS pair in mass window.");
+        FWK_DEBUG("[PickZJet]", "pickRecoZ: no valid OS pair in mass window.");
     }
 
     // Contract: 0 or 1
@@ -179,9 +177,9 @@ std::vector<TLorentzVector> PickZJet::pickRecoJets(
 {
     PickGuard g("PickZJet::pickRecoJets");
 
-    printDebug("pickRecoJets: nJet=" + std::to_string(skimT.nJet));
+    FWK_DEBUG("[PickZJet]", "pickRecoJets: nJet=", skimT.nJet);
 
-    g.require(skimT.nJet >= 0, "NEG_NJET", "skimT.nJet is negative: " + std::to_string(skimT.nJet));
+    g.require(skimT.nJet >= 0, "NEG_NJET", [&] { return "skimT.nJet is negative: " + std::to_string(skimT.nJet); });
     g.requireNonNull(lep_eta, "lep_eta");
     g.requireNonNull(lep_phi, "lep_phi");
 
@@ -213,19 +211,17 @@ std::vector<TLorentzVector> PickZJet::pickRecoJets(
         g.requireFinite(phi, "Jet_phi");
         g.requireFinite(m,   "Jet_mass");
 
-        printDebug(
-            "Jet[" + std::to_string(i) + "]: "
-            "pt=" + std::to_string(pt) +
-            ", eta=" + std::to_string(eta) +
-            ", phi=" + std::to_string(phi)
+        FWK_DEBUG("[PickZJet]", "Jet[", i, "]: "
+            "pt=", pt,
+            ", eta=", eta,
+            ", phi=", phi
         );
 
 
 		if (pt < minPtJet_) {
-			printDebug(
-				"Jet[" + std::to_string(i) + "] FAIL minPt: "
-				"pt=" + std::to_string(pt) +
-				" < minPtJet=" + std::to_string(minPtJet_)
+			FWK_DEBUG("[PickZJet]", "Jet[", i, "] FAIL minPt: "
+				"pt=", pt,
+				" < minPtJet=", minPtJet_
 			);
 			continue;
 		}
@@ -236,19 +232,17 @@ std::vector<TLorentzVector> PickZJet::pickRecoJets(
             globalFlags_.getJetAlgo() == GlobalFlag::JetAlgo::AK4Puppi)
         {
 			if (jet_lepIdx1 && jet_lepIdx1[i] != requiredJet_lepIdx1_) {
-				printDebug(
-					"Jet[" + std::to_string(i) + "] FAIL lepIdx1: "
-					"jet_lepIdx1=" + std::to_string(jet_lepIdx1[i]) +
-					" required=" + std::to_string(requiredJet_lepIdx1_)
+				FWK_DEBUG("[PickZJet]", "Jet[", i, "] FAIL lepIdx1: "
+					"jet_lepIdx1=", jet_lepIdx1[i],
+					" required=", requiredJet_lepIdx1_
 				);
 				continue;
 			}
 
 			if (jet_lepIdx2 && jet_lepIdx2[i] != requiredJet_lepIdx2_) {
-				printDebug(
-					"Jet[" + std::to_string(i) + "] FAIL lepIdx2: "
-					"jet_lepIdx2=" + std::to_string(jet_lepIdx2[i]) +
-					" required=" + std::to_string(requiredJet_lepIdx2_)
+				FWK_DEBUG("[PickZJet]", "Jet[", i, "] FAIL lepIdx2: "
+					"jet_lepIdx2=", jet_lepIdx2[i],
+					" required=", requiredJet_lepIdx2_
 				);
 				continue;
 			}
@@ -257,7 +251,7 @@ std::vector<TLorentzVector> PickZJet::pickRecoJets(
         // ΔR to leptons
         double minDr = std::numeric_limits<double>::infinity();
         for (const int idxL : pickedLeptons) {
-            g.require(idxL >= 0, "NEG_INDEX", "negative lepton index in pickedLeptons(for dR): " + std::to_string(idxL));
+            g.require(idxL >= 0, "NEG_INDEX", [&] { return "negative lepton index in pickedLeptons(for dR): " + std::to_string(idxL); });
 
             const double dr = HelperDelta::DELTAR(phi, lep_phi[idxL], eta, lep_eta[idxL]);
             g.requireFinite(dr, "DeltaR(jet,lep)");
@@ -266,10 +260,9 @@ std::vector<TLorentzVector> PickZJet::pickRecoJets(
             if (minDr < minDeltaRtoLepton_) break;
         }
 		if (minDr < minDeltaRtoLepton_) {
-			printDebug(
-				"Jet[" + std::to_string(i) + "] FAIL ΔR: "
-				"minDr=" + std::to_string(minDr) +
-				" < minDeltaRtoLepton=" + std::to_string(minDeltaRtoLepton_)
+			FWK_DEBUG("[PickZJet]", "Jet[", i, "] FAIL ΔR: "
+				"minDr=", minDr,
+				" < minDeltaRtoLepton=", minDeltaRtoLepton_
 			);
 			continue;
 		}
@@ -278,14 +271,13 @@ std::vector<TLorentzVector> PickZJet::pickRecoJets(
         candIndices.push_back(i);
     }
 
-	printDebug("Selected candidate jets (by pt):");
+	FWK_DEBUG("[PickZJet]", "Selected candidate jets (by pt):");
 
 	for (size_t k = 0; k < candIndices.size(); ++k) {
 		const int idx = candIndices[k];
-		printDebug(
-			"  rank " + std::to_string(k) +
-			" -> Jet[" + std::to_string(idx) + "] "
-			"pt=" + std::to_string(skimT.Jet_pt[idx])
+		FWK_DEBUG("[PickZJet]", "  rank ", k,
+			" -> Jet[", idx, "] "
+			"pt=", skimT.Jet_pt[idx]
 		);
 	}
 
@@ -293,18 +285,18 @@ std::vector<TLorentzVector> PickZJet::pickRecoJets(
     if (!candIndices.empty())   iJet1 = candIndices[0];
     if (candIndices.size() > 1) iJet2 = candIndices[1];
 
-    printDebug("pickRecoJets: candidates iJet1=" + std::to_string(iJet1) +
-               " iJet2=" + std::to_string(iJet2));
+    FWK_DEBUG("[PickZJet]", "pickRecoJets: candidates iJet1=", iJet1,
+               " iJet2=", iJet2);
 
     // JetId + |eta| on leading jet (keep your physics choice)
-    if (iJet1 != -1 && !pickJet_.passId(skimT, iJet1, jetIdLabel_)) {
-        printDebug("pickRecoJets: iJet1 fails JetID");
+    if (iJet1 != -1 && !pickJet_.passId(skimT, iJet1, jetIdWp_)) {
+        FWK_DEBUG("[PickZJet]", "pickRecoJets: iJet1 fails JetID");
         iJet1 = -1;
     }
 
     if (globalFlags_.getJecDerivationLevel() == GlobalFlag::JecDerivationLevel::L3Residual) {
         if (iJet1 != -1 && std::abs(skimT.Jet_eta[iJet1]) > maxEtaProbeJet_) {
-            printDebug("pickRecoJets: iJet1 fails |eta| = "+std::to_string(skimT.Jet_eta[iJet1]));
+            FWK_DEBUG("[PickZJet]", "pickRecoJets: iJet1 fails |eta| = ", skimT.Jet_eta[iJet1]);
             iJet1 = -1;
         }
     }
@@ -313,20 +305,21 @@ std::vector<TLorentzVector> PickZJet::pickRecoJets(
     outJetIndices.push_back(iJet1);
     outJetIndices.push_back(iJet2);
 
-    TLorentzVector p4Jet1(0,0,0,0), p4Jet2(0,0,0,0), p4JetN(0,0,0,0);
+    P4 p4Jet1, p4Jet2;
+    P4Sum sumJetN;
 
     for (int i = 0; i < skimT.nJet; ++i) {
-        const auto p4J = g.makeP4(skimT.Jet_pt[i], skimT.Jet_eta[i],
+        const P4 p4J = g.makeKin(skimT.Jet_pt[i], skimT.Jet_eta[i],
                                  skimT.Jet_phi[i], skimT.Jet_mass[i], "jet");
 
         if (i == iJet1)      p4Jet1 = p4J;
         else if (i == iJet2) p4Jet2 = p4J;
-        else                 p4JetN += p4J;
+        else                 sumJetN.add(p4J);
     }
 
-    outJets.push_back(p4Jet1);
-    outJets.push_back(p4Jet2);
-    outJets.push_back(p4JetN);
+    outJets.push_back(HelperP4::toTLorentzVector(p4Jet1));
+    outJets.push_back(HelperP4::toTLorentzVector(p4Jet2));
+    outJets.push_back(HelperP4::toTLorentzVector(sumJetN.get()));
 
     // Contracts:
     g.requireSize(outJets.size(), 3, "outJets");
@@ -361,34 +354,36 @@ std::vector<TLorentzVector> PickZJet::pickGenZ(
     const std::size_t nLep = pickedGenLeptons.size();
     if (nLep < 2) return out;
 
+    const P4 recoZ = HelperP4::fromTLorentzVector(p4RecoZ);
+
     bool found = false;
-    TLorentzVector best;
+    P4 best;
     double bestScore = std::numeric_limits<double>::max();
 
     for (std::size_t a = 0; a < nLep; ++a) {
         const int ia = pickedGenLeptons[a];
-        g.require(ia >= 0, "NEG_INDEX", "negative gen lepton index in pickedGenLeptons: " + std::to_string(ia));
+        g.require(ia >= 0, "NEG_INDEX", [&] { return "negative gen lepton index in pickedGenLeptons: " + std::to_string(ia); });
 
         for (std::size_t b = a + 1; b < nLep; ++b) {
             const int ib = pickedGenLeptons[b];
-            g.require(ib >= 0, "NEG_INDEX", "negative gen lepton index in pickedGenLeptons: " + std::to_string(ib));
+            g.require(ib >= 0, "NEG_INDEX", [&] { return "negative gen lepton index in pickedGenLeptons: " + std::to_string(ib); });
 
             // Optional OS check using pdgId sign
             if (skimT.GenDressedLepton_pdgId[ia] * skimT.GenDressedLepton_pdgId[ib] > 0) continue;
 
-            const auto p4A = g.makeP4(skimT.GenDressedLepton_pt[ia],
+            const P4 p4A = g.makeKin(skimT.GenDressedLepton_pt[ia],
                                      skimT.GenDressedLepton_eta[ia],
                                      skimT.GenDressedLepton_phi[ia],
                                      skimT.GenDressedLepton_mass[ia], "genLepA");
-            const auto p4B = g.makeP4(skimT.GenDressedLepton_pt[ib],
+            const P4 p4B = g.makeKin(skimT.GenDressedLepton_pt[ib],
                                      skimT.GenDressedLepton_eta[ib],
                                      skimT.GenDressedLepton_phi[ib],
                                      skimT.GenDressedLepton_mass[ib], "genLepB");
 
-            const TLorentzVector p4Gen = p4A + p4B;
-            if(p4Gen.Pt() < minPtGenTag_) continue;
+            const P4 p4Gen = p4A + p4B;
+            if(p4Gen.pt < minPtGenTag_) continue;
 
-            const double dR = p4Gen.DeltaR(p4RecoZ);
+            const double dR = HelperDelta::DELTAR(p4Gen, recoZ);
             g.requireFinite(dR, "DeltaR(genZ,recoZ)");
             if (dR > maxDeltaRgenTag_) continue;
 
@@ -401,7 +396,7 @@ std::vector<TLorentzVector> PickZJet::pickGenZ(
         }
     }
 
-    if (found) out.push_back(best);
+    if (found) out.push_back(HelperP4::toTLorentzVector(best));
 
     // Contract: 0 or 1
     g.require(out.size() <= 1, "BAD_SIZE", "pickGenZ must return 0 or 1 TLV");
@@ -1,5 +1,6 @@
 #include "PickZeeJet.h"
 #include "ReadConfig.h"
+#include "fwk/LoggerService.h"
 #include "Helper.hpp"
 
 PickZeeJet::PickZeeJet(const GlobalFlag& globalFlags)
@@ -27,13 +28,9 @@ void PickZeeJet::loadConfig(const std::string& filename) {
     pdgIdGenEle_ = config.getValue<int>({"genElectronPick", "pdgId"});
 }
 
-void PickZeeJet::printDebug(const std::string& message) const {
-    if (isDebug_) std::cout << "[PickZeeJet] " << message << '\n';
-}
-
 void PickZeeJet::pickElectrons(const SkimTree& skimT) {
-    printDebug("pickElectrons: nElectron = " +
-               std::to_string(skimT.nElectron));
+    FWK_DEBUG("[PickZeeJet]", "pickElectrons: nElectron = ",
+               skimT.nElectron);
     pickedElectrons_.clear();
 
     // --------------------------------------------------
@@ -52,6 +49,7 @@ void PickZeeJet::pickElectrons(const SkimTree& skimT) {
     // --------------------------------------------------
     // Apply selection
     // --------------------------------------------------
+    skimT.require(SkimBranch::kElectron);
     for (int i = 0; i < skimT.nElectron; ++i) {
         double eta      = skimT.Electron_eta[i];
         double absEta   = std::abs(eta);
@@ -75,21 +73,21 @@ void PickZeeJet::pickElectrons(const SkimTree& skimT) {
 
         if (sel) {
             pickedElectrons_.push_back(i);
-            printDebug("Electron " + std::to_string(i) +
-                       (i == leadIdx ? " (LEAD)" : " (SUBLEAD)") +
-                       " selected, pt=" + std::to_string(pt) +
-                       ", eta=" + std::to_string(eta));
+            FWK_DEBUG("[PickZeeJet]", "Electron ", i,
+                       (i == leadIdx ? " (LEAD)" : " (SUBLEAD)"),
+                       " selected, pt=", pt,
+                       ", eta=", eta);
         } else {
-            printDebug("Electron " + std::to_string(i) +
-                       (i == leadIdx ? " (LEAD)" : " (SUBLEAD)") +
-                       " rejected, pt=" + std::to_string(pt) +
-                       ", eta=" + std::to_string(eta) +
-                       ", passId=" + std::to_string(passId));
+            FWK_DEBUG("[PickZeeJet]", "Electron ", i,
+                       (i == leadIdx ? " (LEAD)" : " (SUBLEAD)"),
+                       " rejected, pt=", pt,
+                       ", eta=", eta,
+                       ", passId=", passId);
         }
     }
 
-    printDebug("pickElectrons: total picked = " +
-               std::to_string(pickedElectrons_.size()));
+    FWK_DEBUG("[PickZeeJet]", "pickElectrons: total picked = ",
+               pickedElectrons_.size());
 }
 
 
@@ -102,10 +100,11 @@ void PickZeeJet::pickTags(const SkimTree& skimT) {
         skimT.Electron_mass,
         skimT.Electron_charge);
 
-    printDebug("pickTags: nTags = " + std::to_string(pickedTags_.size()));
+    FWK_DEBUG("[PickZeeJet]", "pickTags: nTags = ", pickedTags_.size());
 }
 
 void PickZeeJet::pickJets(const SkimTree& skimT, const TLorentzVector& p4Tag) {
+    skimT.require(SkimBranch::kJetLeptonIdx);
     pickedJetsP4_ = zJet_.pickRecoJets(
         skimT,
         pickedElectrons_,
@@ -115,23 +114,23 @@ void PickZeeJet::pickJets(const SkimTree& skimT, const TLorentzVector& p4Tag) {
         skimT.Jet_electronIdx2,
         pickedJetsIndex_);
 
-    printDebug("pickJets: iJet1=" + std::to_string(pickedJetsIndex_.at(0)) +
-               ", iJet2=" + std::to_string(pickedJetsIndex_.at(1)));
+    FWK_DEBUG("[PickZeeJet]", "pickJets: iJet1=", pickedJetsIndex_.at(0),
+               ", iJet2=", pickedJetsIndex_.at(1));
 }
 
 void PickZeeJet::pickGenElectrons(const SkimTree& skimT) {
     pickedGenElectrons_.clear();
-    printDebug("pickGenElectrons: nGenDressedLepton = " + std::to_string(skimT.nGenDressedLepton));
+    FWK_DEBUG("[PickZeeJet]", "pickGenElectrons: nGenDressedLepton = ", skimT.nGenDressedLepton);
 
     for (int i = 0; i < skimT.nGenDressedLepton; ++i) {
         if (std::abs(skimT.GenDressedLepton_pdgId[i]) == pdgIdGenEle_) {
             pickedGenElectrons_.push_back(i);
-            printDebug("Gen electron " + std::to_string(i) + " picked");
+            FWK_DEBUG("[PickZeeJet]", "Gen electron ", i, " picked");
         }
     }
 
-    printDebug("pickGenElectrons: total picked = " +
-               std::to_string(pickedGenElectrons_.size()));
+    FWK_DEBUG("[PickZeeJet]", "pickGenElectrons: total picked = ",
+               pickedGenElectrons_.size());
 }
 
 void PickZeeJet::pickGenTags(const SkimTree& skimT, const TLorentzVector& p4Tag) {
@@ -141,6 +140,6 @@ void PickZeeJet::pickGenTags(const SkimTree& skimT, const TLorentzVector& p4Tag)
     }
 
     pickedGenTags_ = zJet_.pickGenZ(skimT, p4Tag, pickedGenElectrons_);
-    printDebug("pickGenTags: nGenTags = " + std::to_string(pickedGenTags_.size()));
+    FWK_DEBUG("[PickZeeJet]", "pickGenTags: nGenTags = ", pickedGenTags_.size());
 }
 
@@ -1,5 +1,6 @@
 #include "PickZmmJet.h"
 #include "ReadConfig.h"
+#include "fwk/LoggerService.h"
 
 PickZmmJet::PickZmmJet(const GlobalFlag& globalFlags)
     : globalFlags_(globalFlags),
@@ -27,12 +28,8 @@ void PickZmmJet::loadConfig(const std::string& filename) {
     pdgIdGenMu_ = config.getValue<int>({"genMuonPick", "pdgId"});
 }
 
-void PickZmmJet::printDebug(const std::string& message) const {
-    if (isDebug_) std::cout << "[PickZmmJet] " << message << '\n';
-}
-
 void PickZmmJet::pickMuons(const SkimTree& skimT) {
-    printDebug("pickMuons: nMuon = " + std::to_string(skimT.nMuon));
+    FWK_DEBUG("[PickZmmJet]", "pickMuons: nMuon = ", skimT.nMuon);
     pickedMuons_.clear();
 
     // --------------------------------------------------
@@ -68,20 +65,20 @@ void PickZmmJet::pickMuons(const SkimTree& skimT) {
 
         if (sel) {
             pickedMuons_.push_back(i);
-            printDebug("Muon " + std::to_string(i) +
-                       (i == leadIdx ? " (LEAD)" : " (SUBLEAD)") +
-                       " selected, pt=" + std::to_string(pt) +
-                       ", eta=" + std::to_string(eta));
+            FWK_DEBUG("[PickZmmJet]", "Muon ", i,
+                       (i == leadIdx ? " (LEAD)" : " (SUBLEAD)"),
+                       " selected, pt=", pt,
+                       ", eta=", eta);
         } else {
-            printDebug("Muon " + std::to_string(i) +
-                       (i == leadIdx ? " (LEAD)" : " (SUBLEAD)") +
-                       " rejected, pt=" + std::to_string(pt) +
-                       ", eta=" + std::to_string(eta));
+            FWK_DEBUG("[PickZmmJet]", "Muon ", i,
+                       (i == leadIdx ? " (LEAD)" : " (SUBLEAD)"),
+                       " rejected, pt=", pt,
+                       ", eta=", eta);
         }
     }
 
-    printDebug("pickMuons: total picked = " +
-               std::to_string(pickedMuons_.size()));
+    FWK_DEBUG("[PickZmmJet]", "pickMuons: total picked = ",
+               pickedMuons_.size());
 }
 
 
@@ -94,10 +91,11 @@ void PickZmmJet::pickTags(const SkimTree& skimT) {
         skimT.Muon_mass,
         skimT.Muon_charge);
 
-    printDebug("pickTags: nTags = " + std::to_string(pickedTags_.size()));
+    FWK_DEBUG("[PickZmmJet]", "pickTags: nTags = ", pickedTags_.size());
 }
 
 void PickZmmJet::pickJets(const SkimTree& skimT, const TLorentzVector& p4Tag) {
+    skimT.require(SkimBranch::kJetLeptonIdx);
     pickedJetsP4_ = zJet_.pickRecoJets(
         skimT,
         pickedMuons_,
@@ -107,23 +105,23 @@ void PickZmmJet::pickJets(const SkimTree& skimT, const TLorentzVector& p4Tag) {
         skimT.Jet_muonIdx2,
         pickedJetsIndex_);
 
-    printDebug("pickJets: iJet1=" + std::to_string(pickedJetsIndex_.at(0)) +
-               ", iJet2=" + std::to_string(pickedJetsIndex_.at(1)));
+    FWK_DEBUG("[PickZmmJet]", "pickJets: iJet1=", pickedJetsIndex_.at(0),
+               ", iJet2=", pickedJetsIndex_.at(1));
 }
 
 void PickZmmJet::pickGenMuons(const SkimTree& skimT) {
     pickedGenMuons_.clear();
-    printDebug("pickGenMuons: nGenDressedLepton = " + std::to_string(skimT.nGenDressedLepton));
+    FWK_DEBUG("[PickZmmJet]", "pickGenMuons: nGenDressedLepton = ", skimT.nGenDressedLepton);
 
     for (int i = 0; i < skimT.nGenDressedLepton; ++i) {
         if (std::abs(skimT.GenDressedLepton_pdgId[i]) == pdgIdGenMu_) {
             pickedGenMuons_.push_back(i);
-            printDebug("Gen muon " + std::to_string(i) + " picked");
+            FWK_DEBUG("[PickZmmJet]", "Gen muon ", i, " picked");
         }
     }
 
-    printDebug("pickGenMuons: total picked = " +
-               std::to_string(pickedGenMuons_.size()));
+    FWK_DEBUG("[PickZmmJet]", "pickGenMuons: total picked = ",
+               pickedGenMuons_.size());
 }
 
 void PickZmmJet::pickGenTags(const SkimTree& skimT, const TLorentzVector& p4Tag) {
@@ -133,6 +131,6 @@ void PickZmmJet::pickGenTags(const SkimTree& skimT, const TLorentzVector& p4Tag)
     }
 
     pickedGenTags_ = zJet_.pickGenZ(skimT, p4Tag, pickedGenMuons_);
-    printDebug("pickGenTags: nGenTags = " + std::to_string(pickedGenTags_.size()));
+    FWK_DEBUG("[PickZmmJet]", "pickGenTags: nGenTags = ", pickedGenTags_.size());
 }
 
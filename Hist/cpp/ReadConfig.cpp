@@ -1,12 +1,11 @@
 #include "ReadConfig.h"
-#include <fstream>
+#include "ResourceCache.h"
 #include <stdexcept>
 
 ReadConfig::ReadConfig(const std::string& filename) : filename_(filename) {
-    std::ifstream configFile(filename);
-    if (!configFile.is_open()){
+    try {
+        config_ = ResourceCache::json(filename);
+    } catch (const std::runtime_error&) {
         throw std::runtime_error("Could not open configuration file: " + filename);
     }
-    configFile >> config_;
 }
-
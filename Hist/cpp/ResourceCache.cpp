@@ -0,0 +1,76 @@
+#include "ResourceCache.h"
+
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+
+struct CacheState {
+    std::mutex mtx;
+    std::unordered_map<std::string, std::shared_ptr<const correction::CorrectionSet>> csets;
+    std::unordered_map<std::string, std::shared_ptr<const nlohmann::json>> jsons;
+    long long hits = 0;
+    long long misses = 0;
+};
+
+CacheState& state() {
+    static CacheState s;
+    return s;
+}
+
+} // namespace
+
+std::shared_ptr<const correction::CorrectionSet> ResourceCache::correctionSet(const std::string& path) {
+    auto& s = state();
+    std::lock_guard<std::mutex> lock(s.mtx);
+
+    auto it = s.csets.find(path);
+    if (it != s.csets.end()) {
+        ++s.hits;
+        return it->second;
+    }
+    ++s.misses;
+    std::shared_ptr<const correction::CorrectionSet> cset = correction::CorrectionSet::from_file(path);
+    s.csets.emplace(path, cset);
+    return cset;
+}
+
+std::shared_ptr<const nlohmann::json> ResourceCache::json(const std::string& path) {
+    auto& s = state();
+    std::lock_guard<std::mutex> lock(s.mtx);
+
+    auto it = s.jsons.find(path);
+    if (it != s.jsons.end()) {
+        ++s.hits;
+        return it->second;
+    }
+    ++s.misses;
+
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::runtime_error("ResourceCache::json - cannot open " + path);
+    }
+    auto js = std::make_shared<nlohmann::json>(nlohmann::json::parse(file));
+    s.jsons.emplace(path, js);
+    return js;
+}
+
+void ResourceCache::clear() {
+    auto& s = state();
+    std::lock_guard<std::mutex> lock(s.mtx);
+    s.csets.clear();
+    s.jsons.clear();
+    s.hits = 0;
+    s.misses = 0;
+}
+
+void ResourceCache::printStats(std::ostream& os) {
+    auto& s = state();
+    std::lock_guard<std::mutex> lock(s.mtx);
+    os << "[ResourceCache] " << s.csets.size() << " correction sets, "
+       << s.jsons.size() << " JSON files; hits=" << s.hits
+       << " misses=" << s.misses << '\n';
+}
@@ -76,18 +76,18 @@ auto RunL2ResidualDiJet::Run(std::shared_ptr<SkimTree>& skimT,
 
 
     Hlt hlt(globalFlags_);
-    const auto& hlts = hlt.getTrigMapRangePtEta();
-    std::map<std::string, std::unique_ptr<HistL2Residual>> mapHistL2Residual;
+    const auto& trigNames = hlt.getTrigNames();
+    const auto& hltLumiWeights = hlt.getHltLumiWeights();
+    // indexed by Hlt trigger id
+    std::vector<std::unique_ptr<HistL2Residual>> histL2ResidualPerHlt;
     if (fillPerHlt_) {
-        for (auto const& [trigName, r] : hlts) {
-            // ✔ construct the object with make_unique
-            auto hMJ = std::make_unique<HistL2Residual>(
+        histL2ResidualPerHlt.reserve(trigNames.size());
+        for (const auto& trigName : trigNames) {
+            histL2ResidualPerHlt.push_back(std::make_unique<HistL2Residual>(
                 origDir,
                 "passL2Residual/" + trigName,
                 varBin
-            );
-            // transfer ownership into the map
-            mapHistL2Residual[trigName] = std::move(hMJ);
+            ));
         }
     }
 
@@ -165,7 +165,7 @@ auto RunL2ResidualDiJet::Run(std::shared_ptr<SkimTree>& skimT,
         h1EventInCutflow->fill("passDeltaPhiTnP", weight);
 
         // MET & unclustered
-        scaleMet->applyCorrection(skimT, scaleJet->getJetPtRaw());
+        scaleMet->applyCorrection(skimT, scaleJet->getCorrectedJets());
         TLorentzVector p4CorrMet = scaleMet->getP4CorrectedMet();
         TLorentzVector p4SumTnP = p4Probe + p4Tag;
 
@@ -184,18 +184,11 @@ auto RunL2ResidualDiJet::Run(std::shared_ptr<SkimTree>& skimT,
         //------------------------------------
         // 3) Fill HistL2Residual per HLT
         //------------------------------------
-        auto passedHlts = pickEvent->getPassedHlts();
-
         if(fillPerHlt_){
-            for (const auto& trigPair : hlts) {
-                const auto& trigName = trigPair.first;
-                if (std::find(passedHlts.begin(), passedHlts.end(), trigName) == passedHlts.end())
-                    continue;
-                double weightTemp = hlt.getHltLumiWeight(trigName);
-                histL2ResidualInput.weight    = weight*weightTemp;
-                auto* h = mapHistL2Residual[trigName].get();
-                h->fillHistos(histL2ResidualInput);
-            }
+            Hlt::forEachTrig(pickEvent->getPassedHltMask(), [&](std::size_t id) {
+                histL2ResidualInput.weight = weight*hltLumiWeights[id];
+                histL2ResidualPerHlt[id]->fillHistos(histL2ResidualInput);
+            });
         }
 
         // Jet veto map
@@ -215,11 +208,9 @@ auto RunL2ResidualDiJet::Run(std::shared_ptr<SkimTree>& skimT,
         histScaleJet.Fill(*scaleJet);
         histScaleMet.Fill(*scaleMet);
 
-        const std::string passedHltName = pickEvent->getPassedHlt();
-        weight *= hlt.getHltLumiWeight(passedHltName);
+        weight *= hltLumiWeights[pickEvent->getPassedHltId()];
         histL2ResidualInput.weight    = weight;
     
-        auto it = hlts.find(passedHltName);
         histL2Residual.fillHistos(histL2ResidualInput);
         histPfCompProbeInProbe.Fill(skimT.get(), iProbe, ptProbe, etaProbe, weight);
 
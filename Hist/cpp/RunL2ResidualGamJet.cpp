@@ -169,8 +169,7 @@ auto RunL2ResidualGamJet::Run(std::shared_ptr<SkimTree>& skimT,
         h1EventInCutflow->fill("passTagAndProbe");
 
         if (!pickEvent->passHltWithPt(skimT, ptTag)) continue; 
-        const std::string passedHltName = pickEvent->getPassedHlt();
-        weight *= hlt.getHltLumiWeight(passedHltName);
+        weight *= hlt.getHltLumiWeight(static_cast<std::size_t>(pickEvent->getPassedHltId()));
         histObjP4Tag.Fill(p4Tag, weight);
 
         h1EventInCutflow->fill("passHltWithPt", weight);
@@ -181,7 +180,7 @@ auto RunL2ResidualGamJet::Run(std::shared_ptr<SkimTree>& skimT,
         h1EventInCutflow->fill("passDeltaPhiTnP", weight);
 
         // MET & unclustered
-        scaleMet->applyCorrection(skimT, scaleJet->getJetPtRaw());
+        scaleMet->applyCorrection(skimT, scaleJet->getCorrectedJets());
         TLorentzVector p4CorrMet = scaleMet->getP4CorrectedMet();
         TLorentzVector p4SumTnP = p4Probe + p4Tag;
 
@@ -165,7 +165,7 @@ auto RunL2ResidualZeeJet::Run(std::shared_ptr<SkimTree>& skimT,
         h1EventInCutflow->fill("passDeltaPhiTnP", weight);
 
         // MET & unclustered
-        scaleMet->applyCorrection(skimT, scaleJet->getJetPtRaw());
+        scaleMet->applyCorrection(skimT, scaleJet->getCorrectedJets());
         TLorentzVector p4CorrMet = scaleMet->getP4CorrectedMet();
         TLorentzVector p4SumTnP = p4Probe + p4Tag;
 
@@ -160,8 +160,7 @@ auto RunL3ResidualGamJet::Run(std::shared_ptr<SkimTree>& skimT, ScaleEvent* scal
         p4RawTag = p4Tag;
 
         if (!pickEvent->passHltWithPt(skimT, ptTag)) continue; 
-        const std::string passedHltName = pickEvent->getPassedHlt();
-        weight *= hlt.getHltLumiWeight(passedHltName);
+        weight *= hlt.getHltLumiWeight(static_cast<std::size_t>(pickEvent->getPassedHltId()));
         h1EventInCutflow->fill("passHltWithPt", weight);
 
         auto catPhoton = categorizePhoton->categorize(*skimT, pickedPhotons.at(0));
@@ -213,7 +212,7 @@ auto RunL3ResidualGamJet::Run(std::shared_ptr<SkimTree>& skimT, ScaleEvent* scal
         //------------------------------------------------
         // Correct and select MET 
         //------------------------------------------------
-        scaleMet->applyCorrection(skimT, scaleJet->getJetPtRaw());
+        scaleMet->applyCorrection(skimT, scaleJet->getCorrectedJets());
         p4CorrMet = scaleMet->getP4CorrectedMet();
         // Replace PF Tag with Reco Tag
         p4CorrMet += p4RawTag - p4Tag; 
@@ -269,6 +268,7 @@ auto RunL3ResidualGamJet::Run(std::shared_ptr<SkimTree>& skimT, ScaleEvent* scal
                                 *skimT, iProbe, iJet2, p4Probe, p4Jet2);
             double ptGenProbe =  pickedGenJets.p4GenJet1.Pt();
             double etaGenProbe =  pickedGenJets.p4GenJet1.Eta();
+            skimT->require(SkimBranch::kJetGen);
             histFlavorProbe.Fill(ptProbe, skimT->Jet_partonFlavour[iProbe], weight);
             histObjGenReco_Tag.Fill(p4GenTag.Pt(), ptTag, weight);
             histObjGenReco_Probe.Fill(ptGenProbe, ptProbe,weight);
@@ -215,7 +215,7 @@ auto RunL3ResidualGamJetFake::Run(std::shared_ptr<SkimTree>& skimT, ScaleEvent*
         //------------------------------------------------
         // Set MET vectors
         //------------------------------------------------
-        scaleMet->applyCorrection(skimT, scaleJet->getJetPtRaw());
+        scaleMet->applyCorrection(skimT, scaleJet->getCorrectedJets());
         p4CorrMet = scaleMet->getP4CorrectedMet();
 
         // Propagate the gen-reco difference to MET since we use gen from now onward
@@ -229,6 +229,7 @@ auto RunL3ResidualGamJetFake::Run(std::shared_ptr<SkimTree>& skimT, ScaleEvent*
                                                p4ProbeGenJet.Pt(), rawJetPts[iProbe], p4Probe.Pt(), 
                                                weight);
 
+        skimT->require(SkimBranch::kJetGen);
         histFlavor_TagRecoJetInTagGenJetPt.Fill(ptTagGenJet,  skimT->Jet_partonFlavour[iTag], weight);
         histFlavor_TagRecoJetInProbeGenJetPt.Fill(p4ProbeGenJet.Pt(),  skimT->Jet_partonFlavour[iTag], weight);
         histFlavor_ProbeRecoJetProbeGenJetPt.Fill(p4ProbeGenJet.Pt(),  skimT->Jet_partonFlavour[iProbe], weight);
@@ -16,13 +16,16 @@
 #include "Helper.hpp"
 #include "HelperDelta.hpp"
 #include "VarBin.h"
-#include "MathHdm.h"
+#include "HdmKernel.hpp"
+#include "MathGuard.hpp"
 #include "Hlt.h"
 
 #include <cassert>
 #include <cmath>
 #include <TMath.h>
 #include <chrono>
+#include <memory>
+#include <vector>
 
 // Constructor: load run‐level config
 RunL3ResidualMultiJet::RunL3ResidualMultiJet(const GlobalFlag& globalFlags)
@@ -69,15 +72,17 @@ auto RunL3ResidualMultiJet::Run(std::shared_ptr<SkimTree>& skimT,
 
 
     Hlt hlt(globalFlags_);
-    const auto& hlts = hlt.getTrigMapRangePtEta();
-    std::map<std::string, HistMultiJet*> mapHistMultiJet;
+    const auto& trigNames = hlt.getTrigNames();
+    const auto& trigRanges = hlt.getTrigRangesPtEta();
+    const auto& hltLumiWeights = hlt.getHltLumiWeights();
+    // indexed by Hlt trigger id
+    std::vector<std::unique_ptr<HistMultiJet>> histMultiJetPerHlt;
     if(fillPerHlt_){
-        for (const auto& trigPair : hlts) {
-            const auto& trigName = trigPair.first;
-            const auto& r        = trigPair.second;
-            auto* hMJ = new HistMultiJet(origDir, "passMultiJet/"+trigName, varBin);
-            hMJ->trigPt = r.trigPt;
-            mapHistMultiJet[trigName] = hMJ;
+        histMultiJetPerHlt.reserve(trigNames.size());
+        for (std::size_t id = 0; id < trigNames.size(); ++id) {
+            auto hMJ = std::make_unique<HistMultiJet>(origDir, "passMultiJet/"+trigNames[id], varBin);
+            hMJ->trigPt = trigRanges[id].trigPt;
+            histMultiJetPerHlt.push_back(std::move(hMJ));
         }
     }
 
@@ -86,7 +91,6 @@ auto RunL3ResidualMultiJet::Run(std::shared_ptr<SkimTree>& skimT,
     auto scaleJet  = std::make_shared<ScaleJet>(globalFlags_);
     auto scaleMet  = std::make_shared<ScaleMet>(globalFlags_);
     auto hemVeto = std::make_shared<HemVeto>(globalFlags_);
-    MathHdm mathHdm(globalFlags_);
 
     // timing & progress
     double totalTime = 0.0;
@@ -115,7 +119,6 @@ auto RunL3ResidualMultiJet::Run(std::shared_ptr<SkimTree>& skimT,
         if (!pickEvent->passGoodLumi(skimT->run, skimT->luminosityBlock)) continue; 
         h1EventInCutflow->fill("passGoodLumi", weight);
 
-        auto passedHlts = pickEvent->getPassedHlts();
         bool isHemVeto = hemVeto->isHemVeto(*skimT);
         if(isHemVeto){
             if(globalFlags_.isData()) continue;
@@ -164,12 +167,11 @@ auto RunL3ResidualMultiJet::Run(std::shared_ptr<SkimTree>& skimT,
         //------------------------------------
         // Compute inputs for histograms
         //------------------------------------
-        // Bisector axis
-        auto p4Bisector = mathHdm.buildUnitAxisForBisector(p4Tag, p4Probe);
-        double ptAvgProj = 0.5 * (
-            p4Tag.Vect().Dot(p4Bisector.Vect())
-          - p4Probe.Vect().Dot(p4Bisector.Vect())
-        );
+        // Bisector axis (transverse plane)
+        const P2 tagT   = P2::of(p4Tag);
+        const P2 probeT = P2::of(p4Probe);
+        const P2 bisector = HdmKernel::bisectorAxis(tagT, probeT);
+        double ptAvgProj = 0.5 * (tagT.dot(bisector) - probeT.dot(bisector));
 
         double ptTag  = p4Tag.Pt();
         double ptAverage = 0.5 * (ptProbe + ptTag);
@@ -199,10 +201,10 @@ auto RunL3ResidualMultiJet::Run(std::shared_ptr<SkimTree>& skimT,
         double cRecoil = std::exp(logCrecoil);
         
         // MET & unclustered
-        scaleMet->applyCorrection(skimT, scaleJet->getJetPtRaw());
+        scaleMet->applyCorrection(skimT, scaleJet->getCorrectedJets());
         TLorentzVector p4CorrMet = scaleMet->getP4CorrectedMet();
-        TLorentzVector p4SumProbeAndRecoil = p4Probe + p4Tag;
-        TLorentzVector p4Unclustered = -(p4CorrMet + p4SumProbeAndRecoil + p4SumOther);
+        const P2 metT   = P2::of(p4CorrMet);
+        const P2 otherT = P2::of(p4SumOther);
 
         // Fill inputs struct
         HistMultiJetInputs fillInputs;
@@ -211,7 +213,7 @@ auto RunL3ResidualMultiJet::Run(std::shared_ptr<SkimTree>& skimT,
         fillInputs.ptProbe    = ptProbe;
         fillInputs.ptMet     = p4CorrMet.Pt();
         fillInputs.ptOther   = p4SumOther.Pt();
-        fillInputs.ptUnclustered = p4Unclustered.Pt();
+        fillInputs.ptUnclustered = (metT + tagT + probeT + otherT).pt();
         fillInputs.etaProbe   = p4Probe.Eta();
         fillInputs.phiProbe   = p4Probe.Phi();
         fillInputs.ptRecoil  = ptTag;
@@ -219,57 +221,43 @@ auto RunL3ResidualMultiJet::Run(std::shared_ptr<SkimTree>& skimT,
         fillInputs.cRecoil   = cRecoil;
         fillInputs.mjbResp  = ptProbe/ptTag;
 
-        p4CorrMet.SetPtEtaPhiM(p4CorrMet.Pt(), 0., p4CorrMet.Phi(), 0.);
-        p4SumProbeAndRecoil.SetPtEtaPhiM(p4SumProbeAndRecoil.Pt(), 0., p4SumProbeAndRecoil.Phi(), 0.);
-        p4Probe.SetPtEtaPhiM(p4Probe.Pt(), 0., p4Probe.Phi(), 0.);
-        p4Tag.SetPtEtaPhiM(p4Tag.Pt(), 0., p4Tag.Phi(), 0.);
-        p4SumOther.SetPtEtaPhiM(p4SumOther.Pt(), 0., p4SumOther.Phi(), 0.);
-
-        // MPF responses
-        double one = 1.0, zero = 0.0;
-        fillInputs.m0b = mathHdm.mpfResponse(p4CorrMet,       p4Bisector, ptAvgProj, one);
-        fillInputs.mlrb = mathHdm.mpfResponse(p4SumProbeAndRecoil, p4Bisector, ptAvgProj, one);
-        fillInputs.mlb = mathHdm.mpfResponse(-p4Probe, p4Bisector, ptAvgProj, zero);
-        fillInputs.mrb = mathHdm.mpfResponse(p4Tag, p4Bisector, ptAvgProj, zero);
-        fillInputs.mnb = mathHdm.mpfResponse(p4SumOther,      p4Bisector, ptAvgProj, zero);
-        fillInputs.mub = mathHdm.mpfResponse(p4Unclustered,   p4Bisector, ptAvgProj, zero);
-
-        auto p4M = mathHdm.buildUnitAxis(-p4Probe, p4Tag);
-        fillInputs.m0m = mathHdm.mpfResponse(p4CorrMet,       p4M, ptAverage, one);
-        fillInputs.mlrm = mathHdm.mpfResponse(p4SumProbeAndRecoil, p4M, ptAverage, one);
-        fillInputs.mlm = mathHdm.mpfResponse(-p4Probe, p4M, ptAverage, zero);
-        fillInputs.mrm = mathHdm.mpfResponse(p4Tag, p4M, ptAverage, zero);
-        fillInputs.mnm = mathHdm.mpfResponse(p4SumOther,      p4M, ptAverage, zero);
-        fillInputs.mum = mathHdm.mpfResponse(p4Unclustered,   p4M, ptAverage, zero);
-
-        auto p4L = mathHdm.buildUnitAxis(-p4Probe, TLorentzVector());
-        fillInputs.m0l = mathHdm.mpfResponse(p4CorrMet,     p4L, ptProbe, one);
-        fillInputs.mlrl = mathHdm.mpfResponse(p4SumProbeAndRecoil, p4L, ptProbe, one);
-        fillInputs.mll = mathHdm.mpfResponse(-p4Probe, p4L, ptProbe, zero);
-        fillInputs.mrl = mathHdm.mpfResponse(p4Tag, p4L, ptProbe, zero);
-        fillInputs.mnl = mathHdm.mpfResponse(p4SumOther,    p4L, ptProbe, zero);
-        fillInputs.mul = mathHdm.mpfResponse(p4Unclustered, p4L, ptProbe, zero);
-
-        auto p4R = mathHdm.buildUnitAxis(p4Tag, TLorentzVector());
-        fillInputs.m0r = mathHdm.mpfResponse(p4CorrMet,     p4R, ptTag, one);
-        fillInputs.mlrr = mathHdm.mpfResponse(p4SumProbeAndRecoil, p4R, ptTag, one);
-        fillInputs.mlr = mathHdm.mpfResponse(-p4Probe, p4R, ptTag, zero);
-        fillInputs.mrr = mathHdm.mpfResponse(p4Tag, p4R, ptTag, zero);
-        fillInputs.mnr = mathHdm.mpfResponse(p4SumOther,    p4R, ptTag, zero);
-        fillInputs.mur = mathHdm.mpfResponse(p4Unclustered, p4R, ptTag, zero);
+        // MPF responses on the bisector (b), mean (m), probe (l) and tag (r) axes
+        // unitAxis/bisectorAxis return {0, 0} for a vanishing axis, which would give m0 = 1
+        const P2 meanAxis  = HdmKernel::unitAxis(-probeT, tagT);
+        const P2 probeAxis = HdmKernel::unitAxis(-probeT, P2{});
+        const P2 tagAxis   = HdmKernel::unitAxis(tagT, P2{});
+        MathGuard g("RunL3ResidualMultiJet", "mpfResponses", globalFlags_.isDebug());
+        g.requireAbsNotSmall(bisector.norm2(),  "|bisector|^2");
+        g.requireAbsNotSmall(meanAxis.norm2(),  "|mean axis|^2");
+        g.requireAbsNotSmall(probeAxis.norm2(), "|probe axis|^2");
+        g.requireAbsNotSmall(tagAxis.norm2(),   "|tag axis|^2");
+        g.requireDenNotSmall(ptAvgProj, "ptAvgProj");
+        g.requireDenNotSmall(ptAverage, "ptAverage");
+        g.requireDenNotSmall(ptProbe,   "ptProbe");
+        g.requireDenNotSmall(ptTag,     "ptTag");
+        const auto fill = [&](const P2& axis, double scale,
+                              double& m0, double& mlr, double& ml, double& mr, double& mn, double& mu) {
+            const AxisResponses r = HdmKernel::project(axis, scale, metT, tagT, probeT, otherT);
+            m0 = r.met; mlr = r.sumTnP; ml = r.probe; mr = r.tag; mn = r.other; mu = r.unclustered;
+        };
+        fill(bisector, ptAvgProj,
+             fillInputs.m0b, fillInputs.mlrb, fillInputs.mlb, fillInputs.mrb, fillInputs.mnb, fillInputs.mub);
+        fill(meanAxis, ptAverage,
+             fillInputs.m0m, fillInputs.mlrm, fillInputs.mlm, fillInputs.mrm, fillInputs.mnm, fillInputs.mum);
+        fill(probeAxis, ptProbe,
+             fillInputs.m0l, fillInputs.mlrl, fillInputs.mll, fillInputs.mrl, fillInputs.mnl, fillInputs.mul);
+        fill(tagAxis, ptTag,
+             fillInputs.m0r, fillInputs.mlrr, fillInputs.mlr, fillInputs.mrr, fillInputs.mnr, fillInputs.mur);
         fillInputs.weight    = weight;
 
         //------------------------------------
         // 3) Fill HistMultiJet per HLT
         //------------------------------------
         if(fillPerHlt_){
-            for (const auto& trigPair : hlts) {
-                const auto& trigName = trigPair.first;
-                if (std::find(passedHlts.begin(), passedHlts.end(), trigName) == passedHlts.end())
-                    continue;
-                double weightTemp = hlt.getHltLumiWeight(trigName);
+            Hlt::forEachTrig(pickEvent->getPassedHltMask(), [&](std::size_t id) {
+                const double weightTemp = hltLumiWeights[id];
                 fillInputs.weight    = weight*weightTemp;
-                auto* h = mapHistMultiJet[trigName];
+                auto* h = histMultiJetPerHlt[id].get();
                 h->setInputs(fillInputs);
                 for (size_t i = 0; i < recoilIndices.size(); ++i) {
                     h->fillJetLevelHistos(
@@ -277,7 +265,7 @@ auto RunL3ResidualMultiJet::Run(std::shared_ptr<SkimTree>& skimT,
                     );
                 }
                 h->fillEventLevelHistos(skimT.get(), iProbe, h->trigPt);
-            }
+            });
         }
 
         //------------------------------------
@@ -286,8 +274,8 @@ auto RunL3ResidualMultiJet::Run(std::shared_ptr<SkimTree>& skimT,
         if (!pickEvent->passHltWithPtEta(skimT, ptProbe, p4Probe.Eta()))
             continue;
         h1EventInCutflow->fill("passMultiJet", weight);
-        const std::string passedHltName = pickEvent->getPassedHlt();
-        weight *= hlt.getHltLumiWeight(passedHltName);
+        const int passedHltId = pickEvent->getPassedHltId();
+        weight *= hltLumiWeights[passedHltId];
         fillInputs.weight    = weight;
     
         histMultiJet.setInputs(fillInputs);
@@ -297,12 +285,11 @@ auto RunL3ResidualMultiJet::Run(std::shared_ptr<SkimTree>& skimT,
                 skimT.get(), recoilIndices[i], weight * recoilFs[i]
             );
         }
-        double trigPt = 1.0;
-        auto it = hlts.find(passedHltName);
-        if (it != hlts.end()) trigPt = it->second.trigPt;
+        const double trigPt = trigRanges[passedHltId].trigPt;
         histMultiJet.fillEventLevelHistos(skimT.get(), iProbe, trigPt);
         //Flavor fractions
         if(globalFlags_.isMC()){
+            skimT->require(SkimBranch::kJetGen);
             histFlavorProbe.Fill(ptProbe, skimT->Jet_partonFlavour[iProbe], weight);
             for (int idx : recoilIndices) {
                 histFlavorRecoilJets.Fill(ptProbe, skimT->Jet_partonFlavour[idx], weight);
@@ -162,7 +162,7 @@ auto RunL3ResidualWqqe::Run(std::shared_ptr<SkimTree>& skimT,
             weight *= eleSFs.total;
         }   
 
-        scaleMet->applyCorrection(skimT, scaleJet->getJetPtRaw());
+        scaleMet->applyCorrection(skimT, scaleJet->getCorrectedJets());
         p4CorrMet = scaleMet->getP4CorrectedMet();
         if(p4CorrMet.Pt() < minMet_) continue;
         h1EventInCutflow->fill("passMinMet30", weight);
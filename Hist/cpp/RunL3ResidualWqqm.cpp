@@ -159,7 +159,7 @@ auto RunL3ResidualWqqm::Run(std::shared_ptr<SkimTree>& skimT,
             weight *= muSFs.total;
         }
 
-        scaleMet->applyCorrection(skimT, scaleJet->getJetPtRaw());
+        scaleMet->applyCorrection(skimT, scaleJet->getCorrectedJets());
         p4CorrMet = scaleMet->getP4CorrectedMet();
         if(p4CorrMet.Pt() < minMet_) continue;
         h1EventInCutflow->fill("passMinMet30", weight);
@@ -190,7 +190,7 @@ auto RunL3ResidualZeeJet::Run(std::shared_ptr<SkimTree>& skimT, ScaleEvent* scal
         //------------------------------------------------
         // Correct and select MET 
         //------------------------------------------------
-        scaleMet->applyCorrection(skimT, scaleJet->getJetPtRaw());
+        scaleMet->applyCorrection(skimT, scaleJet->getCorrectedJets());
         p4CorrMet = scaleMet->getP4CorrectedMet();
         // Replace PF Tag with Reco Tag
         p4CorrMet += p4RawTag - p4Tag; 
@@ -263,6 +263,7 @@ auto RunL3ResidualZeeJet::Run(std::shared_ptr<SkimTree>& skimT, ScaleEvent* scal
                                 *skimT, iProbe, iJet2, p4Probe, p4Jet2);
             double ptGenProbe =  pickedGenJets.p4GenJet1.Pt();
             double etaGenProbe =  pickedGenJets.p4GenJet1.Eta();
+            skimT->require(SkimBranch::kJetGen);
             histFlavorProbe.Fill(ptProbe, skimT->Jet_partonFlavour[iProbe], weight);
             histObjGenReco_Tag.Fill(p4GenTag.Pt(), ptTag, weight);
             histObjGenReco_Probe.Fill(ptGenProbe, ptProbe,weight);
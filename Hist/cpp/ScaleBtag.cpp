@@ -15,3 +15,9 @@ double ScaleBtag::getEventWeight(const SkimTree& skimT,
     return functions_.getEventWeight(skimT, jetIdx, syst, btagCut);
 }
 
+
+BtagEventWeights ScaleBtag::getEventWeights(const SkimTree& skimT,
+                                            const std::vector<int>& jetIdx,
+                                            double btagCut) const {
+    return functions_.getEventWeights(skimT, jetIdx, btagCut);
+}
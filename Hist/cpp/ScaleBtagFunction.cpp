@@ -3,6 +3,7 @@
 #include <iostream>
 #include <algorithm>
 #include <cmath>
+#include <stdexcept>
 
 #include "ScaleFunctionGuard.hpp"
 
@@ -10,6 +11,28 @@
 #include "TH2.h"
 #include "TAxis.h"
 
+namespace {
+const std::string kCentral = "central";
+const std::string kUp      = "up";
+const std::string kDown    = "down";
+
+// Bin edges of a TAxis (fixed or variable), nBins+1 entries.
+std::vector<double> axisEdges(const TAxis* ax) {
+    const int n = ax->GetNbins();
+    std::vector<double> edges(n + 1);
+    for (int i = 1; i <= n; ++i) edges[i - 1] = ax->GetBinLowEdge(i);
+    edges[n] = ax->GetBinUpEdge(n);
+    return edges;
+}
+
+// Index of the bin containing x, for x already clamped into [edges.front(), edges.back()).
+inline std::size_t findBin(const std::vector<double>& edges, double x) {
+    const auto it = std::upper_bound(edges.begin(), edges.end(), x);
+    const std::size_t i = static_cast<std::size_t>(it - edges.begin());
+    return (i == 0) ? 0 : std::min(i - 1, edges.size() - 2);
+}
+} // namespace
+
 ScaleBtagFunction::ScaleBtagFunction(const GlobalFlag& globalFlags)
     : loader_(globalFlags),
       globalFlags_(globalFlags),
@@ -17,90 +40,86 @@ ScaleBtagFunction::ScaleBtagFunction(const GlobalFlag& globalFlags)
       isData_(globalFlags_.isData()),
       isMC_(globalFlags_.isMC()) {}
 
-void ScaleBtagFunction::parseSyst(const std::string& syst, std::string& b_syst, std::string& l_syst) {
-    b_syst = "central";
-    l_syst = "central";
-    if      (syst == "b_up")   b_syst = "up";
-    else if (syst == "b_down") b_syst = "down";
-    else if (syst == "l_up")   l_syst = "up";
-    else if (syst == "l_down") l_syst = "down";
+double ScaleBtagFunction::clampInside_(double v, double lo, double hi_inclusive) {
+    const double hi = std::nextafter(hi_inclusive, lo);
+    return std::clamp(v, lo, hi);
 }
 
-double ScaleBtagFunction::clampInsideAxis_(const TAxis* ax, double x) {
-    const double xmin = ax->GetXmin();
-    const double xmax = ax->GetXmax();
-    const double hi   = std::nextafter(xmax, xmin);
-    return std::clamp(x, xmin, hi);
-}
+// ---------------- efficiency tables ----------------
 
-double ScaleBtagFunction::getBinContent2D_(const TH2* h2, double x, double y) {
-    const TAxis* axX = h2->GetXaxis();
-    const TAxis* axY = h2->GetYaxis();
-    const double xx = clampInsideAxis_(axX, x);
-    const double yy = clampInsideAxis_(axY, y);
-    const int binX = axX->FindBin(xx);
-    const int binY = axY->FindBin(yy);
-    return h2->GetBinContent(binX, binY);
-}
+void ScaleBtagFunction::EffTable::build(const TH2* h2) {
+    xEdges = axisEdges(h2->GetXaxis());
+    yEdges = axisEdges(h2->GetYaxis());
 
-double ScaleBtagFunction::clampInside_(double v, double lo, double hi_inclusive) {
-    const double hi = std::nextafter(hi_inclusive, lo);
-    return std::clamp(v, lo, hi);
+    const std::size_t nx = xEdges.size() - 1;
+    const std::size_t ny = yEdges.size() - 1;
+    content.assign(nx * ny, 0.0);
+
+    for (std::size_t iy = 0; iy < ny; ++iy) {
+        for (std::size_t ix = 0; ix < nx; ++ix) {
+            double e = h2->GetBinContent(static_cast<int>(ix + 1), static_cast<int>(iy + 1));
+            if (!std::isfinite(e)) e = 0.0;
+            content[iy * nx + ix] = std::clamp(e, 0.0, 1.0);
+        }
+    }
 }
 
-double ScaleBtagFunction::getPerJetEff_(int flavor, double pt, double abseta) const {
-    // loader guarantees lazy-load
-    const TH2* lEff = loader_.lEff();
-    const TH2* cEff = loader_.cEff();
-    const TH2* bEff = loader_.bEff();
-
-    double e = 0.0;
-    if (flavor == 5)      e = getBinContent2D_(bEff, pt, abseta);
-    else if (flavor == 4) e = getBinContent2D_(cEff, pt, abseta);
-    else                  e = getBinContent2D_(lEff, pt, abseta);
-
-    if (!std::isfinite(e)) e = 0.0;
-    if (e < 0.0) e = 0.0;
-    if (e > 1.0) e = 1.0;
-    return e;
+double ScaleBtagFunction::EffTable::lookup(double x, double y) const {
+    const double xx = clampInside_(x, xEdges.front(), xEdges.back());
+    const double yy = clampInside_(y, yEdges.front(), yEdges.back());
+    const std::size_t nx = xEdges.size() - 1;
+    return content[findBin(yEdges, yy) * nx + findBin(xEdges, xx)];
 }
 
-double ScaleBtagFunction::getPerJetSF_(int flavor, double pt, double eta,
-                                      const std::string& b_syst, const std::string& l_syst) const {
-    const std::string& sys = (flavor == 5 || flavor == 4) ? b_syst : l_syst;
+const ScaleBtagFunction::EffTable& ScaleBtagFunction::effTable_(int flavor) const {
+    if (flavor == 5) return effB_;
+    if (flavor == 4) return effC_;
+    return effL_;
+}
 
-    const double aeta_raw = std::abs(eta);
-    const double spt_raw  = pt;
+void ScaleBtagFunction::ensureTables_() const {
+    if (tablesReady_) return;
 
-    const double aeta = clampInside_(aeta_raw, 0.0, loader_.sfAbsEtaMax());
-    const double spt  = clampInside_(spt_raw,  loader_.sfPtMin(), loader_.sfPtMax());
+    // loader guarantees lazy-load (and reload after setEffType)
+    effB_.build(loader_.bEff());
+    effC_.build(loader_.cEff());
+    effL_.build(loader_.lEff());
+    tablesReady_ = true;
 
-    // Optional clamp notification (useful to catch systematic over-clamping)
-    {
-        ScaleFunctionGuard guard(globalFlags_, "ScaleBtagFunction::getPerJetSF_");
-        guard.noteClamp("|eta|", aeta_raw, aeta, "corrlib absEta range");
-        guard.noteClamp("pt",    spt_raw,  spt,  "corrlib pt range");
+    if (isDebug_) {
+        std::cout << "[ScaleBtagFunction] Flattened eff tables (" << loader_.effType() << "): "
+                  << "b " << effB_.content.size() << ", c " << effC_.content.size()
+                  << ", l " << effL_.content.size() << " bins\n";
     }
+}
+
+void ScaleBtagFunction::parseSyst_(const std::string& syst, std::string& bSyst, std::string& lSyst) {
+    bSyst = kCentral;
+    lSyst = kCentral;
+    if      (syst == "b_up")   bSyst = kUp;
+    else if (syst == "b_down") bSyst = kDown;
+    else if (syst == "l_up")   lSyst = kUp;
+    else if (syst == "l_down") lSyst = kDown;
+}
 
+// Inputs are clamped into the SF validity window; correctionlib may still
+// reject the upper edge (inclusive vs exclusive bin bounds differ between
+// payloads), so retry once one ulp further inside before falling back to 1.
+double ScaleBtagFunction::evaluateSf_(const correction::Correction::Ref& corr,
+                                      const std::string& sys, const JetIn& in) const {
+    const double aeta = in.sfAbsEta;
+    const double spt  = in.sfPt;
     try {
-        if (flavor == 5 || flavor == 4) {
-            return loader_.corrMujets()->evaluate({sys, loader_.wp(), flavor, aeta, spt});
-        } else {
-            return loader_.corrIncl()->evaluate({sys, loader_.wp(), flavor, aeta, spt});
-        }
+        return corr->evaluate({sys, loader_.wp(), in.flav, aeta, spt});
     } catch (const std::exception& e) {
         const double aeta2 = std::nextafter(aeta, 0.0);
         const double spt2  = std::nextafter(spt,  0.0);
         try {
-            if (flavor == 5 || flavor == 4) {
-                return loader_.corrMujets()->evaluate({sys, loader_.wp(), flavor, aeta2, spt2});
-            } else {
-                return loader_.corrIncl()->evaluate({sys, loader_.wp(), flavor, aeta2, spt2});
-            }
+            return corr->evaluate({sys, loader_.wp(), in.flav, aeta2, spt2});
         } catch (...) {
             if (isDebug_) {
                 std::cerr << "[ScaleBtagFunction] SF evaluate failed after clamp/retry: "
-                          << "flav=" << flavor << " |eta|=" << aeta << " pt=" << spt
+                          << "flav=" << in.flav << " |eta|=" << aeta << " pt=" << spt
                           << " sys=" << sys << " what=" << e.what() << '\n';
             }
             return 1.0;
@@ -108,83 +127,197 @@ double ScaleBtagFunction::getPerJetSF_(int flavor, double pt, double eta,
     }
 }
 
-double ScaleBtagFunction::getEventWeight(const SkimTree& skimT,
-                                        const std::vector<int>& jetIdx,
-                                        const std::string& syst,
-                                        double btagCut) const {
-    if (isData_) return 1.0;
-
-    ScaleFunctionGuard guard(globalFlags_, "ScaleBtagFunction::getEventWeight",
-                             skimT.run, skimT.luminosityBlock, skimT.event);
+// ---------------- event weights ----------------
 
-    std::string b_syst, l_syst;
-    parseSyst(syst, b_syst, l_syst);
+double ScaleBtagFunction::gatherJets_(const SkimTree& skimT,
+                                      const std::vector<int>& jetIdx,
+                                      double btagCut,
+                                      ScaleFunctionGuard& guard) const {
+    ensureTables_();
 
     const double defaultCut = (loader_.wpCut() >= 0.0 ? loader_.wpCut() : -1.0);
     const double cut = (btagCut >= 0.0 ? btagCut : defaultCut);
 
-    double pMC = 1.0;
-    double pData = 1.0;
+    heavy_.clear();
+    light_.clear();
 
+    double pMC = 1.0;
+    skimT.require(SkimBranch::kJetGen);
     for (int j : jetIdx) {
         guard.checkIndex("Jet", j);
 
-        const double pt     = skimT.Jet_pt[j];
-        const double eta    = skimT.Jet_eta[j];
-        const int    flav   = std::abs(skimT.Jet_hadronFlavour[j]);
-        const double score  = skimT.Jet_btagDeepFlavB[j];
+        JetIn in;
+        in.idx  = j;
+        in.pt   = skimT.Jet_pt[j];
+        in.eta  = skimT.Jet_eta[j];
+        in.flav = std::abs(skimT.Jet_hadronFlavour[j]);
+        const double score = skimT.Jet_btagDeepFlavB[j];
 
-        guard.checkPtEta(pt, eta, "jet_for_btag");
+        guard.checkPtEta(in.pt, in.eta, "jet_for_btag");
         guard.checkFinite("btagScore", score);
 
-        const double eff = getPerJetEff_(flav, pt, std::abs(eta));
-        const double SF  = getPerJetSF_(flav, pt, eta, b_syst, l_syst);
+        in.eff    = effTable_(in.flav).lookup(in.pt, std::abs(in.eta));
+        in.tagged = (cut < 0.0) ? (score > -1e9) : (score > cut);
 
-        guard.checkFinite("btagEff", eff);
-        guard.checkSf("btagEff", eff, 0.0, 1.0);
+        guard.checkFinite("btagEff", in.eff);
+        guard.checkSf("btagEff", in.eff, 0.0, 1.0);
 
-        guard.checkFinite("btagSF", SF);
-        guard.checkSf("btagSF", SF, 0.0, 5.0);
+        in.sfAbsEta = clampInside_(std::abs(in.eta), 0.0, loader_.sfAbsEtaMax());
+        in.sfPt     = clampInside_(in.pt, loader_.sfPtMin(), loader_.sfPtMax());
+        guard.noteClamp("|eta|", std::abs(in.eta), in.sfAbsEta, "corrlib absEta range");
+        guard.noteClamp("pt",    in.pt,            in.sfPt,     "corrlib pt range");
 
-        const bool tagged = (cut < 0.0) ? (score > -1e9) : (score > cut);
-
-        if (tagged) {
-            pMC   *= eff;
-            pData *= eff * SF;
-        } else {
-            pMC   *= (1.0 - eff);
-            pData *= (1.0 - eff * SF);
-        }
+        pMC *= in.tagged ? in.eff : (1.0 - in.eff);
 
-        if (isDebug_) {
-            std::cout << "[Btag] j=" << j
-                      << " pt=" << pt
-                      << " eta=" << eta
-                      << " flav=" << flav
-                      << " score=" << score
-                      << " tagged=" << tagged
-                      << " eff=" << eff
-                      << " SF=" << SF
-                      << " pMC=" << pMC
-                      << " pData=" << pData
-                      << '\n';
-        }
+        if (in.flav == 5 || in.flav == 4) heavy_.push_back(in);
+        else                              light_.push_back(in);
     }
+    return pMC;
+}
+
+// Data probability factor of one jet for the given SF
+static inline double dataFactor(bool tagged, double eff, double sf) {
+    return tagged ? eff * sf : (1.0 - eff * sf);
+}
 
+double ScaleBtagFunction::getEventWeight(const SkimTree& skimT,
+                                        const std::vector<int>& jetIdx,
+                                        const std::string& syst,
+                                        double btagCut) const {
+    if (isData_) return 1.0;
+
+    ScaleFunctionGuard guard(globalFlags_, "ScaleBtagFunction::getEventWeight",
+                             skimT.run, skimT.luminosityBlock, skimT.event);
+
+    std::string bSyst, lSyst;
+    parseSyst_(syst, bSyst, lSyst);
+
+    const double pMC = gatherJets_(skimT, jetIdx, btagCut, guard);
     if (!std::isfinite(pMC) || pMC == 0.0) {
         guard.warn("pMC is non-finite or zero; returning 1.0 to avoid blow-up");
         return 1.0;
     }
+
+    // One SF evaluation per jet: only the requested variation
+    double pData = 1.0;
+    auto runGroup = [&](const std::vector<JetIn>& jets,
+                        const correction::Correction::Ref& corr,
+                        const std::string& sys) {
+        for (const JetIn& in : jets) {
+            const double sf = evaluateSf_(corr, sys, in);
+            guard.checkFinite("btagSF", sf);
+            guard.checkSf("btagSF", sf, 0.0, 5.0);
+            pData *= dataFactor(in.tagged, in.eff, sf);
+
+            if (isDebug_) {
+                std::cout << "[Btag] j=" << in.idx
+                          << " pt=" << in.pt
+                          << " eta=" << in.eta
+                          << " flav=" << in.flav
+                          << " tagged=" << in.tagged
+                          << " eff=" << in.eff
+                          << " SF=" << sf
+                          << '\n';
+            }
+        }
+    };
+    runGroup(heavy_, loader_.corrMujets(), bSyst);
+    runGroup(light_, loader_.corrIncl(),   lSyst);
+
     if (!std::isfinite(pData)) {
         guard.warn("pData is non-finite; returning 1.0");
         return 1.0;
     }
-
-    const double w = (pData / pMC);
-
+    const double w = pData / pMC;
     guard.checkFinite("btagEventWeight", w);
     guard.checkSf("btagEventWeight", w, 0.0, 10.0);
 
+    if (isDebug_) {
+        std::cout << "[Btag] pMC=" << pMC << " pData=" << pData << " w=" << w << '\n';
+    }
     return w;
 }
 
+BtagEventWeights ScaleBtagFunction::getEventWeights(const SkimTree& skimT,
+                                                   const std::vector<int>& jetIdx,
+                                                   double btagCut) const {
+    BtagEventWeights out;
+    if (isData_) return out;
+
+    ScaleFunctionGuard guard(globalFlags_, "ScaleBtagFunction::getEventWeights",
+                             skimT.run, skimT.luminosityBlock, skimT.event);
+
+    const double pMC = gatherJets_(skimT, jetIdx, btagCut, guard);
+    if (!std::isfinite(pMC) || pMC == 0.0) {
+        guard.warn("pMC is non-finite or zero; returning 1.0 to avoid blow-up");
+        return out;
+    }
+
+    // Per flavour group: central/up/down data probabilities in one pass.
+    // Efficiencies do not depend on the variation, so the event weight
+    // factorises into (heavy product) x (light product) / pMC.
+    struct Products { double central{1.0}, up{1.0}, down{1.0}; };
+
+    auto runGroup = [&](const std::vector<JetIn>& jets,
+                        const correction::Correction::Ref& corr) {
+        Products p;
+        for (const JetIn& in : jets) {
+            // Every variation gets the same checks as the single-variation path
+            auto checkedSf = [&](const std::string& sys) {
+                const double sf = evaluateSf_(corr, sys, in);
+                guard.checkFinite("btagSF", sf);
+                guard.checkSf("btagSF", sf, 0.0, 5.0);
+                return sf;
+            };
+            const double sfC = checkedSf(kCentral);
+            const double sfU = checkedSf(kUp);
+            const double sfD = checkedSf(kDown);
+
+            p.central *= dataFactor(in.tagged, in.eff, sfC);
+            p.up      *= dataFactor(in.tagged, in.eff, sfU);
+            p.down    *= dataFactor(in.tagged, in.eff, sfD);
+
+            if (isDebug_) {
+                std::cout << "[Btag] j=" << in.idx
+                          << " pt=" << in.pt
+                          << " eta=" << in.eta
+                          << " flav=" << in.flav
+                          << " tagged=" << in.tagged
+                          << " eff=" << in.eff
+                          << " SF=" << sfC << " (up " << sfU << ", down " << sfD << ")"
+                          << '\n';
+            }
+        }
+        return p;
+    };
+
+    const Products heavy = runGroup(heavy_, loader_.corrMujets());
+    const Products light = runGroup(light_, loader_.corrIncl());
+
+    auto ratio = [&](double pData, const char* label) {
+        if (!std::isfinite(pData)) {
+            guard.warn("pData is non-finite; returning 1.0");
+            return 1.0;
+        }
+        const double w = pData / pMC;
+        guard.checkFinite(label, w);
+        guard.checkSf(label, w, 0.0, 10.0);
+        return w;
+    };
+
+    out.central = ratio(heavy.central * light.central, "btagEventWeight");
+    out.bUp     = ratio(heavy.up      * light.central, "btagEventWeight(b_up)");
+    out.bDown   = ratio(heavy.down    * light.central, "btagEventWeight(b_down)");
+    out.lUp     = ratio(heavy.central * light.up,      "btagEventWeight(l_up)");
+    out.lDown   = ratio(heavy.central * light.down,    "btagEventWeight(l_down)");
+
+    if (isDebug_) {
+        std::cout << "[Btag] pMC=" << pMC
+                  << " w=" << out.central
+                  << " b_up=" << out.bUp << " b_down=" << out.bDown
+                  << " l_up=" << out.lUp << " l_down=" << out.lDown
+                  << '\n';
+    }
+
+    return out;
+}
@@ -4,6 +4,7 @@
 #include <stdexcept>
 
 #include "ReadConfig.h"
+#include "ResourceCache.h"
 
 // ROOT
 #include "TFile.h"
@@ -59,7 +60,7 @@ void ScaleBtagLoader::loadConfig(const std::string& filename) {
 
 void ScaleBtagLoader::loadBtvRefs() {
     try {
-        btvSet_ = correction::CorrectionSet::from_file(btvJsonPath_);
+        btvSet_ = ResourceCache::correctionSet(btvJsonPath_);
         // names match your existing code
         corr_mujets_ = btvSet_->at("deepJet_mujets");
         corr_incl_   = btvSet_->at("deepJet_incl");
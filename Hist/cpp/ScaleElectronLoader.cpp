@@ -3,6 +3,7 @@
 #include <iostream>
 
 #include "ReadConfig.h"
+#include "ResourceCache.h"
 
 // ROOT
 #include "TFile.h"
@@ -86,7 +87,7 @@ void ScaleElectronLoader::loadEleSsRef() {
     if (hasEleSsRef_) return;
     std::cout<<"===> loadEleSsRef()"<<'\n';
     try {
-        loadedEleSsRef_ = correction::CorrectionSet::from_file(eleSsJsonPath_)->at(eleSsName_);
+        loadedEleSsRef_ = ResourceCache::correctionSet(eleSsJsonPath_)->at(eleSsName_);
         hasEleSsRef_ = true;
     } catch (const std::exception& e) {
         std::cout << "\nEXCEPTION: ScaleElectronLoader::loadEleSsRef()\n"
@@ -1,4 +1,5 @@
 #include "ScaleEvent.h"
+#include "ResourceCache.h"
 #include <stdexcept>
 #include <regex>
 
@@ -54,7 +55,7 @@ void ScaleEvent::loadPuRef() {
     std::cout << "==> ScaleEvent::loadPuRef()" << '\n';
     try {
         loadedPuRef_ =
-            correction::CorrectionSet::from_file(puJsonPath_)->at(puName_);
+            ResourceCache::correctionSet(puJsonPath_)->at(puName_);
     } catch (const std::exception& e) {
         std::cout << "\nEXCEPTION: ScaleEvent::loadPuRef()\n";
         std::cout << "Check " << puJsonPath_ << " or " << puName_ << '\n';
@@ -4,14 +4,21 @@
 
 ScaleJet::ScaleJet(const GlobalFlag& globalFlags)
     : functions_(globalFlags),
+      jetQuality_(globalFlags),
       globalFlags_(globalFlags),
-      level_(globalFlags_.getJecApplicationLevel()),
+      jecSteps_(JecStepsRuntime::of(globalFlags_)),
       isDebug_(globalFlags_.isDebug()),
       isData_(globalFlags_.isData()),
-      isBookKeep_(globalFlags_.isBookKeep()),
-      jetAlgo_(globalFlags_.getJetAlgo()),
-      applyJer_(globalFlags_.applyJer() && !isData_)
+      applyJer_(jecSteps_.jer())
 {
+    dispatchJecSteps(jecSteps_, [this](auto steps) {
+        correct_ = &ScaleJet::correctJetsAs_<decltype(steps)>;
+    });
+}
+
+template <class Steps>
+void ScaleJet::correctJetsAs_(SkimTree& skimT) {
+    correctJets_(skimT, jecStepsAs<Steps>(jecSteps_));
 }
 
 void ScaleJet::applyCorrection(std::shared_ptr<SkimTree>& skimT) {
@@ -22,30 +29,46 @@ void ScaleJet::applyCorrection(std::shared_ptr<SkimTree>& skimT) {
 
     if (isDebug_) std::cout << "\n[ScaleJet::applyCorrection]\n";
 
-    // reset per-event state
+    // reset per-event state; the view may still hold another target's jets
     p4MapJet1_.clear();
     p4MapJetSum_.clear();
-    jet_pt_raw_.assign(skimT->nJet, 0.0);
+    skimT->resetJetView();
+    if (isData_) functions_.selectRun(skimT->run);
+    jets_.reset(static_cast<int>(skimT->nJet));
+
+    (this->*correct_)(*skimT);
 
-    for (int i = 0; i < skimT->nJet; ++i) {
-        if (isDebug_) std::cout << "\n ===> Jet Index = " << i << "\n";
+    fillView_(*skimT);
+}
+
+template <class Steps>
+void ScaleJet::correctJets_(SkimTree& skimT, const Steps& steps) {
+    for (int i = 0; i < jets_.n; ++i) {
+        if (steps.debug()) std::cout << "\n ===> Jet Index = " << i << "\n";
 
-        const float pt_nano   = skimT->Jet_pt[i];
-        const float rawFactor = skimT->Jet_rawFactor[i];
-        if (isDebug_) std::cout << " pt_nano= " << pt_nano << '\n';
+        const float pt_nano   = skimT.Jet_ptNano[i];
+        const float rawFactor = skimT.Jet_rawFactor[i];
+        if (steps.debug()) std::cout << " pt_nano= " << pt_nano << '\n';
         const double pt_raw   = pt_nano * (1.f - rawFactor);
-        jet_pt_raw_[i] = pt_raw;
 
-        const float eta       = skimT->Jet_eta[i];
-        const float phi       = skimT->Jet_phi[i];
-        const float mass_nano = skimT->Jet_mass[i];
-        const float area      = skimT->Jet_area[i];
+        const float eta       = skimT.Jet_eta[i];
+        const float phi       = skimT.Jet_phi[i];
+        const float mass_nano = skimT.Jet_massNano[i];
+        const float area      = skimT.Jet_area[i];
         const double mass_raw = mass_nano * (1.f - rawFactor);
 
-        if(pt_raw < 10) continue;//FIXME
+        jets_.ptRaw[i]   = pt_raw;
+        jets_.massRaw[i] = mass_raw;
+
+        if(pt_raw < 10) { //FIXME
+            // left uncorrected, as before: keep the Nano values
+            jets_.pt[i]   = pt_nano;
+            jets_.mass[i] = mass_nano;
+            continue;
+        }
 
         // --- Book-keeping: Nano/Raw ---
-        if (isBookKeep_) {
+        if (steps.bookKeep()) {
             TLorentzVector p4Nano; p4Nano.SetPtEtaPhiM(pt_nano, eta, phi, mass_nano);
             TLorentzVector p4Raw;  p4Raw .SetPtEtaPhiM(pt_raw,  eta, phi, mass_raw);
             if (i == 0) {
@@ -60,12 +83,12 @@ void ScaleJet::applyCorrection(std::shared_ptr<SkimTree>& skimT) {
         double mass_corr = mass_raw;
 
         // L1 RC
-        if (level_ >= GlobalFlag::JecApplicationLevel::L1Rc && jetAlgo_ == GlobalFlag::JetAlgo::AK4Chs) {
-            const double c1 = functions_.getL1FastJetCorrection(area, eta, pt_corr, skimT->Rho);
+        if (steps.l1Rc()) {
+            const double c1 = functions_.getL1FastJetCorrection(area, eta, pt_corr, skimT.Rho);
             pt_corr   *= c1;
             mass_corr *= c1;
 
-            if (isBookKeep_) {
+            if (steps.bookKeep()) {
                 TLorentzVector t; t.SetPtEtaPhiM(pt_corr, eta, phi, mass_corr);
                 if (i == 0) p4MapJet1_["L1RcCorr"] += t;
                 p4MapJetSum_["L1RcCorr"] += t;
@@ -73,12 +96,12 @@ void ScaleJet::applyCorrection(std::shared_ptr<SkimTree>& skimT) {
         }
 
         // L2Rel
-        if (level_ >= GlobalFlag::JecApplicationLevel::L2Rel) {
+        if (steps.l2Rel()) {
             const double c2 = functions_.getL2RelativeCorrection(eta, pt_corr);
             pt_corr   *= c2;
             mass_corr *= c2;
 
-            if (isBookKeep_) {
+            if (steps.bookKeep()) {
                 TLorentzVector t; t.SetPtEtaPhiM(pt_corr, eta, phi, mass_corr);
                 if (i == 0) p4MapJet1_["L2RelCorr"] += t;
                 p4MapJetSum_["L2RelCorr"] += t;
@@ -86,22 +109,22 @@ void ScaleJet::applyCorrection(std::shared_ptr<SkimTree>& skimT) {
         }
 
         // L2Res / L2L3Res (data only)
-        if (isData_ && (level_ >= GlobalFlag::JecApplicationLevel::L2L3Res)) {
+        if (steps.residual() == JecResidual::L2L3Res) {
             const double cR = functions_.getL2L3ResidualCorrection(eta, pt_corr);
             pt_corr   *= cR;
             mass_corr *= cR;
 
-            if (isBookKeep_) {
+            if (steps.bookKeep()) {
                 TLorentzVector t; t.SetPtEtaPhiM(pt_corr, eta, phi, mass_corr);
                 if (i == 0) p4MapJet1_["L2L3ResCorr"] += t;
                 p4MapJetSum_["L2L3ResCorr"] += t;
             }
-        } else if (isData_ && (level_ >= GlobalFlag::JecApplicationLevel::L2Res)) {
+        } else if (steps.residual() == JecResidual::L2Res) {
             const double cR = functions_.getL2ResidualCorrection(eta, pt_corr);
             pt_corr   *= cR;
             mass_corr *= cR;
 
-            if (isBookKeep_) {
+            if (steps.bookKeep()) {
                 TLorentzVector t; t.SetPtEtaPhiM(pt_corr, eta, phi, mass_corr);
                 if (i == 0) p4MapJet1_["L2ResCorr"] += t;
                 p4MapJetSum_["L2ResCorr"] += t;
@@ -109,26 +132,36 @@ void ScaleJet::applyCorrection(std::shared_ptr<SkimTree>& skimT) {
         }
 
         // JER (MC only)
-        if (applyJer_) {
-            const double cJER = functions_.getJerCorrection(*skimT, i, "nom", pt_corr);
-            pt_corr   *= cJER;
-            mass_corr *= cJER;
+        if (steps.jer()) {
+            const double cJer = functions_.getJerCorrection(skimT, i, "nom", pt_corr);
+            pt_corr   *= cJer;
+            mass_corr *= cJer;
 
-            if (isBookKeep_) {
+            if (steps.bookKeep()) {
                 TLorentzVector t; t.SetPtEtaPhiM(pt_corr, eta, phi, mass_corr);
                 if (i == 0) p4MapJet1_["JerCorr"] += t;
                 p4MapJetSum_["JerCorr"] += t;
             }
         }
 
-        if (isBookKeep_) {
+        if (steps.bookKeep()) {
             TLorentzVector p4Corr; p4Corr.SetPtEtaPhiM(pt_corr, eta, phi, mass_corr);
             if (i == 0) p4MapJet1_["Corr"] += p4Corr;
             p4MapJetSum_["Corr"] += p4Corr;
         }
 
-        skimT->Jet_pt[i]   = pt_corr;
-        skimT->Jet_mass[i] = mass_corr;
+        jets_.pt[i]   = pt_corr;
+        jets_.mass[i] = mass_corr;
     }
 }
 
+void ScaleJet::fillView_(SkimTree& skimT) {
+    for (int i = 0; i < jets_.n; ++i) {
+        skimT.Jet_pt[i]   = static_cast<Float_t>(jets_.pt[i]);
+        skimT.Jet_mass[i] = static_cast<Float_t>(jets_.mass[i]);
+    }
+
+    // Jets are final for this view: compute ID/pt/|eta| bits once for all consumers.
+    jetQuality_.fill(skimT);
+}
+
@@ -250,6 +250,7 @@ double ScaleJetFunction::getJerCorrection(const SkimTree& skimT,
     guard.checkFinite("rho", rho);
 
     // 2) Gen matching logic
+    skimT.require(SkimBranch::kJetGen);
     const int genIdx = skimT.Jet_genJetIdx[index];
 
     bool   matched       = false;
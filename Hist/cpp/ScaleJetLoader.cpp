@@ -1,7 +1,10 @@
 #include "ScaleJetLoader.h"
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
 #include "ReadConfig.h"
+#include "ResourceCache.h"
 
 ScaleJetLoader::ScaleJetLoader(const GlobalFlag& globalFlags)
     : globalFlags_(globalFlags),
@@ -50,46 +53,134 @@ void ScaleJetLoader::loadConfig(const std::string& filename) {
         jetL2ResidualName_ = config.getValue<std::string>({yearStr, "jetL2ResidualName"});
         jetL2L3ResidualName_ = config.getValue<std::string>({yearStr, "jetL2L3ResidualName"});
     } else if (isData_) {
-        std::string eraStr = globalFlags_.getEraStr();
-        jetL1FastJetName_  = config.getValue<std::string>({yearStr, "data", eraStr, "jetL1FastJetName"});
-        jetL2RelativeName_ = config.getValue<std::string>({yearStr, "data", eraStr, "jetL2RelativeName"});
-        jetL3AbsoluteName_ = config.getValue<std::string>({yearStr, "data", eraStr, "jetL3AbsoluteName"});
-        jetL2ResidualName_ = config.getValue<std::string>({yearStr, "data", eraStr, "jetL2ResidualName"});
-        jetL2L3ResidualName_ = config.getValue<std::string>({yearStr, "data", eraStr, "jetL2L3ResidualName"});
+        loadDataIovs(config, yearStr);
     }
 
-    auto cset = correction::CorrectionSet::from_file("POG/JME/jer_smear.json.gz");
+    auto cset = ResourceCache::correctionSet("POG/JME/jer_smear.json.gz");
     jerSmearRef_ = cset->at("JERSmear");  
 
     std::cout << "\n[ScaleJetLoader] " << filename << '\n';
     std::cout << "  jercJsonPath           = " << jercJsonPath_ << '\n';
-    std::cout << "  jetL1FastJetName       = " << jetL1FastJetName_ << '\n';
-    std::cout << "  jetL2RelativeName      = " << jetL2RelativeName_ << '\n';
-    std::cout << "  jetL2ResidualName      = " << jetL2ResidualName_ << '\n';
-    std::cout << "  jetL2L3ResidualName    = " << jetL2L3ResidualName_ << '\n';
+    if (isMC_) {
+        std::cout << "  jetL1FastJetName       = " << jetL1FastJetName_ << '\n';
+        std::cout << "  jetL2RelativeName      = " << jetL2RelativeName_ << '\n';
+        std::cout << "  jetL2ResidualName      = " << jetL2ResidualName_ << '\n';
+        std::cout << "  jetL2L3ResidualName    = " << jetL2L3ResidualName_ << '\n';
+    }
+    for (const auto& iov : iovs_) {
+        std::cout << "  IOV " << iov.era << " runs [" << iov.firstRun << ", " << iov.lastRun << "]\n";
+        std::cout << "    jetL1FastJetName     = " << iov.jetL1FastJetName << '\n';
+        std::cout << "    jetL2RelativeName    = " << iov.jetL2RelativeName << '\n';
+        std::cout << "    jetL2ResidualName    = " << iov.jetL2ResidualName << '\n';
+        std::cout << "    jetL2L3ResidualName  = " << iov.jetL2L3ResidualName << '\n';
+    }
     std::cout << "  JerResoName            = " << JerResoName_ << '\n';
     std::cout << "  JerSfName              = " << JerSfName_ << '\n';
 }
 
+void ScaleJetLoader::loadDataIovs(const ReadConfig& config, const std::string& yearStr) {
+    // Era given in the ioName: that IOV only. Year-only data: every era of the year.
+    std::vector<std::string> eras;
+    if (globalFlags_.spansEras()) {
+        const auto data = config.getValue<nlohmann::json>({yearStr, "data"});
+        for (const auto& item : data.items()) eras.push_back(item.key());
+    } else {
+        eras.push_back(globalFlags_.getEraStr());
+    }
+
+    for (const auto& eraStr : eras) {
+        DataIov iov;
+        const auto range = config.getValue<std::vector<unsigned>>({yearStr, "data", eraStr, "runRange"});
+        if (range.size() != 2 || range[0] > range[1]) {
+            throw std::runtime_error("ScaleJetLoader::loadDataIovs - invalid runRange for " +
+                                     yearStr + "/data/" + eraStr);
+        }
+        iov.firstRun = range[0];
+        iov.lastRun  = range[1];
+        iov.era      = eraStr;
+        iov.jetL1FastJetName    = config.getValue<std::string>({yearStr, "data", eraStr, "jetL1FastJetName"});
+        iov.jetL2RelativeName   = config.getValue<std::string>({yearStr, "data", eraStr, "jetL2RelativeName"});
+        iov.jetL2ResidualName   = config.getValue<std::string>({yearStr, "data", eraStr, "jetL2ResidualName"});
+        iov.jetL2L3ResidualName = config.getValue<std::string>({yearStr, "data", eraStr, "jetL2L3ResidualName"});
+        iovs_.push_back(std::move(iov));
+    }
+
+    std::sort(iovs_.begin(), iovs_.end(),
+              [](const DataIov& a, const DataIov& b) { return a.firstRun < b.firstRun; });
+    for (std::size_t i = 1; i < iovs_.size(); ++i) {
+        if (iovs_[i].firstRun <= iovs_[i - 1].lastRun) {
+            throw std::runtime_error("ScaleJetLoader::loadDataIovs - overlapping runRange for " +
+                                     iovs_[i - 1].era + " and " + iovs_[i].era);
+        }
+    }
+}
+
 void ScaleJetLoader::loadRefs() {
-    loadJetL1FastJetRef();
-    loadJetL2RelativeRef();
-    if (isData_){
-        if (level_ >= GlobalFlag::JecApplicationLevel::L2L3Res) {
-            loadJetL2L3ResidualRef();
-        } else if (level_ >= GlobalFlag::JecApplicationLevel::L2Res) {
-            loadJetL2ResidualRef();
+    if (isData_) {
+        // Load every IOV once through the same per-level loaders, then keep
+        // the refs in the IOV table.
+        for (auto& iov : iovs_) {
+            jetL1FastJetName_    = iov.jetL1FastJetName;
+            jetL2RelativeName_   = iov.jetL2RelativeName;
+            jetL2ResidualName_   = iov.jetL2ResidualName;
+            jetL2L3ResidualName_ = iov.jetL2L3ResidualName;
+
+            loadJetL1FastJetRef();
+            loadJetL2RelativeRef();
+            if (level_ >= GlobalFlag::JecApplicationLevel::L2L3Res) {
+                loadJetL2L3ResidualRef();
+            } else if (level_ >= GlobalFlag::JecApplicationLevel::L2Res) {
+                loadJetL2ResidualRef();
+            }
+            iov.jetL1FastJetRef    = loadedJetL1FastJetRef_;
+            iov.jetL2RelativeRef   = loadedJetL2RelativeRef_;
+            iov.jetL2ResidualRef   = loadedJetL2ResidualRef_;
+            iov.jetL2L3ResidualRef = loadedJetL2L3ResidualRef_;
         }
+        selectIov(0);
     } else { // MC
+        loadJetL1FastJetRef();
+        loadJetL2RelativeRef();
         loadJerResoRef();
         loadJerSfRef();
     }
 }
 
+std::size_t ScaleJetLoader::findIov(unsigned run) const {
+    // first IOV starting after `run`; the one before it is the candidate
+    auto it = std::upper_bound(iovs_.begin(), iovs_.end(), run,
+                               [](unsigned r, const DataIov& iov) { return r < iov.firstRun; });
+    if (it == iovs_.begin() || run > std::prev(it)->lastRun) {
+        throw std::runtime_error("ScaleJetLoader::findIov - run " + std::to_string(run) +
+                                 " is outside every IOV of " + globalFlags_.getYearStr() +
+                                 " (see runRange in the ScaleJetLoader config)");
+    }
+    return static_cast<std::size_t>(std::distance(iovs_.begin(), it) - 1);
+}
+
+void ScaleJetLoader::selectIov(std::size_t index) {
+    const DataIov& iov = iovs_.at(index);
+    loadedJetL1FastJetRef_     = iov.jetL1FastJetRef;
+    loadedJetL2RelativeRef_    = iov.jetL2RelativeRef;
+    loadedJetL2ResidualRef_    = iov.jetL2ResidualRef;
+    loadedJetL2L3ResidualRef_  = iov.jetL2L3ResidualRef;
+    curEra_ = iov.era;
+
+    // A single IOV (era from the ioName) applies to every run, as before.
+    if (iovs_.size() > 1) {
+        curFirstRun_ = iov.firstRun;
+        curLastRun_  = iov.lastRun;
+    }
+    if (isDebug_) {
+        std::cout << "[ScaleJetLoader] IOV " << iov.era << " runs [" << iov.firstRun
+                  << ", " << iov.lastRun << "]\n";
+    }
+}
+
 void ScaleJetLoader::loadJetL1FastJetRef() {
     std::cout << "==> loadJetL1FastJetRef()\n";
     try {
-        loadedJetL1FastJetRef_ = correction::CorrectionSet::from_file(jercJsonPath_)->at(jetL1FastJetName_);
+        loadedJetL1FastJetRef_ = ResourceCache::correctionSet(jercJsonPath_)->at(jetL1FastJetName_);
     } catch (const std::exception& e) {
         std::cerr << "\nEXCEPTION: ScaleJetLoader::loadJetL1FastJetRef\n";
         std::cerr << "Check " << jercJsonPath_ << " or " << jetL1FastJetName_ << '\n';
@@ -101,7 +192,7 @@ void ScaleJetLoader::loadJetL1FastJetRef() {
 void ScaleJetLoader::loadJetL2RelativeRef() {
     std::cout << "==> loadJetL2RelativeRef()\n";
     try {
-        loadedJetL2RelativeRef_ = correction::CorrectionSet::from_file(jercJsonPath_)->at(jetL2RelativeName_);
+        loadedJetL2RelativeRef_ = ResourceCache::correctionSet(jercJsonPath_)->at(jetL2RelativeName_);
     } catch (const std::exception& e) {
         std::cerr << "\nEXCEPTION: ScaleJetLoader::loadJetL2RelativeRef\n";
         std::cerr << "Check " << jercJsonPath_ << " or " << jetL2RelativeName_ << '\n';
@@ -113,7 +204,7 @@ void ScaleJetLoader::loadJetL2RelativeRef() {
 void ScaleJetLoader::loadJetL2ResidualRef() {
     std::cout << "==> loadJetL2ResidualRef()\n";
     try {
-        loadedJetL2ResidualRef_ = correction::CorrectionSet::from_file(jercJsonPath_)->at(jetL2ResidualName_);
+        loadedJetL2ResidualRef_ = ResourceCache::correctionSet(jercJsonPath_)->at(jetL2ResidualName_);
     } catch (const std::exception& e) {
         std::cerr << "\nEXCEPTION: ScaleJetLoader::loadJetL2ResidualRef\n";
         std::cerr << "Check " << jercJsonPath_ << " or " << jetL2ResidualName_ << '\n';
@@ -125,7 +216,7 @@ void ScaleJetLoader::loadJetL2ResidualRef() {
 void ScaleJetLoader::loadJetL2L3ResidualRef() {
     std::cout << "==> loadJetL2L3ResidualRef()\n";
     try {
-        loadedJetL2L3ResidualRef_ = correction::CorrectionSet::from_file(jercJsonPath_)->at(jetL2L3ResidualName_);
+        loadedJetL2L3ResidualRef_ = ResourceCache::correctionSet(jercJsonPath_)->at(jetL2L3ResidualName_);
     } catch (const std::exception& e) {
         std::cerr << "\nEXCEPTION: ScaleJetLoader::loadJetL2L3ResidualRef\n";
         std::cerr << "Check " << jercJsonPath_ << " or " << jetL2L3ResidualName_ << '\n';
@@ -137,7 +228,7 @@ void ScaleJetLoader::loadJetL2L3ResidualRef() {
 void ScaleJetLoader::loadJerResoRef() {
     std::cout << "==> loadJerResoRef()\n";
     try {
-        loadedJerResoRef_ = correction::CorrectionSet::from_file(jercJsonPath_)->at(JerResoName_);
+        loadedJerResoRef_ = ResourceCache::correctionSet(jercJsonPath_)->at(JerResoName_);
     } catch (const std::exception& e) {
         std::cout << "\nEXCEPTION: ScaleJetLoader::loadJerResoRef\n";
         std::cout << "Check " << jercJsonPath_ << " or " << JerResoName_ << '\n';
@@ -149,7 +240,7 @@ void ScaleJetLoader::loadJerResoRef() {
 void ScaleJetLoader::loadJerSfRef() {
     std::cout << "==> loadJerSfRef()\n";
     try {
-        loadedJerSfRef_ = correction::CorrectionSet::from_file(jercJsonPath_)->at(JerSfName_);
+        loadedJerSfRef_ = ResourceCache::correctionSet(jercJsonPath_)->at(JerSfName_);
     } catch (const std::exception& e) {
         std::cout << "\nEXCEPTION: ScaleJetLoader::loadJerSfRef\n";
         std::cout << "Check " << jercJsonPath_ << " or " << JerSfName_ << '\n';
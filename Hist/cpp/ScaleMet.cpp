@@ -1,35 +1,44 @@
 #include "ScaleMet.h"
+#include "fwk/LoggerService.h"
 #include <iostream>
 #include <cmath>
 
 ScaleMet::ScaleMet(const GlobalFlag& globalFlags)
     : functions_(globalFlags),
       globalFlags_(globalFlags),
-      level_(globalFlags_.getJecApplicationLevel()),
+      jecSteps_(JecStepsRuntime::of(globalFlags_)),
       isDebug_(globalFlags_.isDebug()),
       isData_(globalFlags_.isData()),
       isBookKeep_(globalFlags_.isBookKeep()),
-      jetAlgo_(globalFlags_.getJetAlgo()),
-      applyJer_(globalFlags_.applyJer() && !isData_),
       p4CorrectedMet_(0,0,0,0)
 {
+    dispatchJecSteps(jecSteps_, [this](auto steps) {
+        type1_ = &ScaleMet::addType1As_<decltype(steps)>;
+    });
+}
+
+template <class Steps>
+void ScaleMet::addType1As_(const SkimTree& skimT, const CorrectedJets& jets,
+                           double& metPx, double& metPy) {
+    addType1_(skimT, jets, jecStepsAs<Steps>(jecSteps_), metPx, metPy);
 }
 
 void ScaleMet::applyCorrection(const std::shared_ptr<SkimTree>& skimT,
-                               const std::vector<double>& jetPtRaw) {
+                               const CorrectedJets& jets) {
     if (!skimT) {
         std::cerr << "ScaleMet::applyCorrection: nullptr SkimTree\n";
         return;
     }
-    if (static_cast<int>(jetPtRaw.size()) != skimT->nJet) {
-        std::cerr << "ScaleMet::applyCorrection: jetPtRaw size mismatch\n";
+    if (jets.n != static_cast<int>(skimT->nJet)) {
+        std::cerr << "ScaleMet::applyCorrection: CorrectedJets size mismatch\n";
     }
 
-    if (isDebug_) std::cout << "\n[ScaleMet::applyCorrection]\n";
+    FWK_DEBUG("[ScaleMet]", "applyCorrection");
 
     // reset per-event state
     p4MapMet_.clear();
     p4CorrectedMet_.SetPtEtaPhiM(0,0,0,0);
+    if (isData_) functions_.selectRun(skimT->run);
 
     // Store Raw/Nano MET for comparison
     TLorentzVector p4MetRaw;  p4MetRaw.SetPtEtaPhiM(skimT->RawMET_pt, 0, skimT->RawMET_phi, 0);
@@ -40,83 +49,88 @@ void ScaleMet::applyCorrection(const std::shared_ptr<SkimTree>& skimT,
         p4MapMet_["Nano"] = p4MetNano;
     }
 
-    if (isDebug_) std::cout << "\n ====> Met pT Nano = " << skimT->MET_pt << "\n";
+    FWK_DEBUG("[ScaleMet]", "Met pT Nano = ", skimT->MET_pt);
 
     // Start from RAW MET
     double met_px = skimT->RawMET_pt * std::cos(skimT->RawMET_phi);
     double met_py = skimT->RawMET_pt * std::sin(skimT->RawMET_phi);
 
     // Loop corrected jets and apply Type-1
-    for (int i = 0; i < skimT->nJet; ++i) {
-        if (isDebug_) std::cout << "\n ---> Jet Index = " << i << "\n";
+    (this->*type1_)(*skimT, jets, met_px, met_py);
+
+    // finalize MET
+    const double met_pt  = std::hypot(met_px, met_py);
+    const double met_phi = std::atan2(met_py, met_px);
+    TLorentzVector p4MetCorr; p4MetCorr.SetPtEtaPhiM(met_pt, 0, met_phi, 0);
 
-        const double eta  = skimT->Jet_eta[i];
-        const double phi  = skimT->Jet_phi[i];
-        const float  area = skimT->Jet_area[i];
+    FWK_DEBUG("[ScaleMet]", "Met pT Type-1 Corrected = ", met_pt);
+
+    if (isBookKeep_) {
+        p4MapMet_["Corr"] = p4MetCorr;
+    }
+    p4CorrectedMet_ = p4MetCorr;
+}
 
-        const double pt_raw = (i < static_cast<int>(jetPtRaw.size()))
-                              ? jetPtRaw[i]
-                              : skimT->Jet_pt[i]; // fallback
-        const double pt_raw_minusMuon = pt_raw * (1 - skimT->Jet_muonSubtrFactor[i]);
+// Subtracts the Type-1 shift (corrected - L1RC pt) of every selected jet
+template <class Steps>
+void ScaleMet::addType1_(const SkimTree& skimT, const CorrectedJets& jets,
+                         const Steps& steps, double& metPx, double& metPy) {
+    const int n = static_cast<int>(skimT.nJet);
+    for (int i = 0; i < n; ++i) {
+        FWK_DEBUG("[ScaleMet]", "---> Jet Index = ", i);
+
+        const double eta  = skimT.Jet_eta[i];
+        const double phi  = skimT.Jet_phi[i];
+        const float  area = skimT.Jet_area[i];
+
+        const double pt_raw = (i < jets.n)
+                              ? jets.ptRaw[i]
+                              : skimT.Jet_ptNano[i] * (1.0 - skimT.Jet_rawFactor[i]); // fallback
+        const double pt_raw_minusMuon = pt_raw * (1 - skimT.Jet_muonSubtrFactor[i]);
         double pt_corr = pt_raw_minusMuon;
 
         if(pt_raw_minusMuon < 10) continue; //FIXME
 
-        if (isDebug_) {
-            std::cout << " pt_raw = " << pt_raw
-                      << ", pt_raw_minusMuon = " << pt_raw_minusMuon << "\n";
-        }
+        FWK_DEBUG("[ScaleMet]", " pt_raw = ", pt_raw,
+                  ", pt_raw_minusMuon = ", pt_raw_minusMuon);
 
-        if (level_ >= GlobalFlag::JecApplicationLevel::L1Rc && jetAlgo_ == GlobalFlag::JetAlgo::AK4Chs) {
-            const double c1 = functions_.getL1FastJetCorrection(area, eta, pt_corr, skimT->Rho);
+        if (steps.l1Rc()) {
+            const double c1 = functions_.getL1FastJetCorrection(area, eta, pt_corr, skimT.Rho);
             pt_corr *= c1;
         }
         // L1 RC reference point
         const double pt_corr_l1rc = pt_corr;
 
-        if (level_ >= GlobalFlag::JecApplicationLevel::L2Rel) {
+        if (steps.l2Rel()) {
             const double c2 = functions_.getL2RelativeCorrection(eta, pt_corr);
             pt_corr *= c2;
         }
 
-        if (isData_ && (level_ >= GlobalFlag::JecApplicationLevel::L2L3Res)) {
+        if (steps.residual() == JecResidual::L2L3Res) {
             const double cR = functions_.getL2L3ResidualCorrection(eta, pt_corr);
             pt_corr *= cR;
-        } else if (isData_ && (level_ >= GlobalFlag::JecApplicationLevel::L2Res)) {
+        } else if (steps.residual() == JecResidual::L2Res) {
             const double cR = functions_.getL2ResidualCorrection(eta, pt_corr);
             pt_corr *= cR;
         }
 
-        if (applyJer_) {
-            const double cJER = functions_.getJerCorrection(*skimT, i, "nom", pt_corr);
+        if (steps.jer()) {
+            const double cJER = functions_.getJerCorrection(skimT, i, "nom", pt_corr);
             pt_corr *= cJER;
         }
 
         // selection for propagation (same as original)
         const bool passSel = (pt_corr > 15.0
                               && std::abs(eta) < 5.2
-                              && (skimT->Jet_neEmEF[i] + skimT->Jet_chEmEF[i]) < 0.9);
+                              && (skimT.Jet_neEmEF[i] + skimT.Jet_chEmEF[i]) < 0.9);
         if (!passSel) continue;
 
         const double dpt = (pt_corr - pt_corr_l1rc);
-        met_px -= dpt * std::cos(phi);
-        met_py -= dpt * std::sin(phi);
-
-        if (isDebug_) std::cout << " -> Jet Index Added to MET = " << i << "\n";
-        if (isDebug_) std::cout << " -> dpt Added to MET = " << dpt << "\n";
-    }
-
-    // finalize MET
-    const double met_pt  = std::hypot(met_px, met_py);
-    const double met_phi = std::atan2(met_py, met_px);
-    TLorentzVector p4MetCorr; p4MetCorr.SetPtEtaPhiM(met_pt, 0, met_phi, 0);
-
-    if (isDebug_) std::cout << "\n ===> Met pT Type-1 Corrected = " << met_pt << "\n";
+        metPx -= dpt * std::cos(phi);
+        metPy -= dpt * std::sin(phi);
 
-    if (isBookKeep_) {
-        p4MapMet_["Corr"] = p4MetCorr;
+        FWK_DEBUG("[ScaleMet]", " -> Jet Index Added to MET = ", i, ", dpt = ", dpt);
     }
-    p4CorrectedMet_ = p4MetCorr;
 }
 
 // Optional debug helper if you want to compare with jets externally
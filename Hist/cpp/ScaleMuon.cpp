@@ -41,16 +41,26 @@ void ScaleMuon::initializeP4Map() {
     }
 }
 
-void ScaleMuon::applyCorrections(std::shared_ptr<SkimTree>& skimT) {
+void ScaleMuon::matchGenMuons(const SkimTree& skimT, std::vector<int>& genIdx) const {
+    functions_.matchGenMuons(skimT, genIdx);
+}
+
+void ScaleMuon::applyCorrections(std::shared_ptr<SkimTree>& skimT,
+                                 const std::vector<int>* genMuonMatch) {
     initializeP4Map();
 
+    if (!genMuonMatch) {
+        functions_.matchGenMuons(*skimT, genMuonMatch_);
+        genMuonMatch = &genMuonMatch_;
+    }
+
     TLorentzVector p4Muon;
     for (int j = 0; j < skimT->nMuon; ++j) {
         p4Muon.SetPtEtaPhiM(skimT->Muon_pt[j], skimT->Muon_eta[j],
                             skimT->Muon_phi[j], skimT->Muon_mass[j]);
         if (j == 0) p4MapMuon1_["Nano"] = p4Muon;
 
-        const double corr = functions_.getMuonRochCorrection(*skimT, j, "nom");
+        const double corr = functions_.getMuonRochCorrection(*skimT, j, "nom", (*genMuonMatch)[j]);
         if(corr > 0.0) skimT->Muon_pt[j] *= corr;//FIXME
 
         p4Muon.SetPtEtaPhiM(skimT->Muon_pt[j], skimT->Muon_eta[j],
@@ -19,9 +19,38 @@ ScaleMuonFunction::ScaleMuonFunction(const GlobalFlag& globalFlags)
       isMC_(globalFlags_.isMC()) {}
 
 // ---------------- Rochester ----------------
+// Lowest-index GenDressedLepton muon within ΔR < 0.2 of (eta, phi); -1 if none
+int ScaleMuonFunction::genMuonFor_(const SkimTree& skimT, double eta, double phi) {
+    for (int i = 0; i < static_cast<int>(skimT.nGenDressedLepton); ++i) {
+        if (std::abs(skimT.GenDressedLepton_pdgId[i]) == 13) {
+            const double delR =
+                HelperDelta::DELTAR(phi, skimT.GenDressedLepton_phi[i],
+                                    eta, skimT.GenDressedLepton_eta[i]);
+            if (delR < 0.2) return i;
+        }
+    }
+    return -1;
+}
+
+void ScaleMuonFunction::matchGenMuons(const SkimTree& skimT, std::vector<int>& genIdx) const {
+    genIdx.assign(skimT.nMuon, -1);
+    if (!isMC_) return;
+    for (int j = 0; j < static_cast<int>(skimT.nMuon); ++j) {
+        genIdx[j] = genMuonFor_(skimT, skimT.Muon_eta[j], skimT.Muon_phi[j]);
+    }
+}
+
 double ScaleMuonFunction::getMuonRochCorrection(const SkimTree& skimT,
                                                int index,
                                                const std::string& syst) const {
+    const int genIdx = isMC_ ? genMuonFor_(skimT, skimT.Muon_eta[index], skimT.Muon_phi[index]) : -1;
+    return getMuonRochCorrection(skimT, index, syst, genIdx);
+}
+
+double ScaleMuonFunction::getMuonRochCorrection(const SkimTree& skimT,
+                                               int index,
+                                               const std::string& syst,
+                                               int genIdx) const {
     (void)syst; // placeholder for future up/down
 
     ScaleFunctionGuard guard(globalFlags_, "ScaleMuonFunction::getMuonRochCorrection",
@@ -50,17 +79,9 @@ double ScaleMuonFunction::getMuonRochCorrection(const SkimTree& skimT,
     }
 
     if (isMC_) {
-        for (int i = 0; i < skimT.nGenDressedLepton; ++i) {
-            if (std::abs(skimT.GenDressedLepton_pdgId[i]) == 13) {
-                const double delR =
-                    HelperDelta::DELTAR(phi, skimT.GenDressedLepton_phi[i],
-                                        eta, skimT.GenDressedLepton_eta[i]);
-                if (delR < 0.2) {
-                    genPt = skimT.GenDressedLepton_pt[i];
-                    isMatched = true;
-                    break;
-                }
-            }
+        if (genIdx >= 0) {
+            genPt = skimT.GenDressedLepton_pt[genIdx];
+            isMatched = true;
         }
 
         if (isMatched) {
@@ -69,6 +90,7 @@ double ScaleMuonFunction::getMuonRochCorrection(const SkimTree& skimT,
             // deterministic event-by-event
             loader_.rng().SetSeed(skimT.event + skimT.run + skimT.luminosityBlock);
             u  = loader_.rng().Uniform(0.0, 1.0);
+            skimT.require(SkimBranch::kMuon);
             nl = skimT.Muon_nTrackerLayers[index];
             corrMuRoch = loader_.roch().kSmearMC(Q, pt, eta, phi, nl, u, s, m);
         }
@@ -3,6 +3,7 @@
 #include <iostream>
 
 #include "ReadConfig.h"
+#include "ResourceCache.h"
 
 // ROOT
 #include "TFile.h"
@@ -57,7 +58,7 @@ void ScalePhotonLoader::loadPhotonSsRef() {
     if (isDebug_) std::cout << "==> ScalePhotonLoader::loadPhotonSsRef()\n";
     try {
         loadedPhotonSsRef_ =
-            correction::CorrectionSet::from_file(phoSsJsonPath_)->at(phoSsName_);
+            ResourceCache::correctionSet(phoSsJsonPath_)->at(phoSsName_);
     } catch (const std::exception& e) {
         std::cout << "\nEXCEPTION: ScalePhotonLoader::loadPhotonSsRef()\n"
                   << "Check " << phoSsJsonPath_ << " or " << phoSsName_ << '\n'
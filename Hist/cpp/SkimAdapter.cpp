@@ -42,6 +42,8 @@ SkimAdapter::SkimAdapter(GlobalFlag& flags, SkimBranch& branches)
 
     enableGenPart_  = false;
     enablePSWeight_ = false;
+
+    if (isNanoV15_) br_.v15Adapter_ = this;
 }
 
 // ----------------------------------------------------------------------
@@ -154,6 +156,8 @@ void SkimAdapter::setupJetBranches(TChain* chain) {
 
         setJetBranch("chMultiplicity", Jet_chMultiplicity_v15_);
         setJetBranch("neMultiplicity", Jet_neMultiplicity_v15_);
+        v15Collections_ |= SkimBranch::kJetMultiplicity;
+        if (enableMuon_ || enableElectron_) v15Collections_ |= SkimBranch::kJetLeptonIdx;
 
         if(enableMuon_){
             chain->SetBranchStatus("Jet_muonIdx1", 1);
@@ -186,12 +190,12 @@ void SkimAdapter::setupJetBranches(TChain* chain) {
     setJetBranch("chEmEF",          br_.Jet_chEmEF);
     setJetBranch("chHEF",           br_.Jet_chHEF);
     setJetBranch("eta",             br_.Jet_eta);
-    setJetBranch("mass",            br_.Jet_mass);
+    setJetBranch("mass",            br_.Jet_massNano);
     setJetBranch("muEF",            br_.Jet_muEF);
     setJetBranch("neEmEF",          br_.Jet_neEmEF);
     setJetBranch("neHEF",           br_.Jet_neHEF);
     setJetBranch("phi",             br_.Jet_phi);
-    setJetBranch("pt",              br_.Jet_pt);
+    setJetBranch("pt",              br_.Jet_ptNano);
     setJetBranch("rawFactor",       br_.Jet_rawFactor);
     setJetBranch("muonSubtrFactor", br_.Jet_muonSubtrFactor);
     if (isNanoV9_) {
@@ -222,6 +226,7 @@ void SkimAdapter::setupLeptonBranches(TChain* chain) {
             setBranch("nPhoton",         &nPhoton_v15_);
             setBranch("Photon_cutBased",  Photon_cutBased_v15_);
             setBranch("Photon_jetIdx",       Photon_jetIdx_v15_);
+            v15Collections_ |= SkimBranch::kPhoton;
         } else {
             throw std::runtime_error("SkimAdapter: unknown NanoVersion for Photon_*");
         }
@@ -248,6 +253,7 @@ void SkimAdapter::setupLeptonBranches(TChain* chain) {
         } else if (isNanoV15_) {
             setBranch("nElectron",          &nElectron_v15_);
             setBranch("Electron_cutBased",   Electron_cutBased_v15_);
+            v15Collections_ |= SkimBranch::kElectron;
         } else {
             throw std::runtime_error("SkimAdapter: unknown NanoVersion for Electron_*");
         }
@@ -270,6 +276,7 @@ void SkimAdapter::setupLeptonBranches(TChain* chain) {
         } else if (isNanoV15_) {
             setBranch("nMuon",               &nMuon_v15_);
             setBranch("Muon_nTrackerLayers",  Muon_nTrackerLayers_v15_);
+            v15Collections_ |= SkimBranch::kMuon;
         } else {
             throw std::runtime_error("SkimAdapter: unknown NanoVersion for Muon_*");
         }
@@ -398,6 +405,7 @@ void SkimAdapter::setupMCBranches(TChain* chain) {
             setGenJetBranch("partonFlavour",   GenJet_partonFlavour_v15_);
             setGenJetBranch("hadronFlavour",   GenJet_hadronFlavour_v15_);
             setBranch(genJetIndx.c_str(),       Jet_genJetIdx_v15_);
+            v15Collections_ |= SkimBranch::kJetGen | SkimBranch::kGenJetFlavour;
         }
         if (enablePSWeight_) {
             setBranch("nPSWeight", &nPSWeight_v15_);
@@ -406,6 +414,7 @@ void SkimAdapter::setupMCBranches(TChain* chain) {
             setBranch("nGenPart",  &nGenPart_v15_);
             setBranch("GenPart_genPartIdxMother",    GenPart_genPartIdxMother_v15_);
             setBranch("GenPart_statusFlags",         GenPart_statusFlags_v15_);
+            v15Collections_ |= SkimBranch::kGenPart;
         }
 
     } else {
@@ -496,93 +505,86 @@ void SkimAdapter::setupMetBranches(TChain* chain) {
 // ----------------------------------------------------------------------
 void SkimAdapter::afterGetEntry() {
     if (!isNanoV15_) return;
-    convertV15ToV9();
+    convertV15Counters_();
+    br_.v15Pending_ = v15Collections_;
 }
 
-void SkimAdapter::convertV15ToV9() {
+void SkimAdapter::convertV15Counters_() {
     // Scalars
     br_.PV_npvs            = static_cast<Int_t>(PV_npvs_v15_);
     br_.PV_npvsGood        = static_cast<Int_t>(PV_npvsGood_v15_);
 
-    // Electrons
-    if(enableElectron_){
-        br_.nElectron          = static_cast<UInt_t>(nElectron_v15_);
-        const std::size_t nEle = static_cast<std::size_t>(br_.nElectron);
-        convertArray_(br_.Electron_cutBased,
-                      Electron_cutBased_v15_, nEle);
-    }
-
-    // Muons
-    if(enableMuon_){
-        br_.nMuon              = static_cast<UInt_t>(nMuon_v15_);
-        const std::size_t nMuon   = static_cast<std::size_t>(br_.nMuon);
-        convertArray_(br_.Muon_nTrackerLayers,
-                      Muon_nTrackerLayers_v15_, nMuon);
-    }
-
-    // Photons
-    if(enablePhoton_){
+    br_.nJet = static_cast<UInt_t>(nJet_v15_);
+    if (enableElectron_) br_.nElectron = static_cast<UInt_t>(nElectron_v15_);
+    if (enableMuon_)     br_.nMuon     = static_cast<UInt_t>(nMuon_v15_);
+    if (enablePhoton_) {
         br_.nPhoton            = static_cast<UInt_t>(nPhoton_v15_);
-        const std::size_t nPhoton = static_cast<std::size_t>(br_.nPhoton);
-        convertArray_(br_.Photon_cutBased,
-                      Photon_cutBased_v15_,   nPhoton);
-        convertArray_(br_.Photon_jetIdx,
-                      Photon_jetIdx_v15_,     nPhoton);
-        convertArray_(br_.Photon_genPartIdx,
-                      Photon_genPartIdx_v15_, nPhoton);
-
-        br_.nGenIsolatedPhoton =
-            static_cast<UInt_t>(nGenIsolatedPhoton_v15_);
+        br_.nGenIsolatedPhoton = static_cast<UInt_t>(nGenIsolatedPhoton_v15_);
     }
+    if (enableGenJet_)   br_.nGenJet   = static_cast<UInt_t>(nGenJet_v15_);
+    if (enableGenPart_)  br_.nGenPart  = static_cast<UInt_t>(nGenPart_v15_);
+    if (enablePSWeight_) br_.nPSWeight = static_cast<UInt_t>(nPSWeight_v15_);
+    if (enableElectron_ || enableMuon_)
+        br_.nGenDressedLepton = static_cast<UInt_t>(nGenDressedLepton_v15_);
+}
 
-    // GenJet
-    if (enableGenJet_){
-        br_.nGenJet = static_cast<UInt_t>(nGenJet_v15_);
-        const std::size_t nGenJet = static_cast<std::size_t>(br_.nGenJet);
-        convertArray_(br_.GenJet_partonFlavour,
-                      GenJet_partonFlavour_v15_, nGenJet);
-        convertArray_(br_.GenJet_hadronFlavour,
-                      GenJet_hadronFlavour_v15_, nGenJet);
-    }
+// Arrays are widened only over the current n-counter and only once per event.
+void SkimAdapter::convertCollections(unsigned collections) {
+    collections &= br_.v15Pending_;
+    if (!collections) return;
+    br_.v15Pending_ &= ~collections;
 
-    // GenPart
-    if (enableGenPart_){ 
-        br_.nGenPart = static_cast<UInt_t>(nGenPart_v15_);
-        const std::size_t nGenPart = static_cast<std::size_t>(br_.nGenPart);
-        convertArray_(br_.GenPart_genPartIdxMother,
-                      GenPart_genPartIdxMother_v15_, nGenPart);
-        convertArray_(br_.GenPart_statusFlags,
-                      GenPart_statusFlags_v15_,      nGenPart);
-    }
-
-    //PSWeight
-    if (enablePSWeight_) 
-        br_.nPSWeight = static_cast<UInt_t>(nPSWeight_v15_);
-
-    //Jet
-    br_.nJet               = static_cast<UInt_t>(nJet_v15_);
-    const std::size_t nJet    = static_cast<std::size_t>(br_.nJet);
-    if(isNanoV15_){
+    const std::size_t nJet = br_.nJet;
+
+    if (collections & SkimBranch::kJetMultiplicity) {
         convertArray_(br_.Jet_chMultiplicity, Jet_chMultiplicity_v15_, nJet);
         convertArray_(br_.Jet_neMultiplicity, Jet_neMultiplicity_v15_, nJet);
     }
-    if(enableMuon_){
-        convertArray_(br_.Jet_muonIdx1,       Jet_muonIdx1_v15_,       nJet);
-        convertArray_(br_.Jet_muonIdx2,       Jet_muonIdx2_v15_,       nJet);
-    }
-    if(enableElectron_){
-        convertArray_(br_.Jet_electronIdx1,   Jet_electronIdx1_v15_,   nJet);
-        convertArray_(br_.Jet_electronIdx2,   Jet_electronIdx2_v15_,   nJet);
+    if (collections & SkimBranch::kJetLeptonIdx) {
+        if (enableMuon_) {
+            convertArray_(br_.Jet_muonIdx1, Jet_muonIdx1_v15_, nJet);
+            convertArray_(br_.Jet_muonIdx2, Jet_muonIdx2_v15_, nJet);
+        }
+        if (enableElectron_) {
+            convertArray_(br_.Jet_electronIdx1, Jet_electronIdx1_v15_, nJet);
+            convertArray_(br_.Jet_electronIdx2, Jet_electronIdx2_v15_, nJet);
+        }
     }
-    if(isMC_){
+    if (collections & SkimBranch::kJetGen) {
         convertArray_(br_.Jet_genJetIdx,     Jet_genJetIdx_v15_,     nJet);
         convertArray_(br_.Jet_partonFlavour, Jet_partonFlavour_v15_, nJet);
         convertArray_(br_.Jet_hadronFlavour, Jet_hadronFlavour_v15_, nJet);
     }
+    if (collections & SkimBranch::kGenJetFlavour) {
+        const std::size_t nGenJet = br_.nGenJet;
+        convertArray_(br_.GenJet_partonFlavour, GenJet_partonFlavour_v15_, nGenJet);
+        convertArray_(br_.GenJet_hadronFlavour, GenJet_hadronFlavour_v15_, nGenJet);
+    }
+    if (collections & SkimBranch::kPhoton) {
+        const std::size_t nPhoton = br_.nPhoton;
+        convertArray_(br_.Photon_cutBased, Photon_cutBased_v15_, nPhoton);
+        convertArray_(br_.Photon_jetIdx,   Photon_jetIdx_v15_,   nPhoton);
+        if (isMC_) {
+            convertArray_(br_.Photon_genPartIdx, Photon_genPartIdx_v15_, nPhoton);
+        }
+    }
+    if (collections & SkimBranch::kElectron) {
+        convertArray_(br_.Electron_cutBased, Electron_cutBased_v15_,
+                      static_cast<std::size_t>(br_.nElectron));
+    }
+    if (collections & SkimBranch::kMuon) {
+        convertArray_(br_.Muon_nTrackerLayers, Muon_nTrackerLayers_v15_,
+                      static_cast<std::size_t>(br_.nMuon));
+    }
+    if (collections & SkimBranch::kGenPart) {
+        const std::size_t nGenPart = br_.nGenPart;
+        convertArray_(br_.GenPart_genPartIdxMother, GenPart_genPartIdxMother_v15_, nGenPart);
+        convertArray_(br_.GenPart_statusFlags,      GenPart_statusFlags_v15_,      nGenPart);
+    }
+}
 
-    //GenLepton
-    if(enableElectron_ || enableMuon_)
-        br_.nGenDressedLepton  = static_cast<UInt_t>(nGenDressedLepton_v15_);
+void SkimBranch::convertV15_(unsigned collections) const {
+    v15Adapter_->convertCollections(collections);
 }
 
 void SkimAdapter::printDebug() const {
@@ -157,3 +157,56 @@ void SkimFile::loadJobFileNames() {
     loadedJobFileNames_ = smallVectors[loadedNthJob_ - 1];
 }
 
+
+void SkimFile::splitAtClusters(const SkimFileIndex& index) {
+    std::cout << "==> splitAtClusters()" << '\n';
+    if (!index.covers(loadedAllFileNames_)) {
+        throw std::runtime_error("SkimFile::splitAtClusters - not every file of " + loadedSampKey_ +
+                                 " is in the file index; rerun runMain -x");
+    }
+
+    std::vector<SkimFileIndex::WorkUnit> units;
+    for (const auto& path : loadedAllFileNames_) {
+        const auto fileUnits = SkimFileIndex::workUnits(path, *index.find(path));
+        units.insert(units.end(), fileUnits.begin(), fileUnits.end());
+    }
+    long double totalBytes = 0;
+    for (const auto& u : units) totalBytes += u.bytes;
+    if (units.empty() || totalBytes <= 0) {
+        throw std::runtime_error("SkimFile::splitAtClusters - no clusters indexed for " + loadedSampKey_);
+    }
+
+    // A cluster goes to the job whose byte slice holds its midpoint, so the
+    // slices are contiguous and the same in every job of the sample
+    const int nJobs = loadedTotJob_;
+    std::vector<const SkimFileIndex::WorkUnit*> mine;
+    long double cumBytes = 0;
+    for (const auto& u : units) {
+        const long double mid = cumBytes + 0.5L * u.bytes;
+        cumBytes += u.bytes;
+        const int job = std::min(nJobs - 1, static_cast<int>(mid * nJobs / totalBytes));
+        if (job == loadedNthJob_ - 1) mine.push_back(&u);
+    }
+    if (mine.empty()) {
+        throw std::runtime_error("SkimFile::splitAtClusters - job " + std::to_string(loadedNthJob_) + " of " +
+                                 std::to_string(nJobs) + " gets no cluster; use fewer jobs");
+    }
+
+    // Files of the slice; entries before the last file shift its local range
+    loadedJobFileNames_.clear();
+    Long64_t offset = 0;
+    Long64_t bytes  = 0;
+    for (const auto* u : mine) {
+        if (loadedJobFileNames_.empty() || loadedJobFileNames_.back() != u->file) {
+            if (!loadedJobFileNames_.empty()) offset += index.find(loadedJobFileNames_.back())->entries;
+            loadedJobFileNames_.push_back(u->file);
+        }
+        bytes += u->bytes;
+    }
+    jobEntryRange_ = {mine.front()->first, offset + mine.back()->last};
+
+    std::cout << "Job " << loadedNthJob_ << " of " << nJobs << ": " << mine.size() << " of "
+              << units.size() << " clusters in " << loadedJobFileNames_.size() << " file(s), "
+              << bytes / (1024 * 1024) << " MB compressed, entries [" << jobEntryRange_.first
+              << ", " << jobEntryRange_.second << ")\n";
+}
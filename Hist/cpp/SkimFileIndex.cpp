@@ -0,0 +1,228 @@
+// cpp/SkimFileIndex.cpp
+#include "SkimFileIndex.h"
+
+#include <TBranch.h>
+#include <TFile.h>
+#include <TLeaf.h>
+#include <TObjArray.h>
+#include <TTree.h>
+#include <TUUID.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+#include <nlohmann/json.hpp>
+
+namespace fs = std::filesystem;
+using json = nlohmann::json;
+
+namespace {
+
+json toJson(const SkimFileIndex::Entry& e) {
+    return json{{"size", e.size},
+                {"entries", e.entries},
+                {"clusters", e.clusters},
+                {"clusterBytes", e.clusterBytes},
+                {"nano", e.nano},
+                {"uuid", e.uuid}};
+}
+
+SkimFileIndex::Entry fromJson(const json& j) {
+    SkimFileIndex::Entry e;
+    j.at("size").get_to(e.size);
+    j.at("entries").get_to(e.entries);
+    j.at("clusters").get_to(e.clusters);
+    if (j.contains("clusterBytes")) j.at("clusterBytes").get_to(e.clusterBytes);
+    j.at("nano").get_to(e.nano);
+    j.at("uuid").get_to(e.uuid);
+    return e;
+}
+
+json readJsonOrEmpty(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) return json::object();
+    try {
+        return json::parse(in);
+    } catch (const std::exception& e) {
+        std::cerr << "[SkimFileIndex] Ignoring unreadable index " << path << ": " << e.what() << '\n';
+        return json::object();
+    }
+}
+
+} // namespace
+
+SkimFileIndex::SkimFileIndex(const std::string& indexPath, const std::string& sampleKey) {
+    const json index = readJsonOrEmpty(indexPath);
+    if (!index.contains(sampleKey)) {
+        std::cout << "[SkimFileIndex] No entries for " << sampleKey << " in " << indexPath
+                  << " (files are validated on open)\n";
+        return;
+    }
+    for (const auto& item : index.at(sampleKey).items()) {
+        try {
+            entries_.emplace(item.key(), fromJson(item.value()));
+        } catch (const std::exception& e) {
+            throw std::runtime_error("SkimFileIndex::SkimFileIndex - bad entry for " + item.key() +
+                                     " in " + indexPath + ": " + e.what());
+        }
+    }
+    std::cout << "[SkimFileIndex] " << entries_.size() << " files of " << sampleKey
+              << " from " << indexPath << '\n';
+}
+
+const SkimFileIndex::Entry* SkimFileIndex::find(const std::string& path) const {
+    auto it = entries_.find(path);
+    return it == entries_.end() ? nullptr : &it->second;
+}
+
+bool SkimFileIndex::covers(const std::vector<std::string>& paths) const {
+    return std::all_of(paths.begin(), paths.end(),
+                       [this](const std::string& p) { return find(p) != nullptr; });
+}
+
+std::vector<SkimFileIndex::WorkUnit> SkimFileIndex::workUnits(const std::string& path, const Entry& e) {
+    std::vector<WorkUnit> units;
+    if (e.entries <= 0) return units;
+
+    std::vector<Long64_t> starts = e.clusters;
+    if (starts.empty() || starts.front() != 0) starts.insert(starts.begin(), 0);
+    const bool haveBytes = e.clusterBytes.size() == starts.size();
+
+    units.reserve(starts.size());
+    for (std::size_t i = 0; i < starts.size(); ++i) {
+        WorkUnit u;
+        u.file  = path;
+        u.first = starts[i];
+        u.last  = (i + 1 < starts.size()) ? starts[i + 1] : e.entries;
+        u.bytes = haveBytes ? e.clusterBytes[i] : e.size * (u.last - u.first) / e.entries;
+        units.push_back(std::move(u));
+    }
+    return units;
+}
+
+std::vector<Long64_t> SkimFileIndex::clusterStarts(TTree* tree) {
+    std::vector<Long64_t> starts;
+    const Long64_t entries = tree->GetEntries();
+    auto clusterIt = tree->GetClusterIterator(0);
+    for (Long64_t start = clusterIt(); start < entries; start = clusterIt()) {
+        starts.push_back(start);
+    }
+    return starts;
+}
+
+std::vector<Long64_t> SkimFileIndex::clusterBytes(TTree* tree, const std::vector<Long64_t>& starts) {
+    std::vector<Long64_t> bytes(starts.size(), 0);
+    if (starts.empty()) return bytes;
+
+    // Every leaf belongs to the (sub)branch that stores its baskets; a basket
+    // is counted in the cluster holding its first entry
+    TObjArray* leaves = tree->GetListOfLeaves();
+    const Int_t nLeaves = leaves ? leaves->GetEntriesFast() : 0;
+    std::vector<TBranch*> seen;
+    for (Int_t l = 0; l < nLeaves; ++l) {
+        TBranch* br = static_cast<TLeaf*>(leaves->UncheckedAt(l))->GetBranch();
+        if (!br || std::find(seen.begin(), seen.end(), br) != seen.end()) continue;
+        seen.push_back(br);
+
+        const Int_t     nBaskets    = br->GetWriteBasket();
+        const Long64_t* basketEntry = br->GetBasketEntry();
+        const Int_t*    basketBytes = br->GetBasketBytes();
+        for (Int_t b = 0; b < nBaskets; ++b) {
+            const auto it = std::upper_bound(starts.begin(), starts.end(), basketEntry[b]);
+            const std::size_t c = it == starts.begin() ? 0 : static_cast<std::size_t>(it - starts.begin() - 1);
+            bytes[c] += basketBytes[b];
+        }
+    }
+    return bytes;
+}
+
+std::string SkimFileIndex::indexPathFor(const std::string& filesSkimJsonPath) {
+    fs::path p(filesSkimJsonPath);
+    std::string name = p.filename().string();
+    const std::string prefix = "FilesSkim_";
+    if (name.rfind(prefix, 0) != 0) {
+        throw std::runtime_error("SkimFileIndex::indexPathFor - not a FilesSkim JSON: " + filesSkimJsonPath);
+    }
+    name.replace(0, prefix.size(), "FileIndex_");
+    return (p.parent_path() / name).string();
+}
+
+SkimFileIndex::Entry SkimFileIndex::readEntry(const std::string& path) {
+    Entry e;
+    std::unique_ptr<TFile> file(TFile::Open(path.c_str(), "READ"));
+    if (!file || file->IsZombie()) {
+        std::cerr << "[SkimFileIndex] Failed to open " << path << '\n';
+        return e;
+    }
+    e.size = file->GetSize();
+    e.uuid = file->GetUUID().AsString();
+    if (e.size < minFileSize) return e;
+
+    auto* tree = dynamic_cast<TTree*>(file->Get("Events"));
+    if (!tree) return e;
+
+    e.entries      = tree->GetEntries();
+    e.clusters     = clusterStarts(tree);
+    e.clusterBytes = clusterBytes(tree, e.clusters);
+
+    // NanoV9 stores counters as UInt_t, NanoV15 as Int_t
+    const TLeaf* nJet = tree->GetLeaf("nJet");
+    if (nJet) e.nano = std::string(nJet->GetTypeName()) == "UInt_t" ? "V9" : "V15";
+    return e;
+}
+
+int SkimFileIndex::buildIndexes(const std::vector<std::string>& filesSkimJsons, bool isDebug) {
+    for (const auto& skimJson : filesSkimJsons) {
+        std::cout << "\n=== Indexing " << skimJson << " ===\n";
+        const json samples = readJsonOrEmpty(skimJson);
+        const std::string indexPath = indexPathFor(skimJson);
+        json index = readJsonOrEmpty(indexPath);
+
+        for (const auto& sample : samples.items()) {
+            json& out = index[sample.key()];
+            if (!out.is_object()) out = json::object();
+
+            std::vector<std::string> files;
+            try {
+                sample.value().at(1).get_to(files);
+            } catch (const std::exception& e) {
+                std::cerr << "  Skipping " << sample.key() << ": " << e.what() << '\n';
+                continue;
+            }
+
+            std::size_t nNew = 0;
+            for (const auto& path : files) {
+                if (out.contains(path)) continue;
+                const Entry e = readEntry(path);
+                if (isDebug) {
+                    std::cout << "  " << path << ": " << e.entries << " entries, "
+                              << e.clusters.size() << " clusters, " << e.nano << '\n';
+                }
+                out[path] = toJson(e);
+                ++nNew;
+            }
+            std::cout << "  " << sample.key() << ": " << files.size() << " files, "
+                      << nNew << " newly indexed\n";
+        }
+
+        // Write to a temporary file, then rename over the old index
+        const std::string tmpName = indexPath + ".tmp";
+        {
+            std::ofstream out(tmpName, std::ios::trunc);
+            if (!out) {
+                throw std::runtime_error("SkimFileIndex::buildIndexes - cannot write " + tmpName);
+            }
+            out << index.dump(1);
+            if (!out) {
+                throw std::runtime_error("SkimFileIndex::buildIndexes - error writing " + tmpName);
+            }
+        }
+        fs::rename(tmpName, indexPath);
+        std::cout << "  -> " << indexPath << '\n';
+    }
+    return 0;
+}
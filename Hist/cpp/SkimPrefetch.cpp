@@ -0,0 +1,87 @@
+// cpp/SkimPrefetch.cpp
+#include "SkimPrefetch.h"
+
+#include <TEnv.h>
+#include <TFile.h>
+
+#include <algorithm>
+#include <iostream>
+
+SkimPrefetch::SkimPrefetch(int depth, bool debug)
+    : depth_(std::max(depth, 0))
+    , debug_(debug)
+{}
+
+SkimPrefetch::~SkimPrefetch() {
+    closePending_();
+    if (asyncPrefetchSet_) {
+        gEnv->SetValue("TFile.AsyncPrefetching", asyncPrefetchPrev_);
+    }
+}
+
+// Completes the opens the chain never picked up, so no request stays pending
+void SkimPrefetch::closePending_() {
+    for (const auto& [index, handle] : pending_) {
+        if (debug_) {
+            std::cout << "[SkimPrefetch] closing unused request #" << index << '\n';
+        }
+        delete TFile::Open(handle);
+    }
+    pending_.clear();
+}
+
+bool SkimPrefetch::isRemote(const std::string& path) {
+    return path.rfind("root://", 0) == 0;
+}
+
+void SkimPrefetch::setFiles(std::vector<std::string> files) {
+    closePending_();
+    files_      = std::move(files);
+    nextToOpen_ = 0;
+    if (depth_ == 0) return;
+
+    // Must be set before the chain opens its first file
+    if (!asyncPrefetchSet_ && std::any_of(files_.begin(), files_.end(), isRemote)) {
+        asyncPrefetchPrev_ = gEnv->GetValue("TFile.AsyncPrefetching", 0);
+        asyncPrefetchSet_  = true;
+        gEnv->SetValue("TFile.AsyncPrefetching", 1);
+        std::cout << "[SkimPrefetch] TFile.AsyncPrefetching switched on for this job\n";
+    }
+
+    std::cout << "[SkimPrefetch] opening up to " << depth_ << " remote file(s) ahead\n";
+    requestUpTo_(static_cast<std::size_t>(depth_));
+}
+
+void SkimPrefetch::onTreeSwitch(Int_t treeNumber) {
+    if (depth_ == 0 || treeNumber < 0) return;
+    // The chain opens tree `treeNumber` itself and consumes its handle; files
+    // before it were skipped (entry range) and their requests are closed
+    const auto reached = static_cast<std::size_t>(treeNumber);
+    std::vector<std::pair<std::size_t, TFileOpenHandle*>> ahead;
+    for (const auto& p : pending_) {
+        if (p.first > reached)       ahead.push_back(p);
+        else if (p.first < reached)  delete TFile::Open(p.second);
+    }
+    pending_.swap(ahead);
+    // Request the ones after it
+    nextToOpen_ = std::max(nextToOpen_, static_cast<std::size_t>(treeNumber) + 1);
+    requestUpTo_(static_cast<std::size_t>(treeNumber) + 1 + depth_);
+}
+
+void SkimPrefetch::requestUpTo_(std::size_t end) {
+    end = std::min(end, files_.size());
+    for (; nextToOpen_ < end; ++nextToOpen_) {
+        const std::string& path = files_[nextToOpen_];
+        if (!isRemote(path)) continue;
+        TFileOpenHandle* handle = TFile::AsyncOpen(path.c_str(), "READ");
+        if (!handle) {
+            std::cerr << "[SkimPrefetch] AsyncOpen failed for " << path
+                      << " (the chain will open it when reached)\n";
+            continue;
+        }
+        pending_.emplace_back(nextToOpen_, handle);
+        if (debug_) {
+            std::cout << "[SkimPrefetch] requested #" << nextToOpen_ << ": " << path << '\n';
+        }
+    }
+}
@@ -1,6 +1,9 @@
 // cpp/SkimReader.cpp
 #include "SkimReader.h"
 
+#include <TTree.h>
+#include <TUUID.h>
+
 #include <iostream>
 #include <stdexcept>
 
@@ -23,6 +26,7 @@ SkimReader::SkimReader(GlobalFlag& flags, SkimBranch& branches)
     , skimAdapter_(globalFlags_, skimBranch_)
     , hlt_(flags)
     , skimCache_(hlt_, isDebug_)
+    , skimPrefetch_(flags.getPrefetchFiles(), isDebug_)
 {
 }
 
@@ -64,8 +68,9 @@ TFile* SkimReader::validateAndOpenFile_(const std::string& fullPath) {
     return file;
 }
 
-bool SkimReader::addFileToChain_(const std::string& fullPath) {
-    int added = chain_->Add(fullPath.c_str());
+bool SkimReader::addFileToChain_(const std::string& fullPath, Long64_t nEntries) {
+    // With nEntries > 0 TChain does not open the file until it is read
+    int added = chain_->Add(fullPath.c_str(), nEntries);
     if (added == 0) {
         std::cerr << "Warning: TChain::Add failed for " << fullPath << '\n';
         return false;
@@ -73,8 +78,10 @@ bool SkimReader::addFileToChain_(const std::string& fullPath) {
     return true;
 }
 
-// Build TChain from file list; returns false if no valid trees
-bool SkimReader::buildChain_(const std::vector<std::string>& files) {
+// Build TChain from file list; returns false if no valid trees.
+// Every file is added with its entry count, so the chain knows the entry
+// offsets without another pass over the files.
+bool SkimReader::buildChain_(const std::vector<std::string>& files, const SkimFileIndex* index) {
     std::cout << "==> loadTree()" << '\n';
 
     if (!chain_) {
@@ -86,48 +93,109 @@ bool SkimReader::buildChain_(const std::vector<std::string>& files) {
         throw std::runtime_error("SkimReader::buildChain_ - no files to load");
     }
 
-    int totalFiles  = 0;
-    int addedFiles  = 0;
-    int failedFiles = 0;
+    const std::string nanoStr = (nanoVer_ == GlobalFlag::NanoVersion::V9) ? "V9" : "V15";
+
+    int totalFiles   = 0;
+    int addedFiles   = 0;
+    int indexedFiles = 0;
+    int failedFiles  = 0;
+    Long64_t totalEntries = 0;
+    indexedTrees_.clear();
+    workUnits_.clear();
+    std::vector<std::string> chainFiles;
 
     for (const auto& fName : files) {
         totalFiles++;
         const std::string& fullPath = fName;
         std::cout << fullPath << '\n';
 
-        TFile* file = validateAndOpenFile_(fullPath);
-        if (!file) {
-            failedFiles++;
-            continue;
+        IndexedTree indexed;
+        Long64_t nEntries = 0;
+        std::vector<SkimFileIndex::WorkUnit> units;
+        if (const SkimFileIndex::Entry* e = index ? index->find(fullPath) : nullptr) {
+            if (e->entries <= 0) {
+                std::cerr << "Warning: " << fullPath << " is indexed as unusable, skipping.\n";
+                failedFiles++;
+                continue;
+            }
+            if (!e->nano.empty() && e->nano != nanoStr) {
+                throw std::runtime_error("SkimReader::buildChain_ - " + fullPath + " is Nano" + e->nano +
+                                         " but the job expects Nano" + nanoStr);
+            }
+            nEntries = e->entries;
+            indexed.entries = e->entries;
+            indexed.uuid    = e->uuid;
+            units = SkimFileIndex::workUnits(fullPath, *e);
+            indexedFiles++;
+        } else {
+            TFile* file = validateAndOpenFile_(fullPath);
+            if (!file) {
+                failedFiles++;
+                continue;
+            }
+            // No cluster scan here: the file becomes a single unit
+            nEntries = static_cast<TTree*>(file->Get("Events"))->GetEntries();
+            if (nEntries > 0) {
+                SkimFileIndex::WorkUnit whole;
+                whole.file  = fullPath;
+                whole.last  = nEntries;
+                whole.bytes = file->GetSize();
+                units.push_back(std::move(whole));
+            }
+            file->Close();
         }
-        if (!addFileToChain_(fullPath)) {
+
+        if (!addFileToChain_(fullPath, nEntries)) {
             failedFiles++;
-            file->Close();
             continue;
         }
-
-        std::cout << "Total Entries: " << chain_->GetEntries() << '\n';
+        indexedTrees_.push_back(std::move(indexed));
+        chainFiles.push_back(fullPath);
+        for (auto& u : units) {
+            u.first += totalEntries;
+            u.last  += totalEntries;
+            workUnits_.push_back(std::move(u));
+        }
+        totalEntries += nEntries;
         addedFiles++;
-        file->Close();
     }
 
     std::cout << "==> Finished loading files.\n";
     std::cout << "Total files processed: "   << totalFiles  << '\n';
-    std::cout << "Successfully added files: " << addedFiles << '\n';
+    std::cout << "Successfully added files: " << addedFiles << " (" << indexedFiles << " from the file index)\n";
     std::cout << "Failed to add files: "      << failedFiles << '\n';
+    std::cout << "Total Entries: "           << totalEntries << '\n';
 
     if (chain_->GetNtrees() == 0) {
         std::cerr << "Error: No valid ROOT files were added to the TChain. Exiting.\n";
         return false;
     }
+    skimPrefetch_.setFiles(std::move(chainFiles));
     return true;
 }
 
+void SkimReader::checkIndexedTree_(Int_t treeNumber) const {
+    if (treeNumber < 0 || treeNumber >= static_cast<Int_t>(indexedTrees_.size())) return;
+    const IndexedTree& expected = indexedTrees_[treeNumber];
+    if (expected.entries < 0) return;
+
+    const TTree* tree = chain_->GetTree();
+    const TFile* cur  = chain_->GetCurrentFile();
+    const Long64_t entries = tree ? tree->GetEntries() : -1;
+    const std::string uuid = cur ? cur->GetUUID().AsString() : std::string();
+    if (entries != expected.entries || (!expected.uuid.empty() && uuid != expected.uuid)) {
+        throw std::runtime_error("SkimReader::getEntry - " + std::string(cur ? cur->GetName() : "<unknown>") +
+                                 " changed since it was indexed (entries " + std::to_string(entries) +
+                                 " vs " + std::to_string(expected.entries) +
+                                 "); remove it from the FileIndex JSON and rerun runMain -x");
+    }
+}
+
 // -------------------------------------------------------------
 // Public loadTree
 // -------------------------------------------------------------
-void SkimReader::loadTree(const std::vector<std::string>& files) {
-    if (!buildChain_(files)) {
+void SkimReader::loadTree(const std::vector<std::string>& files, const SkimFileIndex* index) {
+    if (!buildChain_(files, index)) {
         throw std::runtime_error("SkimReader::loadTree - failed to build chain");
     }
     setupBranches_();
@@ -165,17 +233,33 @@ void SkimReader::setupBranches_() {
 // Basic tree operations
 // -------------------------------------------------------------
 Long64_t SkimReader::getEntries() const {
-    return chain_ ? chain_->GetEntries() : 0;
+    if (!chain_) return 0;
+    const Long64_t last = lastEntry_ < 0 ? chain_->GetEntries() : lastEntry_;
+    return last - firstEntry_;
+}
+
+void SkimReader::setEntryRange(Long64_t first, Long64_t last) {
+    const Long64_t total = chain_ ? chain_->GetEntries() : 0;
+    if (first < 0 || last < first || last > total) {
+        throw std::runtime_error("SkimReader::setEntryRange - [" + std::to_string(first) + ", " +
+                                 std::to_string(last) + ") outside the chain of " +
+                                 std::to_string(total) + " entries");
+    }
+    firstEntry_ = first;
+    lastEntry_  = last;
+    std::cout << "[SkimReader] entry range [" << first << ", " << last << ") of " << total << '\n';
 }
 
 Int_t SkimReader::getEntry(Long64_t entry) {
-    Int_t ret = chain_ ? chain_->GetEntry(entry) : 0;
+    Int_t ret = chain_ ? chain_->GetEntry(firstEntry_ + entry) : 0;
 
     // Convert v15 types to canonical representation
     skimAdapter_.afterGetEntry();
 
     if (chain_->GetTreeNumber() != currentTree_) {
         currentTree_ = chain_->GetTreeNumber();
+        checkIndexedTree_(currentTree_);
+        skimPrefetch_.onTreeSwitch(currentTree_);
         const TFile* cur = chain_->GetCurrentFile();
         const char* name = cur ? cur->GetName() : "<unknown>";
         std::cout << "[Events] Switched to file #" << currentTree_
@@ -186,6 +270,21 @@ Int_t SkimReader::getEntry(Long64_t entry) {
     return ret;
 }
 
+bool SkimReader::readRunLumi(Long64_t entry) {
+    const Long64_t local = chain_ ? chain_->LoadTree(firstEntry_ + entry) : -1;
+    if (local < 0) return false;
+
+    // LoadTree has set the chain's branch addresses on the new tree
+    if (chain_->GetTreeNumber() != runLumiTree_) {
+        runLumiTree_ = chain_->GetTreeNumber();
+        TTree* tree  = chain_->GetTree();
+        runBranch_   = tree->GetBranch("run");
+        lumiBranch_  = tree->GetBranch("luminosityBlock");
+    }
+    if (!runBranch_ || !lumiBranch_) return false;
+    return runBranch_->GetEntry(local) > 0 && lumiBranch_->GetEntry(local) > 0;
+}
+
 // -------------------------------------------------------------
 // HLT façade
 // -------------------------------------------------------------
@@ -1,6 +1,8 @@
 // cpp/SkimTree.cpp
 #include "SkimTree.h"
 
+#include <algorithm>
+
 // -------------------------------------------------------------
 // Constructor / Destructor
 // -------------------------------------------------------------
@@ -24,11 +26,33 @@ TChain* SkimTree::getChain() const {
 }
 
 Int_t SkimTree::getEntry(Long64_t entry) {
-    return skimReader_.getEntry(entry);
+    hasJetQualityMask = false; // jets change with the entry
+    const Int_t ret = skimReader_.getEntry(entry);
+    resetJetView();
+    return ret;
+}
+
+bool SkimTree::readRunLumi(Long64_t entry) {
+    return skimReader_.readRunLumi(entry);
 }
 
-void SkimTree::loadTree(const std::vector<std::string>& skimFileList) {
-    skimReader_.loadTree(skimFileList);
+void SkimTree::setEntryRange(Long64_t first, Long64_t last) {
+    skimReader_.setEntryRange(first, last);
+}
+
+const std::vector<SkimFileIndex::WorkUnit>& SkimTree::getWorkUnits() const {
+    return skimReader_.workUnits();
+}
+
+void SkimTree::resetJetView() {
+    const std::size_t n = std::min<std::size_t>(nJet, nJetMax);
+    std::copy_n(Jet_ptNano,   n, Jet_pt);
+    std::copy_n(Jet_massNano, n, Jet_mass);
+}
+
+void SkimTree::loadTree(const std::vector<std::string>& skimFileList,
+                        const SkimFileIndex* fileIndex) {
+    skimReader_.loadTree(skimFileList, fileIndex);
 }
 
 // -------------------------------------------------------------
@@ -47,3 +71,7 @@ Bool_t SkimTree::getTrigValue(const std::string& trigName) const {
     return skimReader_.getTrigValue(trigName) ? Bool_t{1} : Bool_t{0};
 }
 
+Hlt::TrigMask SkimTree::getTrigMask() const {
+    return skimReader_.trigMask();
+}
+
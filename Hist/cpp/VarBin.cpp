@@ -1,4 +1,5 @@
 #include "VarBin.h"
+#include "ResourceCache.h"
 #include <iostream>
 #include <fstream>
 #include <string>
@@ -29,55 +30,56 @@ VarBin::VarBin(const GlobalFlag& globalFlags)
 
 void VarBin::InitializeBins() {
     // Open and parse the JSON configuration file for VarBin settings.
-    std::ifstream ifs("config/VarBin.json");
-    if (!ifs.is_open()) {
+    // Parsed once per process (ResourceCache); read through a const reference.
+    std::shared_ptr<const json> jPtr;
+    try {
+        jPtr = ResourceCache::json("config/VarBin.json");
+    } catch (const std::runtime_error&) {
         std::cerr << "Error: Could not open config/VarBin.json" << std::endl;
         return;
-    }
-    json j;
-    try {
-        ifs >> j;
     } catch (json::parse_error& e) {
         std::cerr << "JSON parse error in VarBin: " << e.what() << std::endl;
         return;
     }
 
+    const json& j = *jPtr;
+
     // Use getChannelStr() from GlobalFlag to select the channel configuration.
     std::string channelStr = globalFlags_.getChannelStr();
 
     // Set binsPt_ based on channel
-    if (j["channels"].contains(channelStr)) {
-        binsPt_ = j["channels"][channelStr]["binsPt"].get<std::vector<double>>();
+    if (j.at("channels").contains(channelStr)) {
+        binsPt_ = j.at("channels").at(channelStr).at("binsPt").get<std::vector<double>>();
         // For GamJet, if a binsMass override is provided, use it.
         if (channel_ == GlobalFlag::Channel::GamJet &&
-            j["channels"][channelStr].contains("binsMass")) {
-            binsMass_ = j["channels"][channelStr]["binsMass"].get<std::vector<double>>();
+            j.at("channels").at(channelStr).contains("binsMass")) {
+            binsMass_ = j.at("channels").at(channelStr).at("binsMass").get<std::vector<double>>();
         }
     } else {
-        binsPt_ = j["channels"]["default"]["binsPt"].get<std::vector<double>>();
+        binsPt_ = j.at("channels").at("default").at("binsPt").get<std::vector<double>>();
     }
 
     // Global bin arrays
-    binsEta_ = j["binsEta"].get<std::vector<double>>();
-    binsPhi_ = j["binsPhi"].get<std::vector<double>>();  
-    binsRho_ = j["binsRho"].get<std::vector<double>>();  
-    binsAlpha_ = j["binsAlpha"].get<std::vector<double>>();  
+    binsEta_ = j.at("binsEta").get<std::vector<double>>();
+    binsPhi_ = j.at("binsPhi").get<std::vector<double>>();  
+    binsRho_ = j.at("binsRho").get<std::vector<double>>();  
+    binsAlpha_ = j.at("binsAlpha").get<std::vector<double>>();  
     // For binsPhiRebin, if the JSON entry is "same_as_binsPhi", copy binsPhi_
-    if (j["binsPhiRebin"].is_string()) {
-        std::string s = j["binsPhiRebin"].get<std::string>();
+    if (j.at("binsPhiRebin").is_string()) {
+        std::string s = j.at("binsPhiRebin").get<std::string>();
         if (s == "same_as_binsPhi") {
             binsPhiRebin_ = binsPhi_;
         }
     } else {
-        binsPhiRebin_ = j["binsPhiRebin"].get<std::vector<double>>();
+        binsPhiRebin_ = j.at("binsPhiRebin").get<std::vector<double>>();
     }
     // Use global binsMass if not set already
     if (binsMass_.empty()) {
-        binsMass_ = j["binsMass"].get<std::vector<double>>();
+        binsMass_ = j.at("binsMass").get<std::vector<double>>();
     }
 
     // Use helper getRange() to load fixed-width ranges.
-    json ranges = j["ranges"];
+    const json& ranges = j.at("ranges");
     rangePt_       = getRange<int, double>(ranges, "rangePt");
     rangeEta_      = getRange<int, double>(ranges, "rangeEta");
     rangePhi_      = getRange<int, double>(ranges, "rangePhi");
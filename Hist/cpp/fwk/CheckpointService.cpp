@@ -0,0 +1,202 @@
+#include "fwk/CheckpointService.h"
+
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <sys/stat.h>
+
+#include <TClass.h>
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TH1.h>
+#include <TKey.h>
+#include <TList.h>
+#include <TParameter.h>
+
+#include "fwk/Context.h"
+#include "fwk/CutflowService.h"
+#include "fwk/OutputService.h"
+
+namespace fwk {
+
+namespace {
+// Bookkeeping directory inside the sidecar; never part of the histogram tree.
+constexpr const char* kMetaDir = "fwkCheckpoint";
+
+bool fileExists(const std::string& p) {
+    struct stat st;
+    return ::stat(p.c_str(), &st) == 0;
+}
+} // namespace
+
+CheckpointService::CheckpointService(std::string path, double everySeconds, bool resume)
+    : path_(std::move(path))
+    , everySeconds_(everySeconds)
+    , resume_(resume)
+    , last_(std::chrono::steady_clock::now()) {}
+
+std::string CheckpointService::defaultPath(const std::string& outDir, const std::string& ioName) {
+    return outDir + "/" + ioName + ".ckpt";
+}
+
+long long CheckpointService::restore(Context& ctx) {
+    last_ = std::chrono::steady_clock::now();
+    if (!resume_) {
+        return 0;
+    }
+    if (!fileExists(path_)) {
+        std::cout << "[CheckpointService] no checkpoint at " << path_ << ", starting from entry 0\n";
+        return 0;
+    }
+
+    TDirectory::TContext dirGuard;
+    std::unique_ptr<TFile> fin(TFile::Open(path_.c_str(), "READ"));
+    if (!fin || fin->IsZombie()) {
+        throw std::runtime_error("CheckpointService::restore - cannot open " + path_);
+    }
+
+    TDirectory* meta = fin->GetDirectory(kMetaDir);
+    auto* pNext    = meta ? meta->Get<TParameter<Long64_t>>("nextEntry") : nullptr;
+    auto* pEntries = meta ? meta->Get<TParameter<Long64_t>>("nEntries")  : nullptr;
+    if (!pNext || !pEntries) {
+        throw std::runtime_error("CheckpointService::restore - missing bookkeeping in " + path_);
+    }
+
+    const long long nEntries = ctx.skimT->getEntries();
+    if (pEntries->GetVal() != nEntries) {
+        throw std::runtime_error("CheckpointService::restore - checkpoint was taken on " +
+                                 std::to_string(pEntries->GetVal()) + " entries, chain has " +
+                                 std::to_string(nEntries) + " (different input list?)");
+    }
+
+    addDir_(fin.get(), ctx.out->file());
+
+    if (ctx.cutflow) {
+        if (TDirectory* cf = meta->GetDirectory("cutflow")) {
+            TIter next(cf->GetListOfKeys());
+            while (auto* key = static_cast<TKey*>(next())) {
+                std::unique_ptr<TParameter<double>> p(
+                    dynamic_cast<TParameter<double>*>(key->ReadObj()));
+                if (p) ctx.cutflow->fill(p->GetName(), p->GetVal());
+            }
+        }
+    }
+
+    const long long nextEntry = pNext->GetVal();
+    std::cout << "[CheckpointService] resumed from " << path_
+              << " at entry " << nextEntry << " / " << nEntries << '\n';
+    return nextEntry;
+}
+
+void CheckpointService::maybeWrite(Context& ctx, long long nextEntry) {
+    if (++nSinceCheck_ < kCheckEvery) {
+        return;
+    }
+    nSinceCheck_ = 0;
+
+    const auto now = std::chrono::steady_clock::now();
+    if (std::chrono::duration<double>(now - last_).count() < everySeconds_) {
+        return;
+    }
+    write(ctx, nextEntry);
+}
+
+void CheckpointService::write(Context& ctx, long long nextEntry) {
+    const std::string tmp = path_ + ".tmp";
+
+    {
+        TDirectory::TContext dirGuard;
+        std::unique_ptr<TFile> fck(TFile::Open(tmp.c_str(), "RECREATE"));
+        if (!fck || fck->IsZombie()) {
+            throw std::runtime_error("CheckpointService::write - cannot create " + tmp);
+        }
+
+        copyDir_(ctx.out->file(), fck.get());
+
+        TDirectory* meta = fck->mkdir(kMetaDir);
+        TParameter<Long64_t> pNext("nextEntry", nextEntry);
+        TParameter<Long64_t> pEntries("nEntries", ctx.skimT->getEntries());
+        meta->WriteTObject(&pNext);
+        meta->WriteTObject(&pEntries);
+
+        if (ctx.cutflow) {
+            TDirectory* cf = meta->mkdir("cutflow");
+            for (const auto& [cut, w] : ctx.cutflow->counts()) {
+                TParameter<double> p(cut.c_str(), w);
+                cf->WriteTObject(&p);
+            }
+        }
+        fck->Close();
+    }
+
+    // rename(2) is atomic within a filesystem: readers see old or new, never partial.
+    if (std::rename(tmp.c_str(), path_.c_str()) != 0) {
+        throw std::runtime_error("CheckpointService::write - rename failed: " + tmp + " -> " + path_);
+    }
+
+    last_ = std::chrono::steady_clock::now();
+    ++nWritten_;
+    std::cout << "[CheckpointService] checkpoint #" << nWritten_
+              << " at entry " << nextEntry << " -> " << path_ << '\n';
+}
+
+void CheckpointService::finish() {
+    if (fileExists(path_)) {
+        std::remove(path_.c_str());
+    }
+}
+
+// Mirror the in-memory objects of `mem` (histograms still attached to their
+// directories, not yet written) into `out`.
+void CheckpointService::copyDir_(TDirectory* mem, TDirectory* out) {
+    TIter next(mem->GetList());
+    while (TObject* obj = next()) {
+        if (auto* sub = dynamic_cast<TDirectory*>(obj)) {
+            TDirectory* outSub = out->GetDirectory(sub->GetName());
+            if (!outSub) outSub = out->mkdir(sub->GetName());
+            copyDir_(sub, outSub);
+        } else if (obj->InheritsFrom(TH1::Class())) {
+            out->WriteTObject(obj, obj->GetName(), "Overwrite");
+        }
+    }
+}
+
+// Add every histogram of the sidecar onto its freshly booked twin.
+void CheckpointService::addDir_(TDirectory* ckpt, TDirectory* mem) {
+    TIter next(ckpt->GetListOfKeys());
+    while (auto* key = static_cast<TKey*>(next())) {
+        const std::string name = key->GetName();
+        if (name == kMetaDir) continue;
+
+        TClass* cl = TClass::GetClass(key->GetClassName());
+        if (!cl) continue;
+
+        if (cl->InheritsFrom(TDirectory::Class())) {
+            TDirectory* memSub = mem->GetDirectory(name.c_str());
+            TDirectory* ckSub  = ckpt->GetDirectory(name.c_str());
+            if (!memSub || !ckSub) {
+                std::cerr << "[CheckpointService] directory " << name
+                          << " not booked in this job; skipped\n";
+                continue;
+            }
+            addDir_(ckSub, memSub);
+            continue;
+        }
+
+        if (!cl->InheritsFrom(TH1::Class())) continue;
+
+        std::unique_ptr<TH1> saved(static_cast<TH1*>(key->ReadObj()));
+        saved->SetDirectory(nullptr);
+
+        auto* booked = dynamic_cast<TH1*>(mem->GetList()->FindObject(name.c_str()));
+        if (!booked) {
+            std::cerr << "[CheckpointService] histogram " << mem->GetPath() << "/" << name
+                      << " not booked in this job; skipped\n";
+            continue;
+        }
+        booked->Add(saved.get());
+    }
+}
+
+} // namespace fwk
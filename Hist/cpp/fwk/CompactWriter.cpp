@@ -0,0 +1,250 @@
+#include "fwk/CompactWriter.h"
+
+#include <iostream>
+#include <memory>
+
+#include <Compression.h>
+#include <TArrayD.h>
+#include <TAxis.h>
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TH1.h>
+#include <THnSparse.h>
+#include <TKey.h>
+#include <TList.h>
+#include <TProfile2D.h>
+#include <TTree.h>
+
+namespace fwk {
+
+namespace {
+
+using ROOT::RCompressionSetting::EAlgorithm;
+
+// 1D objects are small and read often; 2D and sparse objects are large and
+// mostly zeros, where LZMA wins clearly over the file default.
+const int kCompress1D     = ROOT::CompressionSettings(EAlgorithm::kZSTD, 5);
+const int kCompress2D     = ROOT::CompressionSettings(EAlgorithm::kLZMA, 8);
+const int kCompressSparse = ROOT::CompressionSettings(EAlgorithm::kLZMA, 8);
+const int kCompressIndex  = ROOT::CompressionSettings(EAlgorithm::kZLIB, 1);
+
+// Moment slots on the third axis of a sparse profile.
+enum Moment : int { kSumW = 1, kSumWY, kSumWY2, kSumW2, kNMoment = kSumW2 };
+
+// Remove every cycle of `name` already on disk (e.g. from a legacy Run() loop
+// that called TFile::Write itself).
+void deleteKeys(TDirectory* dir, const char* name) {
+    while (TKey* key = dir->GetKey(name)) {
+        key->Delete();
+        delete key;
+    }
+}
+
+void copyAxis(const TAxis& from, TAxis& to) {
+    if (from.GetXbins()->GetSize() > 0) {
+        to.Set(from.GetNbins(), from.GetXbins()->GetArray());
+    }
+    to.SetTitle(from.GetTitle());
+}
+
+} // namespace
+
+CompactWriter::CompactWriter(TFile* fout)
+    : fout_(fout) {}
+
+int CompactWriter::write() {
+    const int fileSettings = fout_->GetCompressionSettings();
+    rows_.clear();
+    nSkipped_ = 0;
+    nSparse_ = 0;
+
+    writeDir_(fout_, "");
+    writeIndex_();
+
+    fout_->SetCompressionSettings(fileSettings);
+    std::cout << "[CompactWriter] wrote " << rows_.size() << " objects ("
+              << nSparse_ << " sparse profiles), skipped " << nSkipped_
+              << " empty -> " << fout_->GetName() << '\n';
+    return static_cast<int>(rows_.size());
+}
+
+void CompactWriter::writeDir_(TDirectory* dir, const std::string& prefix) {
+    // Writing adds keys, not list entries, but stay independent of TList order.
+    std::vector<TObject*> objs;
+    TIter next(dir->GetList());
+    while (TObject* obj = next()) objs.push_back(obj);
+
+    for (TObject* obj : objs) {
+        const char* name = obj->GetName();
+
+        if (auto* sub = dynamic_cast<TDirectory*>(obj)) {
+            writeDir_(sub, prefix + name + "/");
+            continue;
+        }
+
+        auto* h = dynamic_cast<TH1*>(obj);
+        if (!h) {
+            fout_->SetCompressionSettings(kCompress1D);
+            dir->WriteTObject(obj, name, "Overwrite");
+            continue;
+        }
+
+        if (h->GetEntries() == 0) {
+            deleteKeys(dir, name);
+            ++nSkipped_;
+            continue;
+        }
+
+        Row row;
+        row.path = prefix + name;
+        row.cls = h->ClassName();
+        row.stored = row.cls;
+        row.entries = h->GetEntries();
+        row.cells = h->GetNcells();
+
+        if (auto* p = dynamic_cast<TProfile2D*>(h)) {
+            for (int bin = 0; bin < row.cells; ++bin) {
+                if (p->GetBinEntries(bin) != 0.0) ++row.filled;
+            }
+            if (row.filled <= kMaxSparseOccupancy * row.cells) {
+                std::unique_ptr<THnSparse> s(toSparse(*p));
+                deleteKeys(dir, name);
+                fout_->SetCompressionSettings(kCompressSparse);
+                dir->WriteTObject(s.get(), name, "Overwrite");
+                row.stored = s->ClassName();
+                rows_.push_back(std::move(row));
+                ++nSparse_;
+                continue;
+            }
+        } else {
+            for (int bin = 0; bin < row.cells; ++bin) {
+                if (h->GetBinContent(bin) != 0.0) ++row.filled;
+            }
+        }
+
+        fout_->SetCompressionSettings(h->GetDimension() >= 2 ? kCompress2D : kCompress1D);
+        dir->WriteTObject(h, name, "Overwrite");
+        rows_.push_back(std::move(row));
+    }
+}
+
+void CompactWriter::writeIndex_() {
+    TDirectory::TContext dirGuard(fout_);
+    fout_->SetCompressionSettings(kCompressIndex);
+
+    std::string path, cls, stored;
+    double entries = 0.0;
+    int filled = 0;
+    int cells = 0;
+
+    TTree index(kIndexName, "CompactWriter object index");
+    index.Branch("path", &path);
+    index.Branch("cls", &cls);
+    index.Branch("stored", &stored);
+    index.Branch("entries", &entries);
+    index.Branch("filled", &filled);
+    index.Branch("cells", &cells);
+
+    for (const auto& r : rows_) {
+        path = r.path;
+        cls = r.cls;
+        stored = r.stored;
+        entries = r.entries;
+        filled = r.filled;
+        cells = r.cells;
+        index.Fill();
+    }
+    index.Write("", TObject::kOverwrite);
+    index.SetDirectory(nullptr);
+}
+
+THnSparse* CompactWriter::toSparse(const TProfile2D& p) {
+    const TAxis* ax = p.GetXaxis();
+    const TAxis* ay = p.GetYaxis();
+    const int nx = ax->GetNbins();
+    const int ny = ay->GetNbins();
+
+    Int_t    nbins[3] = {nx, ny, kNMoment};
+    Double_t xmin[3]  = {ax->GetXmin(), ay->GetXmin(), 0.5};
+    Double_t xmax[3]  = {ax->GetXmax(), ay->GetXmax(), kNMoment + 0.5};
+
+    auto* s = new THnSparseD(p.GetName(),
+                             (std::string(kSparseTitlePrefix) + p.GetTitle()).c_str(),
+                             3, nbins, xmin, xmax);
+    copyAxis(*ax, *s->GetAxis(0));
+    copyAxis(*ay, *s->GetAxis(1));
+
+    const TArrayD* sumWY2 = p.GetSumw2();
+    const TArrayD* sumW2  = p.GetBinSumw2();
+    const Double_t* sumWY = p.GetArray();
+
+    Int_t idx[3];
+    auto put = [&](int moment, double v) {
+        if (v == 0.0) return;
+        idx[2] = moment;
+        s->SetBinContent(idx, v);
+    };
+
+    for (int iy = 0; iy <= ny + 1; ++iy) {
+        for (int ix = 0; ix <= nx + 1; ++ix) {
+            const int bin = p.GetBin(ix, iy);
+            const double w = p.GetBinEntries(bin);
+            if (w == 0.0 && sumWY[bin] == 0.0) continue;
+            idx[0] = ix;
+            idx[1] = iy;
+            put(kSumW, w);
+            put(kSumWY, sumWY[bin]);
+            if (sumWY2 && sumWY2->GetSize() > bin) put(kSumWY2, sumWY2->At(bin));
+            if (sumW2  && sumW2->GetSize()  > bin) put(kSumW2,  sumW2->At(bin));
+        }
+    }
+    s->SetEntries(p.GetEntries());
+    return s;
+}
+
+bool CompactWriter::isSparseProfile(const THnSparse& s) {
+    const std::string title = s.GetTitle();
+    return s.GetNdimensions() == 3 && title.rfind(kSparseTitlePrefix, 0) == 0;
+}
+
+TProfile2D* CompactWriter::toProfile2D(const THnSparse& s) {
+    if (!isSparseProfile(s)) {
+        return nullptr;
+    }
+    const TAxis* ax = s.GetAxis(0);
+    const TAxis* ay = s.GetAxis(1);
+    const std::string title = std::string(s.GetTitle()).substr(std::string(kSparseTitlePrefix).size());
+
+    TDirectory::TContext dirGuard(nullptr);
+    auto* p = new TProfile2D(s.GetName(), title.c_str(),
+                             ax->GetNbins(), ax->GetXmin(), ax->GetXmax(),
+                             ay->GetNbins(), ay->GetXmin(), ay->GetXmax());
+    p->SetDirectory(nullptr);
+    copyAxis(*ax, *p->GetXaxis());
+    copyAxis(*ay, *p->GetYaxis());
+
+    Int_t idx[3];
+    bool hasSumW2 = false;
+    for (Long64_t i = 0; i < s.GetNbins(); ++i) {
+        s.GetBinContent(i, idx);
+        if (idx[2] == kSumW2) { hasSumW2 = true; break; }
+    }
+    if (hasSumW2) p->Sumw2();
+
+    for (Long64_t i = 0; i < s.GetNbins(); ++i) {
+        const double v = s.GetBinContent(i, idx);
+        const int bin = p->GetBin(idx[0], idx[1]);
+        switch (idx[2]) {
+            case kSumW:   p->SetBinEntries(bin, v); break;
+            case kSumWY:  p->GetArray()[bin] = v; break;
+            case kSumWY2: p->GetSumw2()->fArray[bin] = v; break;
+            case kSumW2:  p->GetBinSumw2()->fArray[bin] = v; break;
+            default: break;
+        }
+    }
+    p->ResetStats();
+    p->SetEntries(s.GetEntries());
+    return p;
+}
+
+} // namespace fwk
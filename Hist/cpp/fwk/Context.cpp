@@ -1,8 +1,11 @@
 #include "fwk/Context.h"
 
+#include "fwk/CheckpointService.h"
 #include "fwk/ConfigService.h"
 #include "fwk/CutflowService.h"
+#include "fwk/EventCacheService.h"
 #include "fwk/LoggerService.h"
+#include "fwk/LumiBlockService.h"
 #include "fwk/OutputService.h"
 #include "fwk/TimerService.h"
 
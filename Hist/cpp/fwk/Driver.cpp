@@ -1,36 +1,102 @@
 #include "fwk/Driver.h"
 
+#include <iostream>
+#include <stdexcept>
+
+#include "fwk/CheckpointService.h"
 #include "fwk/Event.h"
+#include "fwk/EventCacheService.h"
+#include "fwk/LumiBlockService.h"
 #include "fwk/OutputService.h"
+#include "fwk/TimerService.h"
 
 namespace fwk {
 
 int Driver::run(Context& ctx, ModuleChain& chain) {
+    // Refuse -k/-K up front: a silently dropped checkpoint leaves a preemptible
+    // job believing it can resume.
+    if (ctx.checkpoint && !chain.supportsCheckpoint()) {
+        throw std::runtime_error("Driver::run - module chain runs its own event loop and cannot"
+                                 " checkpoint; -k/-K are supported only for ZmmJet L3Residual");
+    }
+
     chain.beginJob(ctx);
     chain.beginFile(ctx);
+    if (ctx.eventCache) {
+        ctx.eventCache->beginJob(ctx);
+    }
+
+    if (ctx.lumiBlocks && !chain.supportsCheckpoint()) {
+        ctx.lumiBlocks.reset();
+    }
+
+    // Histograms are booked (empty) by now; a resume adds the snapshot onto them.
+    const long long firstEntry = ctx.checkpoint ? ctx.checkpoint->restore(ctx) : 0;
 
     const long long nentries = ctx.skimT->getEntries();
+    if (ctx.timer) {
+        ctx.timer->start("driver:eventLoop");
+    }
     Event ev;
-    for (long long jentry = 0; jentry < nentries; ++jentry) {
+    for (long long jentry = firstEntry; jentry < nentries; ++jentry) {
         if (ctx.gf.isDebug() && jentry > ctx.gf.getNDebug()) {
             break;
         }
 
+        if (ctx.lumiBlocks) {
+            const LumiBlock& block = ctx.lumiBlocks->at(*ctx.skimT, jentry);
+            if (!block.passGoodLumi && ctx.lumiBlocks->skipsBadBlocks()) {
+                ctx.lumiBlocks->noteSkipped();
+                if (ctx.checkpoint) {
+                    ctx.checkpoint->maybeWrite(ctx, jentry + 1);
+                }
+                continue;
+            }
+            ev.block = &block;
+        }
+
         ctx.skimT->getEntry(jentry);
         ev.entry = jentry;
         ev.run = ctx.skimT->run;
         ev.lumi = ctx.skimT->luminosityBlock;
         ev.event = ctx.skimT->event;
+        ev.products.clear();
+
+        // Cache the uncorrected inputs before modules touch the jets.
+        if (ctx.eventCache) {
+            ctx.eventCache->fill(ctx);
+        }
 
         if (!chain.analyze(ctx, ev)) {
             break;
         }
+
+        if (ctx.checkpoint) {
+            ctx.checkpoint->maybeWrite(ctx, jentry + 1);
+        }
+    }
+
+    if (ctx.timer) {
+        ctx.timer->stop("driver:eventLoop");
+    }
+
+    if (ctx.lumiBlocks) {
+        ctx.lumiBlocks->printSummary(std::cout);
     }
 
     chain.endJob(ctx);
+    if (ctx.eventCache) {
+        ctx.eventCache->endJob();
+    }
+
+    if (ctx.out) {
+        if (ctx.timer) ctx.timer->start("driver:write");
+        ctx.out->write();
+        if (ctx.timer) ctx.timer->stop("driver:write");
+    }
 
-    if (ctx.out && ctx.out->file()) {
-        ctx.out->file()->Write();
+    if (ctx.checkpoint) {
+        ctx.checkpoint->finish();
     }
 
     return 0;
@@ -0,0 +1,91 @@
+#include "fwk/EventCacheService.h"
+
+#include <iostream>
+#include <stdexcept>
+
+#include <Compression.h>
+#include <TChain.h>
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TTree.h>
+
+#include "PickEvent.h"
+#include "fwk/Context.h"
+
+namespace fwk {
+
+EventCacheService::EventCacheService(const GlobalFlag& gf, std::string path)
+    : globalFlags_(gf)
+    , path_(std::move(path))
+    // GamJetFake runs without the HLT requirement; keep every HLT state there.
+    , checkHlt_(gf.getChannel() != GlobalFlag::Channel::GamJetFake) {}
+
+EventCacheService::~EventCacheService() = default;
+
+std::string EventCacheService::defaultPath(const std::string& outDir, const std::string& ioName) {
+    return outDir + "/EventCache_" + ioName;
+}
+
+void EventCacheService::beginJob(Context& ctx) {
+    TChain* chain = ctx.skimT->getChain();
+    if (!chain) {
+        throw std::runtime_error("EventCacheService::beginJob - chain is null");
+    }
+
+    pickEvent_ = std::make_unique<PickEvent>(globalFlags_);
+
+    // Keep the histogram output as the current directory for the modules.
+    TDirectory::TContext dirGuard;
+
+    fout_.reset(TFile::Open(path_.c_str(), "RECREATE"));
+    if (!fout_ || fout_->IsZombie()) {
+        throw std::runtime_error("EventCacheService: failed to create cache file: " + path_);
+    }
+    // Replays are read-bound: favour decompression speed over ratio.
+    fout_->SetCompressionSettings(ROOT::RCompressionSetting::EDefaults::kUseAnalysis);
+    fout_->cd();
+
+    chain->LoadTree(0);
+    // Only active branches are cloned; addresses follow the chain across files.
+    tree_ = chain->CloneTree(0);
+    if (!tree_) {
+        throw std::runtime_error("EventCacheService: CloneTree failed for " + path_);
+    }
+    tree_->SetDirectory(fout_.get());
+
+    std::cout << "[EventCacheService] writing replay cache: " << path_ << '\n';
+}
+
+// Called right after GetEntry, before any module corrects the jets in place.
+void EventCacheService::fill(Context& ctx) {
+    ++nSeen_;
+    auto& skimT = ctx.skimT;
+
+    if (checkHlt_ && !pickEvent_->passHlt(skimT)) {
+        return;
+    }
+    if (!pickEvent_->passGoodLumi(skimT->run, skimT->luminosityBlock)) {
+        return;
+    }
+
+    tree_->Fill();
+    ++nKept_;
+}
+
+void EventCacheService::endJob() {
+    if (!fout_) {
+        return;
+    }
+
+    TDirectory::TContext dirGuard;
+    fout_->cd();
+    tree_->Write("", TObject::kOverwrite);
+    fout_->Close();
+    tree_ = nullptr;
+
+    const double frac = nSeen_ > 0 ? static_cast<double>(nKept_) / nSeen_ : 0.0;
+    std::cout << "[EventCacheService] kept " << nKept_ << " / " << nSeen_
+              << " entries (" << 100.0 * frac << "%) in " << path_ << '\n';
+}
+
+} // namespace fwk
@@ -0,0 +1,68 @@
+#include "fwk/EventPrepModule.h"
+
+#include "HemVeto.h"
+#include "PickGenJet.h"
+#include "ScaleEvent.h"
+#include "SkimTree.h"
+#include "fwk/Context.h"
+#include "fwk/LumiBlockService.h"
+#include "fwk/PickEventModule.h"
+#include "fwk/ScaleJetModule.h"
+#include "fwk/ScaleMetModule.h"
+#include "fwk/ScaleMuonModule.h"
+
+namespace fwk {
+
+EventPrepModule::EventPrepModule(const GlobalFlag& gf, bool correctJets)
+    : globalFlags_(gf), correctJets_(correctJets) {}
+
+EventPrepModule::~EventPrepModule() = default;
+
+void EventPrepModule::beginJob(Context&) {
+    pickEventModule_ = std::make_unique<PickEventModule>(globalFlags_);
+    scaleMuonModule_ = std::make_unique<ScaleMuonModule>(globalFlags_);
+    if (correctJets_) {
+        scaleJetModule_ = std::make_unique<ScaleJetModule>(globalFlags_);
+        scaleMetModule_ = std::make_unique<ScaleMetModule>(globalFlags_);
+        hemVeto_ = std::make_shared<HemVeto>(globalFlags_);
+    }
+}
+
+bool EventPrepModule::analyze(Context& ctx, Event& ev) {
+    auto& skimT = ctx.skimT;
+    auto& products = ev.products;
+
+    products.put<prod::EventWeight>().value =
+        ctx.scaleEvent ? ctx.scaleEvent->getEventWeight(*skimT) : 1.0;
+
+    pickEventModule_->produce(skimT, products, ev.block);
+    if (!products.require<prod::CoreSelection>().passCore()) {
+        return true;
+    }
+
+    scaleMuonModule_->produce(skimT, products);
+
+    // Built on first use only, then shared by every consumer of the event
+    if (globalFlags_.isMC()) {
+        lazySkimT_ = skimT.get();
+        products.putLazy<prod::GenJetIndex>(&EventPrepModule::fillGenJetIndex_, this);
+    }
+
+    if (correctJets_) {
+        scaleJetModule_->produce(skimT, products);
+        scaleMetModule_->produceLazy(skimT, scaleJetModule_->correctedJets(), products);
+
+        auto& hem = products.put<prod::HemVetoFlag>();
+        hem.veto = ev.block ? hemVeto_->isHemVeto(*skimT, ev.block->hemPeriod)
+                            : hemVeto_->isHemVeto(*skimT);
+        hem.mcWeight = hemVeto_->getMcWeight();
+    }
+    return true;
+}
+
+void EventPrepModule::fillGenJetIndex_(const void* self, prod::GenJetIndex& out) {
+    const auto* m = static_cast<const EventPrepModule*>(self);
+    PickGenJet::indexGenJets(*m->lazySkimT_, out.genJets);
+}
+
+} // namespace fwk
@@ -1,6 +1,8 @@
 #include "fwk/Factory.h"
 
+#include <algorithm>
 #include <memory>
+#include <sstream>
 #include <stdexcept>
 
 #include "RunL2ResidualDiJet.h"
@@ -14,14 +16,25 @@
 #include "RunL3ResidualWqqm.h"
 #include "RunL3ResidualZeeJet.h"
 #include "RunL3ResidualZmmJet.h"
+#include "fwk/EventPrepModule.h"
+#include "fwk/MultiTargetModule.h"
 #include "fwk/RunL3ResidualZmmJetModule.h"
 #include "fwk/RunWrapperModule.h"
 
 namespace fwk {
 
-ModuleChain makeChain(const GlobalFlag& gf) {
-    ModuleChain chain;
+namespace {
+
+const std::vector<std::string> kLevels = {"L2Residual", "L3Residual", "JerSF"};
+const std::vector<std::string> kStages = {"Derivation", "Closure"};
+
+bool contains(const std::vector<std::string>& v, const std::string& s) {
+    return std::find(v.begin(), v.end(), s) != v.end();
+}
 
+} // namespace
+
+std::unique_ptr<IModule> makeModule(const GlobalFlag& gf) {
     using DerivationLevel = GlobalFlag::JecDerivationLevel;
     using Chan = GlobalFlag::Channel;
 
@@ -30,17 +43,13 @@ ModuleChain makeChain(const GlobalFlag& gf) {
         case DerivationLevel::JerSF: {
             switch (gf.getChannel()) {
                 case Chan::DiJet:
-                    chain.add(std::make_unique<RunWrapperModule<RunL2ResidualDiJet>>(gf, "RunL2ResidualDiJet"));
-                    return chain;
+                    return std::make_unique<RunWrapperModule<RunL2ResidualDiJet>>(gf, "RunL2ResidualDiJet");
                 case Chan::ZeeJet:
-                    chain.add(std::make_unique<RunWrapperModule<RunL2ResidualZeeJet>>(gf, "RunL2ResidualZeeJet"));
-                    return chain;
+                    return std::make_unique<RunWrapperModule<RunL2ResidualZeeJet>>(gf, "RunL2ResidualZeeJet");
                 case Chan::ZmmJet:
-                    chain.add(std::make_unique<RunWrapperModule<RunL2ResidualZmmJet>>(gf, "RunL2ResidualZmmJet"));
-                    return chain;
+                    return std::make_unique<RunWrapperModule<RunL2ResidualZmmJet>>(gf, "RunL2ResidualZmmJet");
                 case Chan::GamJet:
-                    chain.add(std::make_unique<RunWrapperModule<RunL2ResidualGamJet>>(gf, "RunL2ResidualGamJet"));
-                    return chain;
+                    return std::make_unique<RunWrapperModule<RunL2ResidualGamJet>>(gf, "RunL2ResidualGamJet");
                 default:
                     throw std::runtime_error("Unsupported channel for L2Residual/JerSF: " + gf.getChannelStr());
             }
@@ -49,26 +58,19 @@ ModuleChain makeChain(const GlobalFlag& gf) {
         case DerivationLevel::L3Residual: {
             switch (gf.getChannel()) {
                 case Chan::ZeeJet:
-                    chain.add(std::make_unique<RunWrapperModule<RunL3ResidualZeeJet>>(gf, "RunL3ResidualZeeJet"));
-                    return chain;
+                    return std::make_unique<RunWrapperModule<RunL3ResidualZeeJet>>(gf, "RunL3ResidualZeeJet");
                 case Chan::ZmmJet:
-                    chain.add(std::make_unique<RunL3ResidualZmmJetModule>(gf));
-                    return chain;
+                    return std::make_unique<RunL3ResidualZmmJetModule>(gf);
                 case Chan::GamJet:
-                    chain.add(std::make_unique<RunWrapperModule<RunL3ResidualGamJet>>(gf, "RunL3ResidualGamJet"));
-                    return chain;
+                    return std::make_unique<RunWrapperModule<RunL3ResidualGamJet>>(gf, "RunL3ResidualGamJet");
                 case Chan::GamJetFake:
-                    chain.add(std::make_unique<RunWrapperModule<RunL3ResidualGamJetFake>>(gf, "RunL3ResidualGamJetFake"));
-                    return chain;
+                    return std::make_unique<RunWrapperModule<RunL3ResidualGamJetFake>>(gf, "RunL3ResidualGamJetFake");
                 case Chan::MultiJet:
-                    chain.add(std::make_unique<RunWrapperModule<RunL3ResidualMultiJet>>(gf, "RunL3ResidualMultiJet"));
-                    return chain;
+                    return std::make_unique<RunWrapperModule<RunL3ResidualMultiJet>>(gf, "RunL3ResidualMultiJet");
                 case Chan::Wqqe:
-                    chain.add(std::make_unique<RunWrapperModule<RunL3ResidualWqqe>>(gf, "RunL3ResidualWqqe"));
-                    return chain;
+                    return std::make_unique<RunWrapperModule<RunL3ResidualWqqe>>(gf, "RunL3ResidualWqqe");
                 case Chan::Wqqm:
-                    chain.add(std::make_unique<RunWrapperModule<RunL3ResidualWqqm>>(gf, "RunL3ResidualWqqm"));
-                    return chain;
+                    return std::make_unique<RunWrapperModule<RunL3ResidualWqqm>>(gf, "RunL3ResidualWqqm");
                 default:
                     throw std::runtime_error("Unsupported channel for L3Residual: " + gf.getChannelStr());
             }
@@ -79,4 +81,109 @@ ModuleChain makeChain(const GlobalFlag& gf) {
     }
 }
 
+ModuleChain makeChain(const GlobalFlag& gf) {
+    ModuleChain chain;
+    auto module = makeModule(gf);
+    // Legacy Run() loops do their own prologue.
+    if (!module->ownsEventLoop()) {
+        chain.add(std::make_unique<EventPrepModule>(gf, true));
+    }
+    chain.add(std::move(module));
+    return chain;
+}
+
+ModuleChain makeChain(const GlobalFlag& gf, const std::vector<ChainTarget>& targets) {
+    const std::string& ioName = gf.getIoName();
+    if (targets.empty()) {
+        throw std::runtime_error("makeChain - empty target list for " + ioName);
+    }
+
+    std::vector<MultiTargetModule::Target> built;
+    for (const auto& t : targets) {
+        const std::string targetName = targetIoName(ioName, t.level, t.stage);
+        auto targetGf = std::make_unique<GlobalFlag>(targetName);
+        targetGf->setDebug(gf.isDebug());
+        targetGf->setNDebug(gf.getNDebug());
+
+        MultiTargetModule::Target target;
+        target.module = makeModule(*targetGf);
+        // Legacy Run() loops read the tree themselves and cannot share this read
+        if (target.module->ownsEventLoop()) {
+            throw std::runtime_error("makeChain - target " + t.level + ":" + t.stage + " of " + ioName +
+                                     " runs " + target.module->name() +
+                                     ", which has no per-event module; multi-target (-t) mode"
+                                     " supports only ZmmJet L3Residual. Run this target as a separate job");
+        }
+        target.gf = std::move(targetGf);
+        target.topDir = t.level + "_" + t.stage;
+        built.push_back(std::move(target));
+    }
+
+    // Targets differ in JEC application level, so the shared prologue stops
+    // before the jets; MultiTargetModule snapshots the event after it.
+    ModuleChain chain;
+    chain.add(std::make_unique<EventPrepModule>(gf, false));
+    chain.add(std::make_unique<MultiTargetModule>(std::move(built)));
+    return chain;
+}
+
+std::vector<ChainTarget> parseTargets(const std::string& spec) {
+    std::vector<ChainTarget> out;
+    std::stringstream ss(spec);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.empty()) continue;
+        const auto colon = item.find(':');
+        if (colon == std::string::npos || colon == 0 || colon + 1 == item.size()) {
+            throw std::runtime_error("parseTargets - expected <level>:<stage>, got '" + item + "'");
+        }
+        ChainTarget t{item.substr(0, colon), item.substr(colon + 1)};
+        if (!contains(kLevels, t.level) || !contains(kStages, t.stage)) {
+            throw std::runtime_error("parseTargets - unknown level or stage in '" + item + "'");
+        }
+        out.push_back(t);
+    }
+    return out;
+}
+
+// ioNames look like <algo>_<level>_<channel>_<era>_<Data|MC>_..._Hist<stage><syst>_<i>of<n>.root
+// (see input/getRootFiles.py): swap the level token and the stage inside the Hist token.
+std::string targetIoName(const std::string& ioName,
+                         const std::string& level,
+                         const std::string& stage) {
+    std::vector<std::string> toks;
+    std::stringstream ss(ioName);
+    std::string tok;
+    while (std::getline(ss, tok, '_')) toks.push_back(tok);
+
+    bool hasLevel = false;
+    bool hasStage = false;
+    for (auto& t : toks) {
+        if (contains(kLevels, t)) {
+            t = level;
+            hasLevel = true;
+            continue;
+        }
+        if (t.rfind("Hist", 0) == 0) {
+            for (const auto& s : kStages) {
+                if (t.compare(4, s.size(), s) == 0) {
+                    t = "Hist" + stage + t.substr(4 + s.size());
+                    hasStage = true;
+                    break;
+                }
+            }
+        }
+    }
+    if (!hasLevel || !hasStage) {
+        throw std::runtime_error("targetIoName - no derivation level or Hist<stage> token in " + ioName);
+    }
+
+    std::string out;
+    for (std::size_t i = 0; i < toks.size(); ++i) {
+        if (i) out += '_';
+        out += toks[i];
+    }
+    return out;
+}
+
 } // namespace fwk
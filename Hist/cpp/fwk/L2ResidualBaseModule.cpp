@@ -6,8 +6,10 @@
 #include <TDirectory.h>
 
 #include "HemVeto.h"
+#include "ScaleEvent.h"
 #include "VarBin.h"
 #include "fwk/Context.h"
+#include "fwk/LumiBlockService.h"
 #include "fwk/OutputService.h"
 #include "fwk/PickEventModule.h"
 #include "fwk/ScaleJetModule.h"
@@ -41,26 +43,46 @@ void L2ResidualBaseModule::beginJob(Context& ctx) {
     hemVeto_ = std::make_shared<HemVeto>(globalFlags_);
 }
 
-bool L2ResidualBaseModule::analyze(Context& ctx, Event&) {
+bool L2ResidualBaseModule::analyze(Context& ctx, Event& ev) {
     auto& skimT = ctx.skimT;
 
-    double weight = 1.0;
+    // The prologue comes from EventPrepModule's products when it heads the chain.
+    const auto& products = ev.products;
+
+    // Start from the generator/pileup weight, as the legacy Run() loops do.
+    const auto* eventWeight = products.get<prod::EventWeight>();
+    double weight = eventWeight ? eventWeight->value
+                  : (ctx.scaleEvent ? ctx.scaleEvent->getEventWeight(*skimT) : 1.0);
     hCutflow_->fill("passSkim", weight);
 
-    if (!pickEventModule_->passCoreEventCuts(skimT, hCutflow_.get(), weight)) {
+    const auto* sel = products.get<prod::CoreSelection>();
+    const bool passCore = sel
+        ? pickEventModule_->passCoreEventCuts(*sel, hCutflow_.get(), weight)
+        : pickEventModule_->passCoreEventCuts(skimT, hCutflow_.get(), weight, ev.block);
+    if (!passCore) {
         return true;
     }
 
-    scaleMuonModule_->applyCorrections(skimT);
-    scaleJetModule_->applyCorrections(skimT);
+    if (!products.has<prod::MuonCorrection>()) {
+        scaleMuonModule_->applyCorrections(skimT);
+    }
+    const bool ownJets = !products.has<prod::JetCorrection>();
+    if (ownJets) {
+        scaleJetModule_->applyCorrections(skimT);
+    }
 
     L2ResidualObjects objects;
     if (!pickObjects(ctx, objects, weight)) {
         return true;
     }
 
-    scaleMetModule_->applyCorrections(skimT, scaleJetModule_->jetPtRaw());
-    TLorentzVector p4CorrMet = scaleMetModule_->correctedMet();
+    TLorentzVector p4CorrMet;
+    if (ownJets) {
+        scaleMetModule_->applyCorrections(skimT, scaleJetModule_->correctedJets());
+        p4CorrMet = scaleMetModule_->correctedMet();
+    } else {
+        p4CorrMet = products.require<prod::CorrectedMet>().p4;
+    }
     p4CorrMet += objects.p4RawTag - objects.p4Tag;
 
     HistL2ResidualInput input = computeResponse(objects, p4CorrMet);
@@ -71,11 +93,15 @@ bool L2ResidualBaseModule::analyze(Context& ctx, Event&) {
     }
     hCutflow_->fill("passL2Residual", weight);
 
-    if (hemVeto_->isHemVeto(*skimT)) {
+    const bool isHemVeto = ownJets ? (ev.block ? hemVeto_->isHemVeto(*skimT, ev.block->hemPeriod)
+                                               : hemVeto_->isHemVeto(*skimT))
+                                   : products.require<prod::HemVetoFlag>().veto;
+    if (isHemVeto) {
         if (globalFlags_.isData()) {
             return true;
         }
-        weight *= hemVeto_->getMcWeight();
+        weight *= ownJets ? hemVeto_->getMcWeight()
+                          : products.require<prod::HemVetoFlag>().mcWeight;
     }
 
     applyChannelWeights(ctx, objects, weight);
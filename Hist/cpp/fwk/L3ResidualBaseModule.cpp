@@ -11,8 +11,10 @@
 #include "Helper.hpp"
 #include "HelperDelta.hpp"
 #include "JecUncBand.h"
+#include "ScaleEvent.h"
 #include "VarBin.h"
 #include "fwk/Context.h"
+#include "fwk/LumiBlockService.h"
 #include "fwk/OutputService.h"
 #include "fwk/PickEventModule.h"
 #include "fwk/ScaleJetModule.h"
@@ -58,15 +60,30 @@ bool L3ResidualBaseModule::analyze(Context& ctx, Event& ev) {
     auto& skimT = ctx.skimT;
     Helper::printProgressEveryN(ev.entry, skimT->getEntries(), everyN_, startClock_, totalTime_);
 
-    double weight = 1.0;
+    // The prologue comes from EventPrepModule's products when it heads the chain.
+    const auto& products = ev.products;
+
+    // Start from the generator/pileup weight, as the legacy Run() loops do.
+    const auto* eventWeight = products.get<prod::EventWeight>();
+    double weight = eventWeight ? eventWeight->value
+                  : (ctx.scaleEvent ? ctx.scaleEvent->getEventWeight(*skimT) : 1.0);
     hCutflow_->fill("passSkim", weight);
 
-    if (!pickEventModule_->passCoreEventCuts(skimT, hCutflow_.get(), weight)) {
+    const auto* sel = products.get<prod::CoreSelection>();
+    const bool passCore = sel
+        ? pickEventModule_->passCoreEventCuts(*sel, hCutflow_.get(), weight)
+        : pickEventModule_->passCoreEventCuts(skimT, hCutflow_.get(), weight, ev.block);
+    if (!passCore) {
         return true;
     }
 
-    scaleMuonModule_->applyCorrections(skimT);
-    scaleJetModule_->applyCorrections(skimT);
+    if (!products.has<prod::MuonCorrection>()) {
+        scaleMuonModule_->applyCorrections(skimT);
+    }
+    const bool ownJets = !products.has<prod::JetCorrection>();
+    if (ownJets) {
+        scaleJetModule_->applyCorrections(skimT);
+    }
 
     L3ResidualObjects objects;
     if (!pickObjects(ctx, objects, weight)) {
@@ -88,8 +105,13 @@ bool L3ResidualBaseModule::analyze(Context& ctx, Event& ev) {
     const double alpha = ptJet2 / ptTag;
     const bool passAlpha = (alpha < maxAlpha_ || ptJet2 < minPtJet2InAlpha_);
 
-    scaleMetModule_->applyCorrections(skimT, scaleJetModule_->jetPtRaw());
-    TLorentzVector p4CorrMet = scaleMetModule_->correctedMet();
+    TLorentzVector p4CorrMet;
+    if (ownJets) {
+        scaleMetModule_->applyCorrections(skimT, scaleJetModule_->correctedJets());
+        p4CorrMet = scaleMetModule_->correctedMet();
+    } else {
+        p4CorrMet = products.require<prod::CorrectedMet>().p4;
+    }
     p4CorrMet += objects.p4RawTag - objects.p4Tag;
 
     HistL3ResidualInput input = computeResponse(objects, p4CorrMet);
@@ -107,18 +129,22 @@ bool L3ResidualBaseModule::analyze(Context& ctx, Event& ev) {
     }
     hCutflow_->fill("passL3Residual", weight);
 
-    if (hemVeto_->isHemVeto(*skimT)) {
+    const bool isHemVeto = ownJets ? (ev.block ? hemVeto_->isHemVeto(*skimT, ev.block->hemPeriod)
+                                               : hemVeto_->isHemVeto(*skimT))
+                                   : products.require<prod::HemVetoFlag>().veto;
+    if (isHemVeto) {
         if (globalFlags_.isData()) {
             return true;
         }
-        weight *= hemVeto_->getMcWeight();
+        weight *= ownJets ? hemVeto_->getMcWeight()
+                          : products.require<prod::HemVetoFlag>().mcWeight;
     }
 
     applyChannelWeights(ctx, objects, weight);
 
     input.weight = weight;
     histL3Residual_->fillHistos(input);
-    fillChannelSpecificHistos(ctx, objects, input, alpha, weight);
+    fillChannelSpecificHistos(ctx, products, objects, input, alpha, weight);
 
     return true;
 }
@@ -1,7 +1,42 @@
 #include "fwk/LoggerService.h"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace fwk {
 
+bool LoggerService::allowKey(const std::string& key, int maxPrint) {
+    static std::mutex mtx;
+    static std::unordered_map<std::string, int> counts;
+
+    std::lock_guard<std::mutex> lk(mtx);
+    int& c = counts[key];
+    if (c < maxPrint) { ++c; return true; }
+    if (c == maxPrint) {
+        ++c;
+        std::cerr << "[fwk][WARN] further messages for '" << key << "' suppressed\n";
+    }
+    return false;
+}
+
+void LoggerService::emit_(Level lvl, const char* tag, const std::string& msg) {
+    const char* sep = (tag && *tag) ? " " : "";
+    switch (lvl) {
+        case Level::Trace:
+        case Level::Debug:
+        case Level::Info:
+            std::cout << (tag ? tag : "") << sep << msg << '\n';
+            break;
+        case Level::Warn:
+            std::cerr << "[WARN] " << (tag ? tag : "") << sep << msg << '\n';
+            break;
+        case Level::Error:
+        case Level::Off:
+            std::cerr << "[ERROR] " << (tag ? tag : "") << sep << msg << '\n';
+            break;
+    }
+}
+
 void LoggerService::info(const std::string& msg) const {
     std::cout << "[fwk][INFO] " << msg << "\n";
 }
@@ -0,0 +1,53 @@
+#include "fwk/LumiBlockService.h"
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "GlobalFlag.h"
+#include "HemVeto.h"
+#include "PickEvent.h"
+#include "SkimTree.h"
+
+namespace fwk {
+
+LumiBlockService::LumiBlockService(const GlobalFlag& gf, bool skipBadBlocks)
+    : pickEvent_(std::make_unique<PickEvent>(gf))
+    , hemVeto_(std::make_unique<HemVeto>(gf))
+    , skipBadBlocks_(skipBadBlocks) {}
+
+LumiBlockService::~LumiBlockService() = default;
+
+const LumiBlock& LumiBlockService::at(SkimTree& skimT, long long entry) {
+    if (!skimT.readRunLumi(entry)) {
+        throw std::runtime_error("LumiBlockService::at - cannot read run/lumi of entry " +
+                                 std::to_string(entry));
+    }
+    if (block_.firstEntry >= 0 && skimT.run == block_.run &&
+        skimT.luminosityBlock == block_.lumi) {
+        return block_;
+    }
+
+    block_.run = skimT.run;
+    block_.lumi = skimT.luminosityBlock;
+    block_.firstEntry = entry;
+    block_.passGoodLumi = pickEvent_->passGoodLumi(block_.run, block_.lumi);
+    block_.hemPeriod = hemVeto_->appliesToRun(block_.run);
+
+    ++nBlocks_;
+    if (!block_.passGoodLumi) {
+        ++nBadBlocks_;
+    }
+    return block_;
+}
+
+void LumiBlockService::printSummary(std::ostream& os) const {
+    os << "[LumiBlockService] " << nBlocks_ << " lumi blocks, " << nBadBlocks_
+       << " outside the golden JSON";
+    if (skipBadBlocks_) {
+        os << " (" << nSkippedEntries_ << " entries skipped unread)";
+    }
+    os << '\n';
+}
+
+} // namespace fwk
@@ -1,14 +1,31 @@
 #include "fwk/ModuleChain.h"
 
+#include <chrono>
+
+#include "fwk/TimerService.h"
+
 namespace fwk {
 
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point t0) {
+    return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+} // namespace
+
 void ModuleChain::add(std::unique_ptr<IModule> m) {
     modules_.push_back(std::move(m));
 }
 
 void ModuleChain::beginJob(Context& ctx) {
-    for (auto& m : modules_) {
-        m->beginJob(ctx);
+    seconds_.assign(modules_.size(), 0.0);
+    for (std::size_t i = 0; i < modules_.size(); ++i) {
+        const auto t0 = Clock::now();
+        modules_[i]->beginJob(ctx);
+        if (timer_) seconds_[i] += secondsSince(t0);
     }
 }
 
@@ -19,8 +36,20 @@ void ModuleChain::beginFile(Context& ctx) {
 }
 
 bool ModuleChain::analyze(Context& ctx, Event& ev) {
-    for (auto& m : modules_) {
-        if (!m->analyze(ctx, ev)) {
+    if (!timer_) {
+        for (auto& m : modules_) {
+            if (!m->analyze(ctx, ev)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    for (std::size_t i = 0; i < modules_.size(); ++i) {
+        const auto t0 = Clock::now();
+        const bool ok = modules_[i]->analyze(ctx, ev);
+        seconds_[i] += secondsSince(t0);
+        if (!ok) {
             return false;
         }
     }
@@ -28,9 +57,26 @@ bool ModuleChain::analyze(Context& ctx, Event& ev) {
 }
 
 void ModuleChain::endJob(Context& ctx) {
-    for (auto& m : modules_) {
-        m->endJob(ctx);
+    for (std::size_t i = 0; i < modules_.size(); ++i) {
+        const auto t0 = Clock::now();
+        modules_[i]->endJob(ctx);
+        if (timer_) seconds_[i] += secondsSince(t0);
+    }
+
+    if (timer_) {
+        for (std::size_t i = 0; i < modules_.size(); ++i) {
+            timer_->add("module:" + modules_[i]->name(), seconds_[i]);
+        }
     }
 }
 
+bool ModuleChain::supportsCheckpoint() const {
+    for (const auto& m : modules_) {
+        if (!m->supportsCheckpoint()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 } // namespace fwk
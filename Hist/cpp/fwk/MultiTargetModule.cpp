@@ -0,0 +1,101 @@
+#include "fwk/MultiTargetModule.h"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+#include "SkimTree.h"
+#include "fwk/OutputService.h"
+
+namespace fwk {
+
+MultiTargetModule::MultiTargetModule(std::vector<Target> targets)
+    : targets_(std::move(targets)),
+      active_(targets_.size(), true) {
+    if (targets_.empty()) {
+        throw std::runtime_error("MultiTargetModule::MultiTargetModule - no targets");
+    }
+    for (const auto& t : targets_) {
+        if (!t.module || !t.gf) {
+            throw std::runtime_error("MultiTargetModule::MultiTargetModule - incomplete target " + t.topDir);
+        }
+        if (t.module->ownsEventLoop()) {
+            throw std::runtime_error("MultiTargetModule::MultiTargetModule - target " + t.topDir +
+                                     " (" + t.module->name() +
+                                     ") runs its own event loop and cannot share the skim read;"
+                                     " run it as a separate job");
+        }
+    }
+}
+
+MultiTargetModule::~MultiTargetModule() = default;
+
+std::string MultiTargetModule::name() const {
+    std::string n = "MultiTarget[";
+    for (std::size_t i = 0; i < targets_.size(); ++i) {
+        if (i) n += ", ";
+        n += targets_[i].topDir;
+    }
+    return n + "]";
+}
+
+void MultiTargetModule::beginJob(Context& ctx) {
+    for (auto& t : targets_) {
+        std::cout << "[MultiTargetModule] booking " << t.module->name() << " in /" << t.topDir << '\n';
+        ctx.out->setTopDir(t.topDir);
+        t.module->beginJob(ctx);
+    }
+    ctx.out->setTopDir("");
+}
+
+void MultiTargetModule::beginFile(Context& ctx) {
+    for (auto& t : targets_) {
+        ctx.out->setTopDir(t.topDir);
+        t.module->beginFile(ctx);
+    }
+    ctx.out->setTopDir("");
+}
+
+void MultiTargetModule::snapshot_(const SkimTree& skimT) {
+    const std::size_t n = std::min<std::size_t>(skimT.nMuon, SkimTree::nMuonMax);
+    muonPt_.assign(skimT.Muon_pt, skimT.Muon_pt + n);
+}
+
+void MultiTargetModule::restore_(SkimTree& skimT) const {
+    std::copy(muonPt_.begin(), muonPt_.end(), skimT.Muon_pt);
+    skimT.resetJetView();
+    skimT.hasJetQualityMask = false; // mask bits depend on the jet pt
+}
+
+bool MultiTargetModule::analyze(Context& ctx, Event& ev) {
+    SkimTree& skimT = *ctx.skimT;
+    snapshot_(skimT);
+
+    bool anyActive = false;
+    for (std::size_t i = 0; i < targets_.size(); ++i) {
+        if (!active_[i]) continue;
+        if (i > 0) restore_(skimT);
+        active_[i] = targets_[i].module->analyze(ctx, ev);
+        anyActive = anyActive || active_[i];
+    }
+    return anyActive;
+}
+
+void MultiTargetModule::endJob(Context& ctx) {
+    for (auto& t : targets_) {
+        ctx.out->setTopDir(t.topDir);
+        t.module->endJob(ctx);
+    }
+    ctx.out->setTopDir("");
+}
+
+bool MultiTargetModule::supportsCheckpoint() const {
+    for (const auto& t : targets_) {
+        if (!t.module->supportsCheckpoint()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace fwk
@@ -1,7 +1,21 @@
 #include "fwk/OutputService.h"
 
+#include "fwk/CompactWriter.h"
+
 namespace fwk {
 
+namespace {
+
+TDirectory* getOrMkdir(TDirectory* parent, const std::string& dir) {
+    auto* d = parent->GetDirectory(dir.c_str());
+    if (!d) {
+        d = parent->mkdir(dir.c_str());
+    }
+    return d;
+}
+
+} // namespace
+
 OutputService::OutputService(TFile* fout)
     : fout_(fout) {}
 
@@ -11,12 +25,21 @@ TFile* OutputService::file() const {
 
 TDirectory* OutputService::mkdirAndCd(const std::string& dir) {
     fout_->cd();
-    auto* d = fout_->GetDirectory(dir.c_str());
-    if (!d) {
-        d = fout_->mkdir(dir.c_str());
-    }
+    TDirectory* parent = topDir_.empty() ? fout_ : getOrMkdir(fout_, topDir_);
+    auto* d = getOrMkdir(parent, dir);
     d->cd();
     return d;
 }
 
+void OutputService::write() {
+    if (!fout_) {
+        return;
+    }
+    if (compact_) {
+        CompactWriter(fout_).write();
+    } else {
+        fout_->Write();
+    }
+}
+
 } // namespace fwk
@@ -2,6 +2,7 @@
 
 #include "HistCutflow.h"
 #include "PickEvent.h"
+#include "fwk/LumiBlockService.h"
 
 namespace fwk {
 
@@ -10,7 +11,8 @@ PickEventModule::PickEventModule(const GlobalFlag& gf)
 
 bool PickEventModule::passCoreEventCuts(const std::shared_ptr<SkimTree>& skimT,
                                         HistCutflow* cutflow,
-                                        double weight) const {
+                                        double weight,
+                                        const LumiBlock* block) const {
     if (!pickEvent_->passHlt(skimT)) {
         return false;
     }
@@ -18,7 +20,7 @@ bool PickEventModule::passCoreEventCuts(const std::shared_ptr<SkimTree>& skimT,
         cutflow->fill("passHlt", weight);
     }
 
-    if (!pickEvent_->passGoodLumi(skimT->run, skimT->luminosityBlock)) {
+    if (!passGoodLumi(*skimT, block)) {
         return false;
     }
     if (cutflow) {
@@ -35,6 +37,31 @@ bool PickEventModule::passCoreEventCuts(const std::shared_ptr<SkimTree>& skimT,
     return true;
 }
 
+void PickEventModule::produce(const std::shared_ptr<SkimTree>& skimT,
+                              EventProducts& products,
+                              const LumiBlock* block) const {
+    auto& sel = products.put<prod::CoreSelection>();
+    sel.passHlt = pickEvent_->passHlt(skimT);
+    sel.passGoodLumi = sel.passHlt && passGoodLumi(*skimT, block);
+    sel.passMatchedGenVtx = sel.passGoodLumi && pickEvent_->passMatchedGenVtx(*skimT);
+}
+
+bool PickEventModule::passCoreEventCuts(const prod::CoreSelection& sel,
+                                        HistCutflow* cutflow,
+                                        double weight) const {
+    const bool bits[] = {sel.passHlt, sel.passGoodLumi, sel.passMatchedGenVtx};
+    const char* names[] = {"passHlt", "passGoodLumi", "passMatchedGenVtx"};
+    for (int i = 0; i < 3; ++i) {
+        if (!bits[i]) {
+            return false;
+        }
+        if (cutflow) {
+            cutflow->fill(names[i], weight);
+        }
+    }
+    return true;
+}
+
 bool PickEventModule::passProbeJetVeto(const TLorentzVector& p4Probe,
                                        HistCutflow* cutflow,
                                        double weight) const {
@@ -48,4 +75,9 @@ bool PickEventModule::passProbeJetVeto(const TLorentzVector& p4Probe,
     return true;
 }
 
+bool PickEventModule::passGoodLumi(const SkimTree& skimT, const LumiBlock* block) const {
+    return block ? block->passGoodLumi
+                 : pickEvent_->passGoodLumi(skimT.run, skimT.luminosityBlock);
+}
+
 } // namespace fwk
@@ -102,6 +102,7 @@ void RunL3ResidualZmmJetModule::applyChannelWeights(Context& ctx,
 }
 
 void RunL3ResidualZmmJetModule::fillChannelSpecificHistos(Context& ctx,
+                                                          const EventProducts& products,
                                                           const L3ResidualObjects& objects,
                                                           const HistL3ResidualInput& input,
                                                           double,
@@ -136,12 +137,15 @@ void RunL3ResidualZmmJetModule::fillChannelSpecificHistos(Context& ctx,
             return;
         }
 
+        const auto* genJetIndex = products.get<prod::GenJetIndex>();
         auto pickedGenJets = pickGenJet_->matchByRecoIndices(*skimT,
                                                               objects.iProbe,
                                                               objects.iJet2,
                                                               objects.p4Probe,
-                                                              objects.p4Jet2);
+                                                              objects.p4Jet2,
+                                                              genJetIndex ? &genJetIndex->genJets : nullptr);
         double ptGenProbe = pickedGenJets.p4GenJet1.Pt();
+        skimT->require(SkimBranch::kJetGen);
         histFlavorProbe_->Fill(ptProbe, skimT->Jet_partonFlavour[objects.iProbe], weight);
         histObjGenRecoTag_->Fill(p4GenTags.at(0).Pt(), objects.p4Tag.Pt(), weight);
         histObjGenRecoProbe_->Fill(ptGenProbe, ptProbe, weight);
@@ -5,14 +5,22 @@
 namespace fwk {
 
 ScaleJetModule::ScaleJetModule(const GlobalFlag& gf)
-    : scaleJet_(std::make_shared<ScaleJet>(gf)) {}
+    : scaleJet_(std::make_shared<ScaleJet>(gf)),
+      level_(gf.getJecApplicationLevel()) {}
 
 void ScaleJetModule::applyCorrections(std::shared_ptr<SkimTree>& skimT) const {
     scaleJet_->applyCorrection(skimT);
 }
 
-const std::vector<double>& ScaleJetModule::jetPtRaw() const {
-    return scaleJet_->getJetPtRaw();
+void ScaleJetModule::produce(std::shared_ptr<SkimTree>& skimT, EventProducts& products) const {
+    applyCorrections(skimT);
+    auto& jets = products.put<prod::JetCorrection>();
+    jets.level = level_;
+    jets.jets  = &correctedJets();
+}
+
+const CorrectedJets& ScaleJetModule::correctedJets() const {
+    return scaleJet_->getCorrectedJets();
 }
 
 } // namespace fwk
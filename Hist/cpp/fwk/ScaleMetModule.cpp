@@ -8,12 +8,26 @@ ScaleMetModule::ScaleMetModule(const GlobalFlag& gf)
     : scaleMet_(std::make_shared<ScaleMet>(gf)) {}
 
 void ScaleMetModule::applyCorrections(const std::shared_ptr<SkimTree>& skimT,
-                                      const std::vector<double>& jetPtRaw) const {
-    scaleMet_->applyCorrection(skimT, jetPtRaw);
+                                      const CorrectedJets& jets) const {
+    scaleMet_->applyCorrection(skimT, jets);
 }
 
 TLorentzVector ScaleMetModule::correctedMet() const {
     return scaleMet_->getP4CorrectedMet();
 }
 
+void ScaleMetModule::produceLazy(const std::shared_ptr<SkimTree>& skimT,
+                                 const CorrectedJets& jets,
+                                 EventProducts& products) const {
+    lazySkimT_ = &skimT;
+    lazyJets_ = &jets;
+    products.putLazy<prod::CorrectedMet>(&ScaleMetModule::fillLazy_, this);
+}
+
+void ScaleMetModule::fillLazy_(const void* self, prod::CorrectedMet& out) {
+    const auto* m = static_cast<const ScaleMetModule*>(self);
+    m->applyCorrections(*m->lazySkimT_, *m->lazyJets_);
+    out.p4 = m->correctedMet();
+}
+
 } // namespace fwk
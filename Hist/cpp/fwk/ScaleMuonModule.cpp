@@ -11,6 +11,13 @@ void ScaleMuonModule::applyCorrections(std::shared_ptr<SkimTree>& skimT) const {
     scaleMuon_->applyCorrections(skimT);
 }
 
+void ScaleMuonModule::produce(std::shared_ptr<SkimTree>& skimT, EventProducts& products) const {
+    auto& match = products.put<prod::GenMuonMatch>();
+    scaleMuon_->matchGenMuons(*skimT, match.genIdx);
+    scaleMuon_->applyCorrections(skimT, &match.genIdx);
+    products.put<prod::MuonCorrection>().applied = true;
+}
+
 ScaleMuon::MuSf ScaleMuonModule::getMuonSfs(const SkimTree& skimT,
                                             int index,
                                             ScaleMuon::SystLevel syst) const {
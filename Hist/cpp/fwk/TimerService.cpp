@@ -15,6 +15,10 @@ void TimerService::stop(const std::string& key) {
     total_[key] += std::chrono::duration<double>(t1 - it->second).count();
 }
 
+void TimerService::add(const std::string& key, double seconds) {
+    total_[key] += seconds;
+}
+
 const std::unordered_map<std::string, double>& TimerService::totals() const {
     return total_;
 }
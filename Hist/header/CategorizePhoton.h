@@ -80,9 +80,6 @@ private:
     /// Load matching parameters from a JSON configuration file.
     void loadConfig(const std::string& filename);
 
-    /// Print a debug message if isDebug_ is true.
-    void printDebug(const std::string& msg) const;
-
     /**
      * @brief Core categorisation logic using direct Photon_genPartIdx match.
      *
@@ -97,16 +97,20 @@ public:
     // -----------------------------
     void setDebug(bool debug) noexcept { isDebug_ = debug; }
     void setNDebug(int nDebug) noexcept { nDebug_ = nDebug; }
+    void setPrefetchFiles(int n) noexcept { prefetchFiles_ = n; }
 
     [[nodiscard]] bool isDebug() const noexcept { return isDebug_; }
     [[nodiscard]] int  getNDebug() const noexcept { return nDebug_; }
     [[nodiscard]] bool isClosure() const noexcept { return isClosure_; }
+    [[nodiscard]] int  getPrefetchFiles() const noexcept { return prefetchFiles_; } // skim files opened ahead
+    [[nodiscard]] const std::string& getIoName() const noexcept { return ioName_; }
 
     // -----------------------------
     // Parsed flags (core)
     // -----------------------------
     [[nodiscard]] Year        getYear() const noexcept { return year_; }
     [[nodiscard]] Era         getEra() const noexcept { return era_; }
+    [[nodiscard]] bool        spansEras() const noexcept { return isData_ && era_ == Era::NONE; } // year-only data
     [[nodiscard]] bool        isData() const noexcept { return isData_; }
     [[nodiscard]] bool        isMC() const noexcept { return isMC_; }
     [[nodiscard]] NanoVersion getNanoVersion() const noexcept { return nanoVer_; }
@@ -163,6 +167,7 @@ private:
     bool isDebug_   = false;
     bool isClosure_ = false;
     int  nDebug_    = 100;
+    int  prefetchFiles_ = 0;
 
     Year year_ = Year::NONE;
     Era  era_  = Era::NONE;
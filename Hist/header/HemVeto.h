@@ -13,6 +13,11 @@ public:
 
     /// returns true if the event should be vetoed due to HEM
     bool isHemVeto(const SkimTree& skimT) const;
+    /// same, with appliesToRun(run) already known (e.g. once per lumi block)
+    bool isHemVeto(const SkimTree& skimT, bool runInHemPeriod) const;
+
+    /// master switch, year and (data) run threshold
+    bool appliesToRun(unsigned int run) const;
     double getMcWeight(){return mcWeight_;}
 
 private:
@@ -20,6 +25,7 @@ private:
 
     const GlobalFlag& globalFlags_;
     const bool isMC_;
+    const bool isYear2018_; // the HEM issue only exists in 2018
 
     // master switch and run threshold (only veto data after a given run)
     bool applyHemVeto_;
@@ -4,6 +4,8 @@
 #include <string>
 #include <TLorentzVector.h>
 
+#include "HelperP4.hpp"
+
 // forward decls
 class TDirectory;
 class TH1D;
@@ -61,9 +63,14 @@ public:
     ~HistObjJER();
 
     /// Fill with Gen//Reco pT of the chosen object and event weight
-    void Fill(TLorentzVector p4Gen, TLorentzVector p4Reco, double rho, double weight);
+    void Fill(const TLorentzVector& p4Gen, const TLorentzVector& p4Reco, double rho, double weight);
+    void Fill(const P4& p4Gen, const P4& p4Reco, double rho, double weight);
 
 private:
+    void fill_(double ptGen, double etaGen, double phiGen,
+               double ptReco, double etaReco, double phiReco,
+               double rho, double weight);
+
     JERHistograms hist_;
     std::string obj_;        // "Jet", "Pho", "Ele", or any other
     std::string dirTag_;     
@@ -1,6 +1,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -23,15 +25,36 @@ struct TrigRangePtEta {
 };
 
 // Define the Hlt class
+//
+// Every trigger of the channel has an id: its position in getTrigNames(),
+// i.e. the config order (sorted by name for the pt/pt-eta maps). Ids are
+// the same for every Hlt built from the same flags, so a passed-trigger mask
+// from SkimHlt indexes the per-id arrays below directly.
 class Hlt {
 public:
+    using TrigMask = std::uint64_t;
+    static constexpr std::size_t kMaxTrigIds = 64;
+
     explicit Hlt(const GlobalFlag& globalFlags);
 
     // Destructor
     ~Hlt();
 
-    // Method to get the trigNames
-    const std::vector<std::string> getTrigNames() const;
+    // Method to get the trigNames (index = trigger id)
+    const std::vector<std::string>& getTrigNames() const { return trigNames_; }
+    std::size_t getNumTrigs() const { return trigNames_.size(); }
+
+    /// Trigger id of hltName, or -1 if it is not a trigger of the channel
+    int getTrigId(const std::string& hltName) const;
+
+    /// Visit the trigger ids set in mask, lowest first
+    template <typename F>
+    static void forEachTrig(TrigMask mask, F&& f) {
+        while (mask) {
+            f(static_cast<std::size_t>(__builtin_ctzll(mask)));
+            mask &= mask - 1;
+        }
+    }
 
     // Method to get the trigList 
     const std::vector<std::string>& getTrigList() const {return trigList_;}
@@ -42,6 +65,14 @@ public:
     /// Return a weight based on per-HLT and per-year luminosities (1.0 on MC)
     double getHltLumiWeight(const std::string& passedHltName) const;
 
+    /// Same, precomputed per trigger id
+    double getHltLumiWeight(std::size_t trigId) const { return hltLumiWeights_[trigId]; }
+    const std::vector<double>& getHltLumiWeights() const { return hltLumiWeights_; }
+
+    // Pt (GamJet) / pt-eta (MultiJet, DiJet) ranges per trigger id
+    const std::vector<TrigRangePt>&    getTrigRangesPt() const { return trigRangesPt_; }
+    const std::vector<TrigRangePtEta>& getTrigRangesPtEta() const { return trigRangesPtEta_; }
+
     // Method to get the trigMapRangePt std::unordered_map
     const std::unordered_map<std::string, TrigRangePt>& getTrigMapRangePt() const {return trigMapRangePt_;}
 
@@ -57,6 +88,12 @@ private:
     // trigList std::unordered_map
     std::vector<std::string> trigList_;
 
+    // Per trigger id
+    std::vector<std::string>    trigNames_;
+    std::vector<double>         hltLumiWeights_;
+    std::vector<TrigRangePt>    trigRangesPt_;
+    std::vector<TrigRangePtEta> trigRangesPtEta_;
+
     // Map each HLT name to its lumi
     std::unordered_map<std::string, double>  hltLumiMap_;
 
@@ -67,5 +104,6 @@ private:
     std::unordered_map<std::string, TrigRangePtEta> trigMapRangePtEta_;
 
     void loadConfig();
+    void buildTrigIds();
 };
 
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+#include "GlobalFlag.h"
+#include "SkimTree.h"
+
+/**
+ * Per-event jet quality bits, computed once for all jets right after ScaleJet.
+ *
+ * The mask lives on the SkimTree (Jet_qualityMask) so PickJet::passId reads
+ * bits instead of re-evaluating the PF-fraction ID per call. Kinematic cuts
+ * stay in the pickers, which take their pt/eta thresholds from config.
+ */
+class JetQuality {
+public:
+    enum Bit : std::uint32_t {
+        IdTight        = 1u << 0,
+        IdTightLepVeto = 1u << 1
+    };
+
+    explicit JetQuality(const GlobalFlag& globalFlags);
+
+    // Fills skimT.Jet_qualityMask[0..nJet) and marks it valid for this entry.
+    void fill(SkimTree& skimT) const;
+
+    static bool has(const SkimTree& skimT, int jetIndex, std::uint32_t bits) {
+        return (skimT.Jet_qualityMask[jetIndex] & bits) == bits;
+    }
+
+private:
+    const bool useLegacyJetId_; // NanoV9: Jet_jetId branch
+
+    template <bool LegacyJetId>
+    static void fill_(SkimTree& skimT);
+};
@@ -2,39 +2,38 @@
 
 #include "TLorentzVector.h"
 #include "GlobalFlag.h"
+#include "HdmKernel.hpp"
+
+class MathGuard;
 
 class MathHdm {
 public:
     explicit MathHdm(const GlobalFlag& globalFlags);
 
-    /// Calculate the derived 4-vectors and variables.
+    /// Calculate the HDM responses (transverse plane only).
     void calcResponse(const TLorentzVector& p4CorrMet,
                       const TLorentzVector& p4Ref,
                       const TLorentzVector& p4Jet1,
                       const TLorentzVector& p4Jetn);
+    void calcResponse(const P2& met, const P2& ref, const P2& jet1, const P2& jetn);
 
-    /// Print the pt, eta, phi of all input 4-vectors (only meaningful if isDebug_).
+    /// Print the transverse inputs of the last calcResponse.
     void printInputs() const;
 
-    // Getters for computed TLorentzVectors
-    const TLorentzVector& getP4Metu()   const { return p4Metu_; }
-    const TLorentzVector& getP4Met1()   const { return p4Met1_; }
-    const TLorentzVector& getP4Metn()   const { return p4Metn_; }
-    const TLorentzVector& getP4Metnu()  const { return p4Metnu_; }
-    const TLorentzVector& getP4Refx()   const { return p4Refx_; }
+    const HdmResponses& getResponses() const { return resp_; }
 
     // Getters for computed scalar variables
-    double getBal()    const { return bal_; }
-    double getMpf()    const { return mpf_; }
-    double getMpf1()   const { return mpf1_; }
-    double getMpfn()   const { return mpfn_; }
-    double getMpfu()   const { return mpfu_; }
-    double getMpfnu()  const { return mpfnu_; }
-    double getMpfx()   const { return mpfx_; }
-    double getMpf1x()  const { return mpf1x_; }
-    double getMpfnPt() const { return mpfnPt_; }
-    double getMpfux()  const { return mpfux_; }
-    double getMpfnux() const { return mpfnux_; }
+    double getBal()    const { return resp_.bal; }
+    double getMpf()    const { return resp_.mpf; }
+    double getMpf1()   const { return resp_.mpf1; }
+    double getMpfn()   const { return resp_.mpfn; }
+    double getMpfu()   const { return resp_.mpfu; }
+    double getMpfnu()  const { return resp_.mpfnu; }
+    double getMpfx()   const { return resp_.mpfx; }
+    double getMpf1x()  const { return resp_.mpf1x; }
+    double getMpfnPt() const { return resp_.mpfnPt; }
+    double getMpfux()  const { return resp_.mpfux; }
+    double getMpfnux() const { return resp_.mpfnux; }
 
     // For MultiJet / general axes
     TLorentzVector buildUnitAxis(const TLorentzVector& A,
@@ -56,36 +55,16 @@ private:
     const GlobalFlag::Channel channel_;
     const bool isDebug_;
 
-    // Input 4-vectors (cached)
-    TLorentzVector p4CorrMet_;
-    TLorentzVector p4Ref_;
-    TLorentzVector p4Jet1_;
-    TLorentzVector p4Jetn_;
-
-    // For sanity check
-    TLorentzVector p4Conservation_;
-
-    // Computed 4-vectors
-    TLorentzVector p4Metu_;
-    TLorentzVector p4Met1_;
-    TLorentzVector p4Metn_;
-    TLorentzVector p4Metnu_;
-    TLorentzVector p4Refx_;
+    // Shared body of both calcResponse overloads, on the caller's guard
+    void calcResponse_(const P2& met, const P2& ref, const P2& jet1, const P2& jetn,
+                       MathGuard& g);
 
-    // Computed scalar variables
-    double bal_    {0.0};
-    double mpf_    {0.0};
-    double mpf1_   {0.0};
-    double mpfn_   {0.0};
-    double mpfu_   {0.0};
-    double mpfnu_  {0.0};
-    double mpfx_   {0.0};
-    double mpf1x_  {0.0};
-    double mpfnPt_ {0.0};
-    double mpfux_  {0.0};
-    double mpfnux_ {0.0};
+    // Transverse inputs of the last calcResponse (for printInputs)
+    P2 met_;
+    P2 ref_;
+    P2 jet1_;
+    P2 jetn_;
 
-    // Helper method to make a 4-vector transverse (i.e. set Pz to zero)
-    void makeTransverse(TLorentzVector& vec);
+    HdmResponses resp_;
 };
 
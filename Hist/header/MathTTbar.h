@@ -6,6 +6,7 @@
 
 #include "SkimTree.h"
 #include "GlobalFlag.h"
+#include "P4.hpp"
 
 /**
  * @brief Class for reconstructing the ttbar decay hypothesis by minimizing a χ².
@@ -63,9 +64,10 @@ public:
     void print() const;
 
 private:
-    // Calculate the χ² for a given hypothesis.
-    double calcChiSqr(const SkimTree& skimT, int iHadB, int iLepB,
-                      int iJet1, int iJet2, double pzMetHypo);
+    // Calculate the χ² for a given hypothesis from pre-built four-vectors.
+    double calcChiSqr(const P4& hadB, const P4& lepB,
+                      const P4& jet1, const P4& jet2,
+                      const P4& lep, const P4& metHypo) const;
 
     //--------------------------------- 
     // Input objects
@@ -34,11 +34,10 @@ private:
     PickJet     pickJet_;
     const bool  isDebug_;
 
-    void printDebug(const std::string& msg) const;
-
     // selection thresholds
     double      minPtTnP_{0.0};
     std::string jetIdLabel_;
+    PickJet::WorkingPoint jetIdWp_{PickJet::WorkingPoint::Unknown}; // parsed jetIdLabel_
     double      minPtOther_{0.0};
     double      maxEtaTag_{999.0};
 
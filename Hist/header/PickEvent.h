@@ -2,6 +2,7 @@
 #pragma once
 
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -27,8 +28,14 @@ public:
     bool passHltWithPtEta(const std::shared_ptr<SkimTree>& skimT,
                           const double& pt,
                           const double& eta);
-    std::vector<std::string> getPassedHlts() { return passedHlts_; }
-    std::string              getPassedHlt()  { return passedHlt_; }
+    // Passed triggers as a mask over Hlt trigger ids (set by passHlt)
+    Hlt::TrigMask getPassedHltMask() const { return passedHltMask_; }
+    // Trigger id picked by passHltWithPt/passHltWithPtEta, -1 if none
+    int           getPassedHltId() const { return passedHltId_; }
+
+    // Name-based views of the above (built on call)
+    std::vector<std::string> getPassedHlts() const;
+    std::string              getPassedHlt() const;
 
     std::unordered_map<std::string, const Bool_t*> getTrigValues() const;
 
@@ -62,8 +69,8 @@ private:
     PickJet pickJet_;
 
     Hlt                       hlt_;
-    std::vector<std::string>  passedHlts_{};
-    std::string               passedHlt_;
+    Hlt::TrigMask             passedHltMask_{0};
+    int                       passedHltId_{-1};
 
     // --- Config and cache for lumi + jet veto ---
     // Jet veto
@@ -71,11 +78,12 @@ private:
     std::string jetVetoName_;
     std::string jetVetoKey_;
     std::string jetIdLabel_;
+    PickJet::WorkingPoint jetIdWp_{PickJet::WorkingPoint::Unknown}; // parsed jetIdLabel_
     correction::Correction::Ref loadedJetVetoRef_;
 
     // Golden lumi
     std::string    goldenLumiJsonPath_;
-    nlohmann::json loadedGoldenLumiJson_;
+    std::shared_ptr<const nlohmann::json> loadedGoldenLumiJson_; // shared via ResourceCache
 
     //Pt-Hat and LHE based
     bool   doPtHatFilter_;
@@ -86,9 +94,6 @@ private:
     double   maxDiffPVzGenVtxz_;
 
     // Helpers
-    void printDebug(const std::string& message) const;
-    void printWarn(const std::string& msg) const;
-
     void loadConfig(const std::string& filename);
     void loadJetVetoRef();
     void loadGoldenLumiJson();
@@ -63,6 +63,7 @@ private:
     double      minPtJet_{0.0};
     double      maxEtaProbeJet_{999.0};
     std::string jetIdLabel_;
+    PickJet::WorkingPoint jetIdWp_{PickJet::WorkingPoint::Unknown}; // parsed jetIdLabel_
     double      minDeltaRrefJet_{0.0};
 
     // Optional: apply JetID/eta to jet2 as well (robust default = true)
@@ -84,8 +85,6 @@ private:
     const bool isDebug_;
     PickJet pickJet_;
 
-    void printDebug(const std::string& message) const;
-
     // Config
     void loadConfig(const std::string& filename);
     void validateConfig_() const;
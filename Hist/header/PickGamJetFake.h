@@ -65,9 +65,6 @@ private:
     const GlobalFlag::Channel channel_;
     const bool isDebug_;
 
-    // Helper function for debug printing
-    void printDebug(const std::string& message) const;
-
     // Load configuration from JSON file
     void loadConfig(const std::string& filename);
 };
@@ -8,6 +8,8 @@
 #include "SkimTree.h"
 #include "GlobalFlag.h"
 
+class EtaIndex;
+
 // Standalone gen-jet matcher (call from Run* call-site).
 class PickGenJet {
 public:
@@ -30,11 +32,16 @@ public:
 
     explicit PickGenJet(const GlobalFlag& globalFlags);
 
-    // Match based on reco-jet presence by indices (iJet != -1)
+    // Match based on reco-jet presence by indices (iJet != -1).
+    // genJets: the event's gen-jet index (fwk::prod::GenJetIndex); plain loops if null.
     Result matchByRecoIndices(const SkimTree& skimT,
                               int iJet1, int iJet2,
                               const TLorentzVector& p4Jet1,
-                              const TLorentzVector& p4Jet2) const;
+                              const TLorentzVector& p4Jet2,
+                              const EtaIndex* genJets = nullptr) const;
+
+    // All gen jets of the event by eta, for fwk::prod::GenJetIndex
+    static void indexGenJets(const SkimTree& skimT, EtaIndex& genJets);
 
     // Match based on reco-jet presence by p4 (Pt > 0)
     Result matchByRecoP4(const SkimTree& skimT,
@@ -58,8 +65,6 @@ private:
     void loadConfig_(const std::string& cfgFile);
     void validateConfig_() const;
 
-    void printDebug_(const std::string& msg) const;
-
     static void requireFinite_(double x, const std::string& what);
     static TLorentzVector makeP4_(double pt, double eta, double phi, double mass);
 
@@ -67,5 +72,10 @@ private:
                       bool want1, bool want2,
                       const TLorentzVector& p4Jet1,
                       const TLorentzVector& p4Jet2) const;
+    Result matchIndexed_(const SkimTree& skimT,
+                         bool want1, bool want2,
+                         const TLorentzVector& p4Jet1,
+                         const TLorentzVector& p4Jet2,
+                         const EtaIndex& genJets) const;
 };
 
@@ -10,7 +10,8 @@ public:
     // Type-safe working point labels
     enum class WorkingPoint {
         Tight,
-        TightLepVeto
+        TightLepVeto,
+        Unknown       // unrecognised config label: every jet fails
     };
 
     PickJet(const GlobalFlag& globalFlags);
@@ -20,6 +21,9 @@ public:
     bool passId(const SkimTree& skimT, int jetIndex, WorkingPoint wp) const;
     bool passId(const SkimTree& skimT, int jetIndex, const std::string& label) const;
 
+    // Parse a config label once ("Tight", "tightLepVeto", ...); callers keep the enum.
+    static WorkingPoint parseWorkingPoint(const std::string& label);
+
     // Explicit helpers (nice for readability in callers)
     bool passTight(const SkimTree& skimT, int jetIndex) const;
     bool passTightLepVeto(const SkimTree& skimT, int jetIndex) const;
@@ -29,8 +33,6 @@ private:
     GlobalFlag::NanoVersion  nanoVersion_;
     GlobalFlag::JetAlgo  jetAlgo_;
 
-    void printDebug(const std::string& message) const;
-
     // Helpers
     bool useLegacyJetId_() const;
     bool passTightLegacy_(const SkimTree& skimT, int jetIndex) const;
@@ -30,11 +30,11 @@ private:
     const GlobalFlag&      globalFlags_;
     PickJet pickJet_;
     const bool       isDebug_;
-    void             printDebug(const std::string& msg) const;
 
     // selection thresholds:
     double minPtProbe_;       
     std::string jetIdLabel_;
+    PickJet::WorkingPoint jetIdWp_{PickJet::WorkingPoint::Unknown}; // parsed jetIdLabel_
     double maxEtaRecoil_;    
     double minPtRecoil_;     
     double minPtOther_;      
@@ -37,14 +37,13 @@ private:
     double jetMinPt_;
     double jetMaxEta_;
     std::string jetIdLabel_;
+    PickJet::WorkingPoint jetIdWp_{PickJet::WorkingPoint::Unknown}; // parsed jetIdLabel_
 
     // temporary containers
     std::vector<int> pickedElectrons_;
     std::vector<int> pickedJets_;
     std::vector<int> pickedBJets_;
 
-    void printDebug(const std::string& message);
-
     // load *all* thresholds from JSON
     void loadConfig(const std::string& filename);
 };
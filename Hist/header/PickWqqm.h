@@ -38,6 +38,7 @@ private:
     double jetMinPt_;
     double jetMaxEta_;
     std::string jetIdLabel_;
+    PickJet::WorkingPoint jetIdWp_{PickJet::WorkingPoint::Unknown}; // parsed jetIdLabel_
 
     // temporary containers
     std::vector<int> pickedMuons_;
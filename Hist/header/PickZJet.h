@@ -63,6 +63,7 @@ private:
     double maxEtaProbeJet_{999.0};
     double minDeltaRtoLepton_{0.4};
     std::string jetIdLabel_;
+    PickJet::WorkingPoint jetIdWp_{PickJet::WorkingPoint::Unknown}; // parsed jetIdLabel_
     int requiredJet_lepIdx1_{-1};
     int requiredJet_lepIdx2_{-1};
 
@@ -76,7 +77,5 @@ private:
 
     void loadConfig(const std::string& filename);
     void validateConfig_() const;
-
-    void printDebug(const std::string& msg) const;
 };
 
@@ -71,7 +71,6 @@ private:
     // Common Z+jet helper
     PickZJet zJet_;
 
-    void printDebug(const std::string& message) const;
     void loadConfig(const std::string& filename);
 };
 
@@ -1,4 +1,5 @@
 #pragma once
+#include <memory>
 #include <string>
 #include <initializer_list>
 #include "nlohmann/json.hpp"
@@ -12,10 +13,11 @@ public:
     // Example usage: getValue<double>({"electronPick", "minPt"})
     template <typename T>
     T getValue(std::initializer_list<std::string> keys) const {
-        nlohmann::json current = config_;
+        // Walk the shared, parsed document by pointer; no sub-tree copies.
+        const nlohmann::json* current = config_.get();
         std::string path;
         for (const auto& key : keys) {
-            if (!current.contains(key)) {
+            if (!current->contains(key)) {
                 if (path.empty()) {
                     path = key;
                 } else {
@@ -27,13 +29,13 @@ public:
                 path = key;
             else
                 path += "/" + key;
-            current = current[key];
+            current = &current->at(key);
         }
-        return current.get<T>();
+        return current->get<T>();
     }
 
 private:
-    nlohmann::json config_;
+    std::shared_ptr<const nlohmann::json> config_; // owned by ResourceCache
     std::string filename_;
 };
 
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include "correction.h"
+
+/**
+ * Process-wide cache of parsed, read-only inputs keyed by file path.
+ *
+ * Loaders used to re-parse the same correctionlib JSON for every reference
+ * (ScaleJetLoader alone opened the JERC file six times), and every job in a
+ * multi-job runMain would re-read them again. Entries live until clear();
+ * the returned objects are immutable and can be shared freely.
+ */
+class ResourceCache {
+public:
+    // correction::CorrectionSet::from_file(path), parsed once.
+    static std::shared_ptr<const correction::CorrectionSet> correctionSet(const std::string& path);
+
+    // Any JSON file (configs, golden lumi, ...). Throws std::runtime_error if unreadable.
+    static std::shared_ptr<const nlohmann::json> json(const std::string& path);
+
+    static void clear();
+    static void printStats(std::ostream& os);
+};
@@ -16,6 +16,11 @@ public:
                           const std::string& syst = "central",
                           double btagCut = -1.0) const;
 
+    // Nominal + b/l up/down weights in one pass (prefer over repeated getEventWeight calls)
+    BtagEventWeights getEventWeights(const SkimTree& skimT,
+                                     const std::vector<int>& jetIdx,
+                                     double btagCut = -1.0) const;
+
     void setEffType(const std::string& effType) { functions_.setEffType(effType); }
 
     const std::string& effType() const { return functions_.effType(); }
@@ -14,38 +14,102 @@
 class TH2;
 class TAxis;
 
+class ScaleFunctionGuard;
+
+// Event weights for the nominal and every BTV up/down variation, filled in one pass.
+struct BtagEventWeights {
+    double central{1.0};
+    double bUp{1.0};
+    double bDown{1.0};
+    double lUp{1.0};
+    double lDown{1.0};
+
+    // Same keys as getEventWeight(syst): b_up, b_down, l_up, l_down, anything else -> central
+    double get(const std::string& syst) const {
+        if (syst == "b_up")   return bUp;
+        if (syst == "b_down") return bDown;
+        if (syst == "l_up")   return lUp;
+        if (syst == "l_down") return lDown;
+        return central;
+    }
+};
+
 class ScaleBtagFunction {
 public:
     explicit ScaleBtagFunction(const GlobalFlag& globalFlags);
 
+    // One variation: a single SF evaluation per jet.
     double getEventWeight(const SkimTree& skimT,
                           const std::vector<int>& jetIdx,
                           const std::string& syst = "central",
                           double btagCut = -1.0) const;
 
-    void setEffType(const std::string& effType) { loader_.setEffType(effType); }
+    // Nominal + all systematic weights from a single loop over the jets
+    // (three SF evaluations per jet); use when the variations are filled too.
+    BtagEventWeights getEventWeights(const SkimTree& skimT,
+                                     const std::vector<int>& jetIdx,
+                                     double btagCut = -1.0) const;
+
+    void setEffType(const std::string& effType) {
+        loader_.setEffType(effType);
+        tablesReady_ = false;
+    }
 
     const std::string& effType() const { return loader_.effType(); }
     const std::string& algo()    const { return loader_.algo(); }
     const std::string& wp()      const { return loader_.wp(); }
 
 private:
-    // helpers
-    static void   parseSyst(const std::string& syst, std::string& b_syst, std::string& l_syst);
-    static double clampInsideAxis_(const TAxis* ax, double x);               // [xmin, nextafter(xmax,xmin)]
-    static double getBinContent2D_(const TH2* h2, double x, double y);       // axis-aware clamp
+    // Efficiency TH2 flattened into plain edge/content arrays (row-major in x).
+    struct EffTable {
+        std::vector<double> xEdges;
+        std::vector<double> yEdges;
+        std::vector<double> content;  // size nx*ny, already sanitised to [0, 1]
+
+        void build(const TH2* h2);
+        double lookup(double x, double y) const; // axis-aware clamp, same bins as TH2::FindBin
+    };
+
+    // Per-jet inputs gathered once, grouped by flavour class.
+    struct JetIn {
+        int    idx;
+        int    flav;
+        double pt;
+        double eta;
+        double eff;
+        bool   tagged;
+        double sfAbsEta; // clamped into the SF validity window
+        double sfPt;
+    };
+
     static double clampInside_(double v, double lo, double hi_inclusive);    // [lo, nextafter(hi,lo)]
 
-    double getPerJetEff_(int flavor, double pt, double abseta) const;
-    double getPerJetSF_(int flavor, double pt, double eta,
-                        const std::string& b_syst, const std::string& l_syst) const;
+    static void parseSyst_(const std::string& syst, std::string& bSyst, std::string& lSyst);
+
+    void ensureTables_() const;   // lazy: flatten the eff TH2s
+    const EffTable& effTable_(int flavor) const;
+
+    // Fills heavy_/light_ for jetIdx and returns the MC probability
+    double gatherJets_(const SkimTree& skimT, const std::vector<int>& jetIdx,
+                       double btagCut, ScaleFunctionGuard& guard) const;
+    // SF of one jet; retries one ulp inside the window, 1.0 if still rejected
+    double evaluateSf_(const correction::Correction::Ref& corr,
+                       const std::string& sys, const JetIn& in) const;
 
 private:
     ScaleBtagLoader loader_; // composition: Loader used ONLY here
 
+    mutable EffTable effB_;
+    mutable EffTable effC_;
+    mutable EffTable effL_;
+    mutable bool tablesReady_{false};
+
+    // scratch (reused across events to avoid per-event allocation)
+    mutable std::vector<JetIn> heavy_;
+    mutable std::vector<JetIn> light_;
+
     const GlobalFlag& globalFlags_;
     const bool isDebug_;
     const bool isData_;
     const bool isMC_;
 };
-
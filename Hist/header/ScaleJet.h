@@ -7,32 +7,48 @@
 #include "TLorentzVector.h"
 #include "SkimTree.h"
 #include "ScaleJetFunction.h"
+#include "JetQuality.h"
 #include "GlobalFlag.h"
+#include "CorrectedJets.hpp"
+#include "JecSteps.hpp"
 
 class ScaleJet {
 public:
     explicit ScaleJet(const GlobalFlag& globalFlags);
 
+    // Fills the CorrectedJets collection from the untouched Jet_ptNano/Jet_massNano,
+    // copies the corrected jets into the Jet_pt/Jet_mass view and refreshes the
+    // jet quality bits.
     void applyCorrection(std::shared_ptr<SkimTree>& skimT);
 
     const std::unordered_map<std::string, TLorentzVector>& getP4MapJet1() const { return p4MapJet1_; }
     const std::unordered_map<std::string, TLorentzVector>& getP4MapJetSum() const { return p4MapJetSum_; }
-    const std::vector<double>& getJetPtRaw() const { return jet_pt_raw_; }
+    const CorrectedJets& getCorrectedJets() const { return jets_; }
 
 private:
     ScaleJetFunction functions_;
+    JetQuality jetQuality_;
     const GlobalFlag& globalFlags_;
-    const GlobalFlag::JecApplicationLevel level_;
+    const JecStepsRuntime jecSteps_;
 
     // cached flags (initialized once)
     const bool isDebug_;
     const bool isData_;
-    const bool isBookKeep_;
-    const GlobalFlag::JetAlgo jetAlgo_;
     const bool applyJer_; // MC-only (applyJer && !isData)
 
     std::unordered_map<std::string, TLorentzVector> p4MapJet1_;
     std::unordered_map<std::string, TLorentzVector> p4MapJetSum_;
-    std::vector<double> jet_pt_raw_;
+    CorrectedJets jets_;
+
+    // correctJets_ specialised for this job's JEC steps (set once in the
+    // constructor); a member pointer, so a copy calls its own instance
+    using CorrectFn = void (ScaleJet::*)(SkimTree&);
+    CorrectFn correct_{nullptr};
+
+    template <class Steps>
+    void correctJetsAs_(SkimTree& skimT);
+    template <class Steps>
+    void correctJets_(SkimTree& skimT, const Steps& steps);
+    void fillView_(SkimTree& skimT);
 };
 
@@ -9,6 +9,9 @@ class ScaleJetFunction {
 public:
     ScaleJetFunction(const GlobalFlag& globalFlags);
 
+    // Data: select the JEC IOV for this event's run (cheap while the run stays in it)
+    void selectRun(unsigned run) { loader_.selectRun(run); }
+
     double getL1FastJetCorrection(double jetArea, double jetEta, double jetPt, double rho) const;
     double getL2RelativeCorrection(double jetEta, double jetPt) const;
     double getL2ResidualCorrection(double jetEta, double jetPt) const;
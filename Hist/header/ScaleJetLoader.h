@@ -1,14 +1,22 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include "GlobalFlag.h"
 #include "correction.h"
 
+class ReadConfig;
+
 /**
  * @brief Load JERC config and hold all Correction::Ref objects.
  *
  * This class owns the correction references and exposes them
  * to the function class.
+ *
+ * Data JECs are kept per interval of validity (IOV): one run range per
+ * "data"/"Era..." entry of the config. An ioName with an era (2018A) loads
+ * that era only; a year-only data ioName (2018) loads every era of the year
+ * and selectRun() switches the refs to the IOV of the event's run.
  */
 class ScaleJetLoader {
 public:
@@ -34,6 +42,14 @@ public:
 
     const correction::Correction::Ref& jerSmearRef() const { return jerSmearRef_; }
 
+    // Data: point the JEC refs at the IOV containing `run`. Runs come in
+    // order, so the common case is one range check against the current IOV.
+    void selectRun(unsigned run) {
+        if (run >= curFirstRun_ && run <= curLastRun_) return;
+        if (iovs_.size() > 1) selectIov(findIov(run));
+    }
+    const std::string& currentEra() const { return curEra_; }
+
 private:
     const GlobalFlag& globalFlags_;
     const GlobalFlag::Year year_;
@@ -68,8 +84,31 @@ private:
     correction::Correction::Ref loadedJerResoRef_;
     correction::Correction::Ref loadedJerSfRef_;
 
+    // data IOVs, sorted by firstRun
+    struct DataIov {
+        unsigned firstRun{0};
+        unsigned lastRun{0};
+        std::string era;
+        std::string jetL1FastJetName;
+        std::string jetL2RelativeName;
+        std::string jetL2ResidualName;
+        std::string jetL2L3ResidualName;
+        correction::Correction::Ref jetL1FastJetRef;
+        correction::Correction::Ref jetL2RelativeRef;
+        correction::Correction::Ref jetL2ResidualRef;
+        correction::Correction::Ref jetL2L3ResidualRef;
+    };
+    std::vector<DataIov> iovs_;
+    // current IOV; the full range for MC and single-era data
+    unsigned curFirstRun_{0};
+    unsigned curLastRun_{~0u};
+    std::string curEra_;
+
     void loadConfig(const std::string& filename);
     void loadRefs();
+    void loadDataIovs(const ReadConfig& config, const std::string& yearStr);
+    std::size_t findIov(unsigned run) const;
+    void selectIov(std::size_t index);
 
     void loadJetL1FastJetRef();
     void loadJetL2RelativeRef();
@@ -8,13 +8,15 @@
 #include "SkimTree.h"
 #include "ScaleJetFunction.h"
 #include "GlobalFlag.h"
+#include "CorrectedJets.hpp"
+#include "JecSteps.hpp"
 
 class ScaleMet {
 public:
     explicit ScaleMet(const GlobalFlag& globalFlags);
 
     void applyCorrection(const std::shared_ptr<SkimTree>& skimT,
-                         const std::vector<double>& jetPtRaw);
+                         const CorrectedJets& jets);
 
     const std::unordered_map<std::string, TLorentzVector>& getP4MapMet() const { return p4MapMet_; }
     TLorentzVector getP4CorrectedMet() const { return p4CorrectedMet_; }
@@ -22,18 +24,26 @@ public:
 private:
     ScaleJetFunction functions_;
     const GlobalFlag& globalFlags_;
-    const GlobalFlag::JecApplicationLevel level_;
+    const JecStepsRuntime jecSteps_;
 
     // cached flags (initialized once)
     const bool isDebug_;
     const bool isData_;
     const bool isBookKeep_;
-    const GlobalFlag::JetAlgo jetAlgo_;
-    const bool applyJer_; // MC-only (applyJer && !isData)
 
     std::unordered_map<std::string, TLorentzVector> p4MapMet_;
     TLorentzVector p4CorrectedMet_;
 
+    // addType1_ specialised for this job's JEC steps (set once in the
+    // constructor); a member pointer, so a copy calls its own instance
+    using Type1Fn = void (ScaleMet::*)(const SkimTree&, const CorrectedJets&, double&, double&);
+    Type1Fn type1_{nullptr};
+
+    template <class Steps>
+    void addType1As_(const SkimTree& skimT, const CorrectedJets& jets, double& metPx, double& metPy);
+    template <class Steps>
+    void addType1_(const SkimTree& skimT, const CorrectedJets& jets,
+                   const Steps& steps, double& metPx, double& metPy);
     void printDebug(const std::unordered_map<std::string, TLorentzVector>& p4MapJetSum) const;
 };
 
@@ -19,7 +19,11 @@ public:
 
     // -------- Rochester (kinematics) --------
     double getMuonRochCorrection(const SkimTree& skimT, int index, const std::string& syst) const;
-    void applyCorrections(std::shared_ptr<SkimTree>& skimT); // applies p4 corrections only
+    // Applies p4 corrections only. genMuonMatch: per-muon gen matches of this
+    // event (fwk::prod::GenMuonMatch); matched here when null.
+    void applyCorrections(std::shared_ptr<SkimTree>& skimT,
+                          const std::vector<int>* genMuonMatch = nullptr);
+    void matchGenMuons(const SkimTree& skimT, std::vector<int>& genIdx) const;
 
     // -------- SFs (weights) --------
     double getMuonIdSf(double pt, double eta, SystLevel syst = SystLevel::Nominal)  const;
@@ -46,5 +50,6 @@ private:
     const bool isMC_;
 
     std::unordered_map<std::string, TLorentzVector> p4MapMuon1_;
+    std::vector<int> genMuonMatch_; // used when no product is passed in
 };
 
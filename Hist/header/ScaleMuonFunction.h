@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include <algorithm>   // std::clamp
 #include <cmath>
 
@@ -26,6 +27,11 @@ public:
 
     // -------- Rochester (kinematics) --------
     double getMuonRochCorrection(const SkimTree& skimT, int index, const std::string& syst) const;
+    // genIdx: matched GenDressedLepton (matchGenMuons), -1 if unmatched
+    double getMuonRochCorrection(const SkimTree& skimT, int index, const std::string& syst,
+                                 int genIdx) const;
+    // genIdx[j]: gen muon matched to reco muon j (all -1 for data)
+    void matchGenMuons(const SkimTree& skimT, std::vector<int>& genIdx) const;
 
     // -------- SFs (weights) --------
     double getMuonIdSf(double pt, double eta, SystLevel syst = SystLevel::Nominal)  const;
@@ -38,6 +44,7 @@ public:
 private:
     double getSfFromHist(const TH2* h2, double pt, double eta, SystLevel syst) const;
     static SystLevel parseSyst(const std::string& s);
+    static int genMuonFor_(const SkimTree& skimT, double eta, double phi);
 
 private:
     ScaleMuonLoader loader_;  // composition: Loader used ONLY here
@@ -21,9 +21,13 @@ public:
     void setupMetBranches(TChain* chain);
     void printDebug() const;
 
-    // Called after each GetEntry to convert v15 → canonical
+    // Called after each GetEntry: converts the v15 counters and marks the
+    // v15 arrays as pending; SkimBranch::require converts them on demand.
     void afterGetEntry();
 
+    // Convert the pending arrays among `collections` (SkimBranch::V15Collection bits)
+    void convertCollections(unsigned collections);
+
 private:
     // ------------------------------------------------------------------
     // Global flags (mirroring SkimReader style)
@@ -55,6 +59,9 @@ private:
     bool enableGenPart_{false};
     bool enablePSWeight_{false};
 
+    // SkimBranch::V15Collection bits with v15 buffers bound (set in setup*Branches)
+    unsigned v15Collections_{0};
+
     // ------------------------------------------------------------------
     // v15-only buffers (internal)
     // ------------------------------------------------------------------
@@ -103,6 +110,9 @@ private:
     UShort_t GenPart_statusFlags_v15_[SkimBranch::nGenPartMax]{};
 
     // Helpers
+    // Widening copy over the n valid entries. The fixed-size inner block has
+    // no aliasing or trip-count checks, so -O2 emits it as SIMD widening
+    // loads/stores; the remainder is scalar.
     template <typename Tdst, typename Tsrc>
     inline void convertArray_(Tdst* __restrict dst,
                               const Tsrc* __restrict src,
@@ -112,12 +122,19 @@ private:
             // For identical types the compiler can inline this as a memcpy
             std::memcpy(dst, src, n * sizeof(Tdst));
         } else {
-            for (std::size_t i = 0; i < n; ++i) {
+            constexpr std::size_t kBlock = 16;
+            std::size_t i = 0;
+            for (; i + kBlock <= n; i += kBlock) {
+                for (std::size_t k = 0; k < kBlock; ++k) {
+                    dst[i + k] = static_cast<Tdst>(src[i + k]);
+                }
+            }
+            for (; i < n; ++i) {
                 dst[i] = static_cast<Tdst>(src[i]);
             }
         }
     }
 
-    void convertV15ToV9();
+    void convertV15Counters_();
 };
 
@@ -2,10 +2,12 @@
 
 #include <fstream>
 #include <string>
+#include <utility>
 #include <vector>
 #include <nlohmann/json.hpp>
 
 #include "GlobalFlag.h"
+#include "SkimFileIndex.h"
 
 class SkimFile {
 public:
@@ -20,6 +22,7 @@ public:
     void loadInput();
 
     void setInputJsonPath(const std::string& inDir);
+    [[nodiscard]] const std::string& getInputJsonPath() const { return inputJsonPath_; }
     void loadInputJson();
 
     [[nodiscard]] const std::string& getSampleKey() const { 
@@ -36,6 +39,15 @@ public:
         return loadedJobFileNames_; 
     }
 
+    // runMain -S: re-split the sample at cluster boundaries so that job N of M
+    // reads the Nth slice of about 1/M of the compressed bytes. Every file
+    // must be in the index; the job reads [first, last) of its chain.
+    void splitAtClusters(const SkimFileIndex& index);
+
+    [[nodiscard]] std::pair<Long64_t, Long64_t> getJobEntryRange() const {
+        return jobEntryRange_;
+    }
+
     [[nodiscard]] const double & getXsecOrLumiNano() const { 
         return nanoXssOrLumi_; 
     }
@@ -53,6 +65,7 @@ private:
     std::string inputJsonPath_ = "./FilesSkim_2022_GamJet.json";
     std::vector<std::string> loadedAllFileNames_;
     std::vector<std::string> loadedJobFileNames_;
+    std::pair<Long64_t, Long64_t> jobEntryRange_{0, -1}; // set by splitAtClusters
 
     // Reference to GlobalFlag instance and related constant members
     GlobalFlag& globalFlags_;
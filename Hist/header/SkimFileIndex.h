@@ -0,0 +1,76 @@
+// header/SkimFileIndex.h
+#pragma once
+
+#include <RtypesCore.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class TTree;
+
+/**
+ * Per-file metadata of the skim inputs, written once by `runMain -x` next to
+ * the FilesSkim JSONs (input/json/FileIndex_<algo>_<level>_<channel>_<year>.json,
+ * keyed by sample, then by file path).
+ *
+ * SkimReader trusts an indexed file: it is added to the TChain with its entry
+ * count (no open until the event loop reaches it), and the UUID and entry
+ * count are checked when the file is first loaded. Files missing from the
+ * index fall back to open-validate-close.
+ */
+class SkimFileIndex {
+public:
+    struct Entry {
+        Long64_t size{0};                 // bytes
+        Long64_t entries{0};              // Events entries; 0 = unusable file
+        std::vector<Long64_t> clusters;   // first entry of every Events cluster
+        std::vector<Long64_t> clusterBytes; // compressed bytes per cluster (empty in old indexes)
+        std::string nano;                 // "V9" or "V15", from the nJet leaf type
+        std::string uuid;                 // TFile UUID
+    };
+
+    // Entries [first, last) of one file, cut at cluster boundaries, with the
+    // compressed bytes of their baskets. SkimReader shifts them to chain entries.
+    struct WorkUnit {
+        std::string file;
+        Long64_t first{0};
+        Long64_t last{0};
+        Long64_t bytes{0};
+    };
+
+    SkimFileIndex() = default;
+
+    // Load the sample's entries from indexPath. A missing file or sample
+    // gives an empty index (every lookup falls back).
+    SkimFileIndex(const std::string& indexPath, const std::string& sampleKey);
+
+    const Entry* find(const std::string& path) const;
+    std::size_t size() const { return entries_.size(); }
+    bool covers(const std::vector<std::string>& paths) const;
+    bool empty() const { return entries_.empty(); }
+
+    // One unit per cluster of an indexed file (bytes shared out by entries
+    // when the index has no clusterBytes)
+    static std::vector<WorkUnit> workUnits(const std::string& path, const Entry& e);
+
+    // Cluster starts of a tree and the compressed basket bytes of each cluster
+    static std::vector<Long64_t> clusterStarts(TTree* tree);
+    static std::vector<Long64_t> clusterBytes(TTree* tree, const std::vector<Long64_t>& starts);
+
+    // Index path for a FilesSkim_<...>.json path
+    static std::string indexPathFor(const std::string& filesSkimJsonPath);
+
+    // Read the metadata of one skim file. Unusable files (unreadable, no or
+    // empty Events tree, under minFileSize bytes) get entries = 0.
+    static Entry readEntry(const std::string& path);
+
+    // -x mode: (re)build the index of every sample in the given FilesSkim
+    // JSONs. Files already in the index are kept; delete it to rebuild.
+    static int buildIndexes(const std::vector<std::string>& filesSkimJsons, bool isDebug);
+
+    static constexpr Long64_t minFileSize = 3000;
+
+private:
+    std::unordered_map<std::string, Entry> entries_;
+};
@@ -19,13 +19,22 @@ public:
     // Access
     bool getValue(const std::string& name) const;
 
+    // Bit i set if trigger id i (Hlt::getTrigNames() order) fired in this entry
+    Hlt::TrigMask mask() const {
+        Hlt::TrigMask m = 0;
+        for (std::size_t i = 0; i < names_.size(); ++i) {
+            m |= static_cast<Hlt::TrigMask>(values_[i] != 0) << i;
+        }
+        return m;
+    }
+
     const std::vector<std::string>& names() const { return names_; }
 
 private:
     Hlt&  hlt_;
     bool  debug_;
 
-    static constexpr int kMaxTrig = 200;
+    static constexpr std::size_t kMaxTrig = Hlt::kMaxTrigIds;
 
     std::vector<std::string> names_;
     Bool_t                   values_[kMaxTrig]{};
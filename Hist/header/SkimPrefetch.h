@@ -0,0 +1,58 @@
+// header/SkimPrefetch.h
+#pragma once
+
+#include <RtypesCore.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+class TFileOpenHandle;
+
+/**
+ * Opens the skim files ahead of the TChain so a file switch in the event
+ * loop does not wait for an xrootd open.
+ *
+ * Opt-in (runMain -a <n>, off by default). The next `depth` remote files
+ * (root://) of the chain are requested with TFile::AsyncOpen, which lets
+ * several small files open concurrently; when the chain reaches one of them,
+ * TFile::Open picks up the pending handle. With any remote file in the chain,
+ * TFile.AsyncPrefetching is switched on for the lifetime of this object so
+ * the TTreeCache reads the following baskets on ROOT's prefetch thread; the
+ * previous value is restored afterwards. Requests the chain never reached
+ * (early stop, debug event limit) are completed and closed on destruction.
+ * Local files are left to the chain (their open is cheap).
+ */
+class SkimPrefetch {
+public:
+    explicit SkimPrefetch(int depth, bool debug = false);
+    ~SkimPrefetch();
+
+    // Chain files in tree order; requests the first `depth` of them
+    void setFiles(std::vector<std::string> files);
+
+    // Called when the chain moves to tree `treeNumber`: keep the following
+    // `depth` files requested
+    void onTreeSwitch(Int_t treeNumber);
+
+    static bool isRemote(const std::string& path);
+
+    SkimPrefetch(const SkimPrefetch&)            = delete;
+    SkimPrefetch& operator=(const SkimPrefetch&) = delete;
+
+private:
+    int   depth_;
+    bool  debug_;
+
+    std::vector<std::string> files_;
+    std::size_t              nextToOpen_{0};  // first file not yet requested
+
+    // (file index, handle) requested but not yet reached by the chain
+    std::vector<std::pair<std::size_t, TFileOpenHandle*>> pending_;
+
+    bool asyncPrefetchSet_{false};
+    int  asyncPrefetchPrev_{0};
+
+    void requestUpTo_(std::size_t end);
+    void closePending_();
+};
@@ -6,6 +6,8 @@
 #include "SkimAdapter.h"
 #include "SkimHlt.h"
 #include "Hlt.h"
+#include "SkimFileIndex.h"
+#include "SkimPrefetch.h"
 
 #include <TChain.h>
 #include <TFile.h>
@@ -14,18 +16,34 @@
 #include <string>
 #include <vector>
 
+class TBranch;
+
 class SkimReader {
 public:
     SkimReader(GlobalFlag& flags, SkimBranch& branches);
     ~SkimReader();
 
-    void loadTree(const std::vector<std::string>& files);
+    // Files found in `index` are added with their indexed entry count and are
+    // not opened here; the others are validated by opening them.
+    void loadTree(const std::vector<std::string>& files, const SkimFileIndex* index = nullptr);
 
+    // Entries are counted from the start of the entry range (whole chain by
+    // default)
     Long64_t getEntries() const;
     Int_t    getEntry(Long64_t entry);
+    // Read only run and luminosityBlock of `entry`; false if it is not readable
+    bool     readRunLumi(Long64_t entry);
+
+    // Restrict the job to chain entries [first, last)
+    void     setEntryRange(Long64_t first, Long64_t last);
+
+    // (file, entry range) units covering the chain, in chain entries: one per
+    // cluster of an indexed file, one per non-indexed file
+    const std::vector<SkimFileIndex::WorkUnit>& workUnits() const { return workUnits_; }
 
     // HLT façade
     bool getTrigValue(const std::string& name) const;
+    Hlt::TrigMask trigMask() const { return skimCache_.mask(); }
     const std::vector<std::string>& triggerNames() const;
 
     TChain* getChain() const { return chain_.get(); }
@@ -37,6 +55,23 @@ private:
     std::unique_ptr<TChain> chain_;
     Int_t                   currentTree_{-1};
 
+    // Per chain tree: indexed entry count and UUID, checked when the tree is
+    // first loaded (entries < 0: not indexed)
+    struct IndexedTree {
+        Long64_t    entries{-1};
+        std::string uuid;
+    };
+    std::vector<IndexedTree> indexedTrees_;
+    std::vector<SkimFileIndex::WorkUnit> workUnits_;
+
+    Long64_t firstEntry_{0};
+    Long64_t lastEntry_{-1};   // < 0: end of chain
+
+    // run/luminosityBlock branches of the tree loaded by readRunLumi
+    Int_t    runLumiTree_{-1};
+    TBranch* runBranch_{nullptr};
+    TBranch* lumiBranch_{nullptr};
+
     const GlobalFlag::Year        year_;
     const GlobalFlag::Era         era_;
     const GlobalFlag::Channel     channel_;
@@ -49,12 +84,14 @@ private:
     SkimAdapter  skimAdapter_;
     Hlt          hlt_;
     SkimHlt skimCache_;
+    SkimPrefetch skimPrefetch_;
 
     // helpers
-    bool   buildChain_(const std::vector<std::string>& files);
+    bool   buildChain_(const std::vector<std::string>& files, const SkimFileIndex* index);
+    void   checkIndexedTree_(Int_t treeNumber) const;
     void   setupBranches_();
 
     TFile* validateAndOpenFile_(const std::string& fullPath);
-    bool   addFileToChain_(const std::string& fullPath);
+    bool   addFileToChain_(const std::string& fullPath, Long64_t nEntries);
 };
 
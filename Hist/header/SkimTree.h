@@ -19,13 +19,21 @@ public:
     Long64_t getEntries() const;
     TChain*  getChain() const;  // Getter function to access TChain
     Int_t    getEntry(Long64_t entry);
+    bool     readRunLumi(Long64_t entry); // fills run and luminosityBlock only
+    void     setEntryRange(Long64_t first, Long64_t last); // chain entries [first, last)
+    const std::vector<SkimFileIndex::WorkUnit>& getWorkUnits() const; // per cluster (indexed files)
 
-    void loadTree(const std::vector<std::string>& skimFileList);
+    // Copy the untouched Jet_ptNano/Jet_massNano into the Jet_pt/Jet_mass view.
+    void resetJetView();
+
+    void loadTree(const std::vector<std::string>& skimFileList,
+                  const SkimFileIndex* fileIndex = nullptr);
 
     // HLT 
     const std::string* getTrigNames() const;
     std::size_t        getNumTrigNames() const;
     Bool_t             getTrigValue(const std::string& trigName) const;
+    Hlt::TrigMask      getTrigMask() const;   // bit = Hlt trigger id
 
     // Disable copying and assignment 
     SkimTree(const SkimTree&)            = delete;
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+class TDirectory;
+
+namespace fwk {
+
+struct Context;
+
+// Periodic, atomic snapshot of the job state for preemptible slots.
+//
+// The sidecar holds a copy of every in-memory histogram under the output file
+// (same directory layout), the CutflowService counts and the next chain entry
+// to process. It is written to <path>.tmp and renamed over <path>, so a kill
+// at any point leaves either the previous or the new snapshot on disk.
+// On resume the freshly booked (empty) histograms are Add()-ed with the
+// snapshot and the Driver continues from the stored entry.
+class CheckpointService {
+public:
+    CheckpointService(std::string path, double everySeconds, bool resume);
+
+    // Returns the first chain entry to process (0 unless resuming from a sidecar).
+    long long restore(Context& ctx);
+
+    // Cheap per-event hook: looks at the clock every kCheckEvery entries.
+    void maybeWrite(Context& ctx, long long nextEntry);
+    void write(Context& ctx, long long nextEntry);
+
+    // The output file is complete: the sidecar is no longer needed.
+    void finish();
+
+    const std::string& path() const { return path_; }
+
+    // output/<ioName>.ckpt
+    static std::string defaultPath(const std::string& outDir, const std::string& ioName);
+
+private:
+    static void copyDir_(TDirectory* mem, TDirectory* out);
+    static void addDir_(TDirectory* ckpt, TDirectory* mem);
+
+    static constexpr long long kCheckEvery = 1000;
+
+    std::string path_;
+    double everySeconds_;
+    bool resume_;
+
+    long long nSinceCheck_ = 0;
+    long long nWritten_ = 0;
+    std::chrono::steady_clock::time_point last_;
+};
+
+} // namespace fwk
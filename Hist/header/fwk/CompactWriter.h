@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+class TDirectory;
+class TFile;
+class THnSparse;
+class TProfile2D;
+
+namespace fwk {
+
+// Trimmed output format for Hist jobs (runMain -z).
+//
+// Replaces TFile::Write() at the end of a job:
+//  - histograms with no entries are not written (and stale keys of them removed),
+//  - TProfile2D with few filled cells are stored as a THnSparseD whose third
+//    axis holds the four per-cell moments (sum w, sum wy, sum wy^2, sum w^2);
+//    THnSparse::Add sums moments, so hadd merges them like the profile itself,
+//  - every object is written with a compression setting chosen by its type,
+//  - a small "CompactIndex" tree lists what was written (path, original and
+//    stored class, entries, filled cells), so merge tools can plan a merge
+//    from the index alone and copy objects found in a single input unopened.
+// toProfile2D() turns a stored sparse profile back into the TProfile2D.
+class CompactWriter {
+public:
+    // Sparse storage only pays off for mostly empty profiles.
+    static constexpr double kMaxSparseOccupancy = 0.25;
+
+    static constexpr const char* kIndexName = "CompactIndex";
+    static constexpr const char* kSparseTitlePrefix = "CompactProfile2D:";
+
+    explicit CompactWriter(TFile* fout);
+
+    // Write every in-memory object below the file; returns the objects written.
+    int write();
+
+    static THnSparse* toSparse(const TProfile2D& p);
+    static TProfile2D* toProfile2D(const THnSparse& s);
+    static bool isSparseProfile(const THnSparse& s);
+
+private:
+    struct Row {
+        std::string path;
+        std::string cls;
+        std::string stored;
+        double entries = 0.0;
+        int filled = 0;
+        int cells = 0;
+    };
+
+    void writeDir_(TDirectory* dir, const std::string& prefix);
+    void writeIndex_();
+
+    TFile* fout_; // non-owning
+    std::vector<Row> rows_;
+    int nSkipped_ = 0;
+    int nSparse_ = 0;
+};
+
+} // namespace fwk
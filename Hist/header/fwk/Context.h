@@ -13,6 +13,9 @@ class CutflowService;
 class TimerService;
 class ConfigService;
 class LoggerService;
+class EventCacheService;
+class CheckpointService;
+class LumiBlockService;
 
 struct Context {
     explicit Context(const GlobalFlag& gfIn);
@@ -29,6 +32,15 @@ struct Context {
     std::unique_ptr<TimerService> timer;
     std::unique_ptr<ConfigService> config;
     std::unique_ptr<LoggerService> log;
+
+    // Optional: null unless runMain was asked to write a replay cache.
+    std::unique_ptr<EventCacheService> eventCache;
+
+    // Optional: null unless periodic checkpoints (or a resume) were requested.
+    std::unique_ptr<CheckpointService> checkpoint;
+
+    // Optional: null for MC; per lumi-block state (and skipping) for data.
+    std::unique_ptr<LumiBlockService> lumiBlocks;
 };
 
 } // namespace fwk
@@ -1,7 +1,11 @@
 #pragma once
 
+#include "fwk/Products.h"
+
 namespace fwk {
 
+struct LumiBlock;
+
 struct Event {
     long long entry = -1;
 
@@ -10,6 +14,12 @@ struct Event {
     unsigned long long event = 0;
 
     double weight = 1.0;
+
+    // Data with a LumiBlockService: state of the event's (run, lumi) block.
+    const LumiBlock* block = nullptr;
+
+    // Cleared by the Driver before every entry; producers publish, consumers read by type.
+    EventProducts products;
 };
 
 } // namespace fwk
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "GlobalFlag.h"
+
+class PickEvent;
+class TFile;
+class TTree;
+
+namespace fwk {
+
+struct Context;
+
+// Writes a compact per-job replay cache: a clone of the "Events" tree that
+// keeps only the branches activated by SkimAdapter/SkimHlt (raw jets, rho,
+// tag objects, HLT bits, generator weights) and only the entries that pass
+// the JEC-independent prefilter (HLT, golden lumi). The cache keeps the skim
+// layout, so replaying it is just loading it in place of the skim files.
+class EventCacheService {
+public:
+    EventCacheService(const GlobalFlag& gf, std::string path);
+    ~EventCacheService();
+
+    void beginJob(Context& ctx);
+    void fill(Context& ctx);
+    void endJob();
+
+    const std::string& path() const { return path_; }
+
+    // output/EventCache_<ioName>
+    static std::string defaultPath(const std::string& outDir, const std::string& ioName);
+
+private:
+    const GlobalFlag& globalFlags_;
+    std::string path_;
+    const bool checkHlt_;
+
+    std::unique_ptr<PickEvent> pickEvent_;
+    std::unique_ptr<TFile> fout_;
+    TTree* tree_ = nullptr; // owned by fout_
+
+    long long nSeen_ = 0;
+    long long nKept_ = 0;
+};
+
+} // namespace fwk
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "GlobalFlag.h"
+#include "fwk/IModule.h"
+#include "fwk/Products.h"
+
+class HemVeto;
+class SkimTree;
+
+namespace fwk {
+
+class PickEventModule;
+class ScaleJetModule;
+class ScaleMetModule;
+class ScaleMuonModule;
+
+// Runs the event prologue shared by all channel modules once per entry and
+// publishes it on ev.products: prod::EventWeight, prod::CoreSelection,
+// prod::MuonCorrection, prod::GenMuonMatch, in MC a lazy prod::GenJetIndex
+// and, when it owns the JEC (correctJets), prod::JetCorrection,
+// prod::HemVetoFlag and a lazy prod::CorrectedMet.
+// The module never stops the chain, so downstream cutflows see every entry.
+//
+// Multi-target chains mix JEC application levels, so there the jets stay with
+// each target and only the level-independent steps run here.
+class EventPrepModule final : public IModule {
+public:
+    EventPrepModule(const GlobalFlag& gf, bool correctJets);
+    ~EventPrepModule() override;
+
+    std::string name() const override { return "EventPrepModule"; }
+
+    void beginJob(Context& ctx) override;
+    bool analyze(Context& ctx, Event& ev) override;
+
+private:
+    static void fillGenJetIndex_(const void* self, prod::GenJetIndex& out);
+
+    const GlobalFlag& globalFlags_;
+    const bool correctJets_;
+
+    std::unique_ptr<PickEventModule> pickEventModule_;
+    std::unique_ptr<ScaleMuonModule> scaleMuonModule_;
+    std::unique_ptr<ScaleJetModule> scaleJetModule_;
+    std::unique_ptr<ScaleMetModule> scaleMetModule_;
+    std::shared_ptr<HemVeto> hemVeto_;
+
+    // Input of the pending lazy gen-jet index (valid for the current event).
+    const SkimTree* lazySkimT_ = nullptr;
+};
+
+} // namespace fwk
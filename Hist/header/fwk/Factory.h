@@ -1,10 +1,36 @@
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "GlobalFlag.h"
+#include "fwk/IModule.h"
 #include "fwk/ModuleChain.h"
 
 namespace fwk {
 
+// One (JEC derivation level, hist stage) pair, e.g. {"L3Residual", "Closure"}.
+struct ChainTarget {
+    std::string level;
+    std::string stage;
+};
+
+std::unique_ptr<IModule> makeModule(const GlobalFlag& gf);
+
+// EventPrepModule + the channel module for gf.
 ModuleChain makeChain(const GlobalFlag& gf);
 
+// One chain for several targets of gf's channel, sharing a single read of its
+// skim and one EventPrepModule; target i writes below "<level>_<stage>/".
+ModuleChain makeChain(const GlobalFlag& gf, const std::vector<ChainTarget>& targets);
+
+// "L3Residual:Derivation,L3Residual:Closure" -> targets
+std::vector<ChainTarget> parseTargets(const std::string& spec);
+
+// ioName of the same job with its derivation level and stage replaced.
+std::string targetIoName(const std::string& ioName,
+                         const std::string& level,
+                         const std::string& stage);
+
 } // namespace fwk
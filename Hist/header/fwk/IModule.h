@@ -17,6 +17,13 @@ public:
     virtual void beginFile(Context&) {}
     virtual bool analyze(Context&, Event&) = 0;
     virtual void endJob(Context&) {}
+
+    // True for modules that loop over the tree themselves (legacy Run()).
+    virtual bool ownsEventLoop() const { return false; }
+
+    // False for modules that loop over the tree themselves: the Driver cannot
+    // snapshot or resume them at an entry boundary.
+    virtual bool supportsCheckpoint() const { return true; }
 };
 
 } // namespace fwk
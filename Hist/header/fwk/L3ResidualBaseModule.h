@@ -57,6 +57,7 @@ protected:
                                                 const TLorentzVector& p4CorrMet) = 0;
 
     virtual void fillChannelSpecificHistos(Context& ctx,
+                                           const EventProducts& products,
                                            const L3ResidualObjects& objects,
                                            const HistL3ResidualInput& input,
                                            double alpha,
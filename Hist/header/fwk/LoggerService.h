@@ -1,15 +1,82 @@
 #pragma once
 
 #include <iostream>
+#include <sstream>
 #include <string>
 
+// Compile-time switch for debug/trace logging. Build with
+// -DFWK_LOG_COMPILE_DEBUG=0 to drop every FWK_DEBUG/FWK_TRACE call site
+// (arguments included) from the binary.
+#ifndef FWK_LOG_COMPILE_DEBUG
+#define FWK_LOG_COMPILE_DEBUG 1
+#endif
+
 namespace fwk {
 
 class LoggerService {
 public:
+    enum class Level : int { Trace = 0, Debug = 1, Info = 2, Warn = 3, Error = 4, Off = 5 };
+
+    // Process-wide threshold used by the FWK_* macros (runMain sets Debug with -d).
+    static void  setLevel(Level lvl) { threshold_ = lvl; }
+    static Level level() { return threshold_; }
+    static bool  enabled(Level lvl) {
+        return static_cast<int>(lvl) >= static_cast<int>(threshold_);
+    }
+
+    // Per-key print cap shared by every caller: true for the first maxPrint calls.
+    static bool allowKey(const std::string& key, int maxPrint);
+
+    // Formats the arguments with operator<< and emits one line. Callers normally
+    // go through the macros so that nothing is formatted below the threshold.
+    template <typename... Args>
+    static void write(Level lvl, const char* tag, const Args&... args) {
+        std::ostringstream os;
+        (os << ... << args);
+        emit_(lvl, tag, os.str());
+    }
+
     void info(const std::string& msg) const;
     void warn(const std::string& msg) const;
     void error(const std::string& msg) const;
+
+private:
+    static void emit_(Level lvl, const char* tag, const std::string& msg);
+
+    inline static Level threshold_ = Level::Info;
 };
 
 } // namespace fwk
+
+// The level check happens before any argument is evaluated, so
+// FWK_DEBUG("[PickX]", "pt=", pt) costs one compare when debug is off.
+#define FWK_LOG(lvl, tag, ...)                                               \
+    do {                                                                     \
+        if (::fwk::LoggerService::enabled(lvl))                              \
+            ::fwk::LoggerService::write(lvl, tag, __VA_ARGS__);              \
+    } while (0)
+
+#if FWK_LOG_COMPILE_DEBUG
+#define FWK_TRACE(tag, ...) FWK_LOG(::fwk::LoggerService::Level::Trace, tag, __VA_ARGS__)
+#define FWK_DEBUG(tag, ...) FWK_LOG(::fwk::LoggerService::Level::Debug, tag, __VA_ARGS__)
+#define FWK_DEBUG_ON()      ::fwk::LoggerService::enabled(::fwk::LoggerService::Level::Debug)
+#else
+// Dead branch: arguments stay type-checked and "used", but generate no code.
+#define FWK_TRACE(tag, ...) do { if (false) ::fwk::LoggerService::write(::fwk::LoggerService::Level::Trace, tag, __VA_ARGS__); } while (0)
+#define FWK_DEBUG(tag, ...) do { if (false) ::fwk::LoggerService::write(::fwk::LoggerService::Level::Debug, tag, __VA_ARGS__); } while (0)
+#define FWK_DEBUG_ON()      false
+#endif
+
+#define FWK_INFO(tag, ...)  FWK_LOG(::fwk::LoggerService::Level::Info,  tag, __VA_ARGS__)
+#define FWK_WARN(tag, ...)  FWK_LOG(::fwk::LoggerService::Level::Warn,  tag, __VA_ARGS__)
+#define FWK_ERROR(tag, ...) FWK_LOG(::fwk::LoggerService::Level::Error, tag, __VA_ARGS__)
+
+// Warning printed at most maxPrint times per key over the whole process
+// (same policy as ScaleFunctionGuard's per-key caps).
+#define FWK_WARN_LIMITED(key, maxPrint, tag, ...)                                        \
+    do {                                                                                 \
+        if (::fwk::LoggerService::enabled(::fwk::LoggerService::Level::Warn) &&          \
+            ::fwk::LoggerService::allowKey(key, maxPrint))                               \
+            ::fwk::LoggerService::write(::fwk::LoggerService::Level::Warn, tag,          \
+                                        __VA_ARGS__);                                    \
+    } while (0)
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <iosfwd>
+#include <memory>
+
+class GlobalFlag;
+class HemVeto;
+class PickEvent;
+class SkimTree;
+
+namespace fwk {
+
+// Per (run, lumi) state, computed once when the Driver enters a block.
+struct LumiBlock {
+    unsigned int run = 0;
+    unsigned int lumi = 0;
+    long long firstEntry = -1; // first chain entry of the block
+
+    bool passGoodLumi = true;  // golden JSON
+    bool hemPeriod = false;    // HemVeto applies to this run
+};
+
+// Data events come sorted by run and lumi block. The Driver asks for the
+// block of every entry before reading it: only `run` and `luminosityBlock`
+// are read, and the block state is recomputed when they change. Blocks
+// outside the golden JSON can then be skipped without reading their events
+// (runMain -L); the cutflow bins before passGoodLumi lose those events.
+class LumiBlockService {
+public:
+    LumiBlockService(const GlobalFlag& gf, bool skipBadBlocks);
+    ~LumiBlockService();
+
+    const LumiBlock& at(SkimTree& skimT, long long entry);
+
+    bool skipsBadBlocks() const { return skipBadBlocks_; }
+    void noteSkipped() { ++nSkippedEntries_; }
+
+    void printSummary(std::ostream& os) const;
+
+private:
+    std::unique_ptr<PickEvent> pickEvent_;
+    std::unique_ptr<HemVeto> hemVeto_;
+    bool skipBadBlocks_;
+
+    LumiBlock block_;
+    long long nBlocks_ = 0;
+    long long nBadBlocks_ = 0;
+    long long nSkippedEntries_ = 0;
+};
+
+} // namespace fwk
@@ -7,6 +7,8 @@
 
 namespace fwk {
 
+class TimerService;
+
 class ModuleChain {
 public:
     void add(std::unique_ptr<IModule> m);
@@ -16,8 +18,17 @@ public:
     bool analyze(Context& ctx, Event& ev);
     void endJob(Context& ctx);
 
+    bool supportsCheckpoint() const;
+
+    // Per-module wall time (runMain -B). Off by default: the untimed path
+    // stays a plain loop. Times are kept per module index and handed to the
+    // timer as "module:<name>" in endJob().
+    void setTimer(TimerService* timer) { timer_ = timer; }
+
 private:
     std::vector<std::unique_ptr<IModule>> modules_;
+    TimerService* timer_ = nullptr; // non-owning
+    std::vector<double> seconds_;
 };
 
 } // namespace fwk
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GlobalFlag.h"
+#include "fwk/IModule.h"
+
+class SkimTree;
+
+namespace fwk {
+
+// Several (derivation level, stage) targets of one channel fed from a single
+// read of the skim. Each target keeps its own GlobalFlag and writes below its
+// own top-level directory of the output file.
+//
+// Targets correct the event in place, so before every target after the first
+// the fields they write are put back: the Jet_pt/Jet_mass view is reset from
+// the nano branches (never written) and Muon_pt from a per-entry copy. Only
+// per-event modules can be targets; today that is the ZmmJet L3Residual.
+class MultiTargetModule final : public IModule {
+public:
+    struct Target {
+        std::unique_ptr<GlobalFlag> gf; // owned: modules keep a reference
+        std::string topDir;
+        std::unique_ptr<IModule> module;
+    };
+
+    explicit MultiTargetModule(std::vector<Target> targets);
+    ~MultiTargetModule() override;
+
+    std::string name() const override;
+
+    void beginJob(Context& ctx) override;
+    void beginFile(Context& ctx) override;
+    bool analyze(Context& ctx, Event& ev) override;
+    void endJob(Context& ctx) override;
+
+    bool supportsCheckpoint() const override;
+
+private:
+    std::vector<Target> targets_;
+    std::vector<bool> active_;
+    std::vector<float> muonPt_; // Muon_pt as it left the shared prologue
+
+    void snapshot_(const SkimTree& skimT);
+    void restore_(SkimTree& skimT) const;
+};
+
+} // namespace fwk
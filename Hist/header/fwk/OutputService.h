@@ -12,10 +12,25 @@ public:
     explicit OutputService(TFile* fout);
 
     TFile* file() const;
+
+    // Directories are created below the top-level directory, if one is set
+    // (multi-target chains give every target its own, e.g. "L3Residual_Closure").
     TDirectory* mkdirAndCd(const std::string& dir);
 
+    void setTopDir(const std::string& dir) { topDir_ = dir; }
+    const std::string& topDir() const { return topDir_; }
+
+    // Compact mode writes through CompactWriter instead of TFile::Write.
+    void setCompact(bool compact) { compact_ = compact; }
+    bool compact() const { return compact_; }
+
+    // Final write of every in-memory object at the end of the job.
+    void write();
+
 private:
     TFile* fout_; // non-owning
+    std::string topDir_;
+    bool compact_ = false;
 };
 
 } // namespace fwk
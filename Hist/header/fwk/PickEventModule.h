@@ -5,6 +5,7 @@
 #include <TLorentzVector.h>
 
 #include "GlobalFlag.h"
+#include "fwk/Products.h"
 
 class HistCutflow;
 class PickEvent;
@@ -12,11 +13,24 @@ class SkimTree;
 
 namespace fwk {
 
+struct LumiBlock;
+
 class PickEventModule {
 public:
     explicit PickEventModule(const GlobalFlag& gf);
 
+    // With a lumi block the golden-lumi decision is read from it.
     bool passCoreEventCuts(const std::shared_ptr<SkimTree>& skimT,
+                           HistCutflow* cutflow,
+                           double weight,
+                           const LumiBlock* block = nullptr) const;
+
+    // Publishes prod::CoreSelection (all three bits, short-circuited in order).
+    void produce(const std::shared_ptr<SkimTree>& skimT, EventProducts& products,
+                 const LumiBlock* block = nullptr) const;
+
+    // Same cutflow bins, read from a published prod::CoreSelection.
+    bool passCoreEventCuts(const prod::CoreSelection& sel,
                            HistCutflow* cutflow,
                            double weight) const;
 
@@ -25,6 +39,8 @@ public:
                           double weight) const;
 
 private:
+    bool passGoodLumi(const SkimTree& skimT, const LumiBlock* block) const;
+
     std::shared_ptr<PickEvent> pickEvent_;
 };
 
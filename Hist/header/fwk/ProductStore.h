@@ -0,0 +1,98 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+namespace fwk {
+
+// Fixed set of per-event products keyed by type. Every product type owns one
+// slot in a std::tuple, so lookups resolve at compile time (asking for a type
+// that is not in the list does not compile) and nothing is allocated per
+// event: clear() only drops the valid flags, values keep their storage.
+//
+// A producer either fills a slot directly (put) or registers a lazy filler
+// that runs the first time a consumer asks for the product (putLazy).
+//
+// Each product type provides `static constexpr const char* kName`.
+template <typename... Products>
+class ProductStore {
+public:
+    template <typename P>
+    using LazyFill = void (*)(const void* producer, P& out);
+
+    // Mark P published and return its slot to fill in place.
+    template <typename P>
+    P& put() {
+        auto& s = slot_<P>();
+        s.valid = true;
+        s.lazy = nullptr;
+        return s.value;
+    }
+
+    template <typename P>
+    void put(const P& value) { put<P>() = value; }
+
+    template <typename P>
+    void putLazy(LazyFill<P> fill, const void* producer) {
+        auto& s = slot_<P>();
+        s.valid = false;
+        s.lazy = fill;
+        s.producer = producer;
+    }
+
+    // Published (possibly not yet computed) this event.
+    template <typename P>
+    bool has() const {
+        const auto& s = slot_<P>();
+        return s.valid || s.lazy;
+    }
+
+    // Handle to P, or null if nobody published it this event.
+    template <typename P>
+    const P* get() const {
+        auto& s = slot_<P>();
+        if (!s.valid && s.lazy) {
+            s.lazy(s.producer, s.value);
+            s.valid = true;
+            s.lazy = nullptr;
+        }
+        return s.valid ? &s.value : nullptr;
+    }
+
+    template <typename P>
+    const P& require() const {
+        if (const P* p = get<P>()) {
+            return *p;
+        }
+        throw std::runtime_error(std::string("ProductStore::require - product not published: ") + P::kName);
+    }
+
+    void clear() {
+        (clearSlot_<Products>(), ...);
+    }
+
+private:
+    template <typename P>
+    struct Slot {
+        P value{};
+        bool valid = false;
+        LazyFill<P> lazy = nullptr;
+        const void* producer = nullptr;
+    };
+
+    // Lazy products are computed from const accessors, hence mutable slots.
+    template <typename P>
+    Slot<P>& slot_() const { return std::get<Slot<P>>(slots_); }
+
+    template <typename P>
+    void clearSlot_() {
+        auto& s = slot_<P>();
+        s.valid = false;
+        s.lazy = nullptr;
+    }
+
+    mutable std::tuple<Slot<Products>...> slots_;
+};
+
+} // namespace fwk
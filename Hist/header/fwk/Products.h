@@ -0,0 +1,85 @@
+#pragma once
+
+#include <vector>
+
+#include <TLorentzVector.h>
+
+#include "CorrectedJets.hpp"
+#include "GlobalFlag.h"
+#include "PairMatch.hpp"
+#include "fwk/ProductStore.h"
+
+namespace fwk {
+namespace prod {
+
+// ScaleEvent::getEventWeight
+struct EventWeight {
+    static constexpr const char* kName = "EventWeight";
+    double value = 1.0;
+};
+
+// PickEvent: evaluated in order, a later bit is false once an earlier one fails.
+struct CoreSelection {
+    static constexpr const char* kName = "CoreSelection";
+    bool passHlt = false;
+    bool passGoodLumi = false;
+    bool passMatchedGenVtx = false;
+
+    bool passCore() const { return passHlt && passGoodLumi && passMatchedGenVtx; }
+};
+
+// ScaleMuon: Muon_pt of the SkimTree already carries the Rochester correction.
+struct MuonCorrection {
+    static constexpr const char* kName = "MuonCorrection";
+    bool applied = false;
+};
+
+// ScaleMuon: per reco muon, the lowest-index GenDressedLepton muon within
+// ΔR < 0.2, or -1 (always -1 in data). Matched once per event, before the
+// Rochester correction, which reads it for the MC spreading.
+struct GenMuonMatch {
+    static constexpr const char* kName = "GenMuonMatch";
+    std::vector<int> genIdx;
+};
+
+// EventPrepModule (MC, lazy): all gen jets indexed by eta. Gen jets do not
+// depend on the JEC level, so every target of a multi-target chain shares it;
+// consumers apply their own pt cut.
+struct GenJetIndex {
+    static constexpr const char* kName = "GenJetIndex";
+    EtaIndex genJets;
+};
+
+// ScaleJet: the Jet_pt/Jet_mass view holds the nominal jets corrected up to
+// `level`; `jets` carries raw, nominal and (optionally) shifted collections.
+struct JetCorrection {
+    static constexpr const char* kName = "JetCorrection";
+    GlobalFlag::JecApplicationLevel level = GlobalFlag::JecApplicationLevel::NONE;
+    const CorrectedJets* jets = nullptr; // owned by the producer
+};
+
+// HemVeto on the corrected jets.
+struct HemVetoFlag {
+    static constexpr const char* kName = "HemVetoFlag";
+    bool veto = false;
+    double mcWeight = 1.0;
+};
+
+// ScaleMet: Type-1 MET from the corrected jets (usually published lazily).
+struct CorrectedMet {
+    static constexpr const char* kName = "CorrectedMet";
+    TLorentzVector p4;
+};
+
+} // namespace prod
+
+using EventProducts = ProductStore<prod::EventWeight,
+                                   prod::CoreSelection,
+                                   prod::MuonCorrection,
+                                   prod::GenMuonMatch,
+                                   prod::GenJetIndex,
+                                   prod::JetCorrection,
+                                   prod::HemVetoFlag,
+                                   prod::CorrectedMet>;
+
+} // namespace fwk
@@ -37,6 +37,7 @@ protected:
                                         const TLorentzVector& p4CorrMet) override;
 
     void fillChannelSpecificHistos(Context& ctx,
+                                   const EventProducts& products,
                                    const L3ResidualObjects& objects,
                                    const HistL3ResidualInput& input,
                                    double alpha,
@@ -17,6 +17,10 @@ public:
 
     std::string name() const override { return label_; }
 
+    // The legacy Run() consumes the whole chain inside the first analyze() call.
+    bool ownsEventLoop() const override { return true; }
+    bool supportsCheckpoint() const override { return false; }
+
     bool analyze(Context& ctx, Event&) override {
         if (hasRun_) {
             return true;
@@ -1,9 +1,9 @@
 #pragma once
 
 #include <memory>
-#include <vector>
 
 #include "GlobalFlag.h"
+#include "fwk/Products.h"
 
 class ScaleJet;
 class SkimTree;
@@ -16,10 +16,14 @@ public:
 
     void applyCorrections(std::shared_ptr<SkimTree>& skimT) const;
 
-    const std::vector<double>& jetPtRaw() const;
+    // applyCorrections + publish prod::JetCorrection.
+    void produce(std::shared_ptr<SkimTree>& skimT, EventProducts& products) const;
+
+    const CorrectedJets& correctedJets() const;
 
 private:
     std::shared_ptr<ScaleJet> scaleJet_;
+    GlobalFlag::JecApplicationLevel level_;
 };
 
 } // namespace fwk
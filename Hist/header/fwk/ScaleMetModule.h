@@ -1,11 +1,11 @@
 #pragma once
 
 #include <memory>
-#include <vector>
 
 #include <TLorentzVector.h>
 
 #include "GlobalFlag.h"
+#include "fwk/Products.h"
 
 class ScaleMet;
 class SkimTree;
@@ -17,12 +17,24 @@ public:
     explicit ScaleMetModule(const GlobalFlag& gf);
 
     void applyCorrections(const std::shared_ptr<SkimTree>& skimT,
-                          const std::vector<double>& jetPtRaw) const;
+                          const CorrectedJets& jets) const;
 
     TLorentzVector correctedMet() const;
 
+    // Publish prod::CorrectedMet lazily: the Type-1 loop over the jets only
+    // runs if a consumer asks for it this event.
+    void produceLazy(const std::shared_ptr<SkimTree>& skimT,
+                     const CorrectedJets& jets,
+                     EventProducts& products) const;
+
 private:
+    static void fillLazy_(const void* self, prod::CorrectedMet& out);
+
     std::shared_ptr<ScaleMet> scaleMet_;
+
+    // Inputs of the pending lazy evaluation (valid for the current event).
+    mutable const std::shared_ptr<SkimTree>* lazySkimT_ = nullptr;
+    mutable const CorrectedJets* lazyJets_ = nullptr;
 };
 
 } // namespace fwk
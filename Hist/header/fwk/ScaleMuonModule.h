@@ -4,6 +4,7 @@
 
 #include "GlobalFlag.h"
 #include "ScaleMuon.h"
+#include "fwk/Products.h"
 
 class SkimTree;
 class ScaleMuon;
@@ -16,6 +17,10 @@ public:
 
     void applyCorrections(std::shared_ptr<SkimTree>& skimT) const;
 
+    // Match gen muons once (prod::GenMuonMatch), apply the corrections with
+    // those matches and publish prod::MuonCorrection.
+    void produce(std::shared_ptr<SkimTree>& skimT, EventProducts& products) const;
+
     ScaleMuon::MuSf getMuonSfs(const SkimTree& skimT,
                                int index,
                                ScaleMuon::SystLevel syst = ScaleMuon::SystLevel::Nominal) const;
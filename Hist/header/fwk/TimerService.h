@@ -11,6 +11,10 @@ public:
     void start(const std::string& key);
     void stop(const std::string& key);
 
+    // Accumulate an interval measured elsewhere (e.g. per-module times
+    // collected by ModuleChain without a map lookup per event).
+    void add(const std::string& key, double seconds);
+
     const std::unordered_map<std::string, double>& totals() const;
 
 private:
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "SkimBranch.hpp"
+
+// Corrected jet kinematics for one event, kept apart from the SkimTree branches.
+//
+// ScaleJet fills every array in a single pass over the jets: the raw inputs
+// (ScaleMet's Type-1 starting point) and the nominal JEC(+JER) result, which
+// ScaleJet then copies into the Jet_pt/Jet_mass view.
+struct CorrectedJets {
+    static constexpr int nJetMax = SkimBranch::nJetMax;
+    using Column = std::array<double, nJetMax>;
+
+    int n = 0; // jets filled this event (== min(nJet, nJetMax))
+
+    Column ptRaw{};
+    Column massRaw{};
+    Column pt{};
+    Column mass{};
+
+    void reset(int nJet) {
+        n = (nJet < nJetMax) ? nJet : nJetMax;
+    }
+};
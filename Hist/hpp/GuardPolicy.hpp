@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+// Compile-time ceiling for MathGuard, PickGuard and ScaleFunctionGuard. Build
+// with -DGUARD_POLICY_MAX=0 to drop every check from the binary, or 1 to keep
+// the checks but never record context. The guards test kGuardChecks /
+// kGuardRecord with `if constexpr` before their runtime flag, so a capped
+// build compiles the checks (and the recorder) out.
+#ifndef GUARD_POLICY_MAX
+#define GUARD_POLICY_MAX 2
+#endif
+
+inline constexpr bool kGuardChecks = GUARD_POLICY_MAX >= 1;
+inline constexpr bool kGuardRecord = GUARD_POLICY_MAX >= 2;
+
+enum class GuardPolicy : int {
+    Off            = 0, // no checks
+    CheckOnly      = 1, // finiteness/range tests on raw values; the message is
+                        // built from the failing inputs only when a check fails
+    FlightRecorder = 2, // CheckOnly + a fixed-size record of cached values that
+                        // is printed with the failure (debug runs)
+};
+
+class GuardConfig {
+public:
+    // Process-wide policy (runMain: CheckOnly, FlightRecorder with -d, or -G).
+    static void setPolicy(GuardPolicy p) { policy_ = p; }
+    static GuardPolicy policy() {
+        return static_cast<int>(policy_) < GUARD_POLICY_MAX ? policy_
+                                                            : static_cast<GuardPolicy>(GUARD_POLICY_MAX);
+    }
+
+    static GuardPolicy parse(const std::string& s) {
+        if (s == "off")    return GuardPolicy::Off;
+        if (s == "check")  return GuardPolicy::CheckOnly;
+        if (s == "record") return GuardPolicy::FlightRecorder;
+        throw std::runtime_error("GuardConfig::parse - unknown guard policy '" + s +
+                                 "' (expected off, check or record)");
+    }
+
+    static const char* name(GuardPolicy p) {
+        switch (p) {
+            case GuardPolicy::Off:            return "off";
+            case GuardPolicy::CheckOnly:      return "check";
+            case GuardPolicy::FlightRecorder: return "record";
+        }
+        return "unknown";
+    }
+
+private:
+    inline static GuardPolicy policy_ = GuardPolicy::CheckOnly;
+};
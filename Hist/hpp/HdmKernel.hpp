@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cmath>
+
+#include <TLorentzVector.h>
+
+#include "P4.hpp"
+
+// Transverse-plane vector: the only part of a four-vector the MPF projections see.
+struct P2 {
+    double px = 0.0;
+    double py = 0.0;
+
+    static inline P2 of(const TLorentzVector& v) { return {v.Px(), v.Py()}; }
+    static inline P2 of(const P4& p) { return {p.px, p.py}; }
+
+    inline double dot(const P2& o) const { return px * o.px + py * o.py; }
+    inline double norm2() const { return px * px + py * py; }
+    inline double pt() const { return std::sqrt(norm2()); }
+    // Rotated by +pi/2: (px, py) -> (-py, px)
+    inline P2 rotated90() const { return {-py, px}; }
+
+    inline P2 operator+(const P2& o) const { return {px + o.px, py + o.py}; }
+    inline P2 operator-(const P2& o) const { return {px - o.px, py - o.py}; }
+    inline P2 operator-() const { return {-px, -py}; }
+    inline P2 operator*(double s) const { return {s * px, s * py}; }
+};
+
+// HDM decomposition (Eq.8 of hdm_2023082.pdf, Eq.11 of JME-21-001) for
+// reference R, leading jet 1, other jets n and MET:
+//   Metu = -(MET + R + 1 + n), Met1 = -(R + 1), Metn = -n, Metnu = Metn + 1.1 Metu
+// The x variants project on R rotated by +pi/2.
+struct HdmResponses {
+    double bal    = 0.0;
+    double mpf    = 0.0;
+    double mpf1   = 0.0;
+    double mpfn   = 0.0;
+    double mpfu   = 0.0;
+    double mpfnu  = 0.0;
+    double mpfx   = 0.0;
+    double mpf1x  = 0.0;
+    double mpfnPt = 0.0;
+    double mpfux  = 0.0;
+    double mpfnux = 0.0;
+};
+
+// MPF-type responses of the event components along one axis, all divided by
+// the same scale; met and sumTnP carry the +1 offset.
+struct AxisResponses {
+    double met         = 0.0;
+    double sumTnP      = 0.0;
+    double probe       = 0.0; // of -probe
+    double tag         = 0.0;
+    double other       = 0.0;
+    double unclustered = 0.0;
+};
+
+// One pass over (px, py) doubles: no TLorentzVector temporaries and no
+// trigonometry. Callers guard the inputs and the results (MathGuard).
+class HdmKernel {
+public:
+    // ptRef = |ref| must be > 0
+    static inline HdmResponses compute(const P2& met, const P2& ref,
+                                       const P2& jet1, const P2& jetn) {
+        const double ptRefSqr = ref.norm2();
+        const double inv      = 1.0 / ptRefSqr;
+        const P2 refx  = ref.rotated90();
+
+        const P2 metu  = -(met + ref + jet1 + jetn);
+        const P2 met1  = -(ref + jet1);
+        const P2 metn  = -jetn;
+        const P2 metnu = metn + metu * 1.1;
+
+        HdmResponses r;
+        r.bal    = jet1.pt() / std::sqrt(ptRefSqr);
+        r.mpf    = 1.0 + met.dot(ref) * inv;
+        r.mpf1   = 1.0 + met1.dot(ref) * inv;
+        r.mpfn   = metn.dot(ref) * inv;
+        r.mpfu   = metu.dot(ref) * inv;
+        r.mpfnu  = metnu.dot(ref) * inv;
+        r.mpfx   = 1.0 + met.dot(refx) * inv;
+        r.mpf1x  = 1.0 + met1.dot(refx) * inv;
+        r.mpfnPt = metn.dot(refx) * inv;
+        r.mpfux  = metu.dot(refx) * inv;
+        r.mpfnux = metnu.dot(refx) * inv;
+        return r;
+    }
+
+    // (a + b) / |a + b|; {0, 0} if a + b vanishes
+    static inline P2 unitAxis(const P2& a, const P2& b) {
+        return normalized_(a + b);
+    }
+
+    // Bisector with equal angles to a and -b: a/|a| - b/|b|, normalised
+    static inline P2 bisectorAxis(const P2& a, const P2& b) {
+        const double na = a.pt();
+        const double nb = b.pt();
+        if (na <= 0.0 || nb <= 0.0) return {};
+        return normalized_(a * (1.0 / na) - b * (1.0 / nb));
+    }
+
+    // Responses along `axis` of MET, tag + probe, -probe, tag, other jets and
+    // the unclustered rest -(MET + tag + probe + other)
+    static inline AxisResponses project(const P2& axis, double scale,
+                                        const P2& met, const P2& tag,
+                                        const P2& probe, const P2& other) {
+        const double inv   = 1.0 / scale;
+        const double dMet  = met.dot(axis);
+        const double dTag  = tag.dot(axis);
+        const double dProb = probe.dot(axis);
+        const double dOth  = other.dot(axis);
+
+        AxisResponses r;
+        r.met         = 1.0 + dMet * inv;
+        r.sumTnP      = 1.0 + (dTag + dProb) * inv;
+        r.probe       = -dProb * inv;
+        r.tag         = dTag * inv;
+        r.other       = dOth * inv;
+        r.unclustered = -(dMet + dTag + dProb + dOth) * inv;
+        return r;
+    }
+
+private:
+    static inline P2 normalized_(const P2& v) {
+        const double n = v.pt();
+        return n > 0.0 ? v * (1.0 / n) : P2{};
+    }
+};
@@ -2,6 +2,8 @@
 
 #include <cmath>
 
+#include "P4.hpp"
+
 class HelperDelta {
 public:
     // Keep same names for downstream compatibility.
@@ -25,5 +27,13 @@ public:
         // Much faster than pow(x,2) + pow(y,2)
         return std::sqrt(dphi * dphi + deta * deta);
     }
-};
 
+    // P4 overloads: eta/phi are cached on the object, no trigonometry here.
+    static inline double DELTAPHI(const P4& a, const P4& b) {
+        return DELTAPHI(a.phi, b.phi);
+    }
+
+    static inline double DELTAR(const P4& a, const P4& b) {
+        return DELTAR(a.phi, b.phi, a.eta, b.eta);
+    }
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <TLorentzVector.h>
+
+#include "P4.hpp"
+
+// P4 <-> TLorentzVector at the boundary to ROOT APIs.
+class HelperP4 {
+public:
+    // ---------------- TLorentzVector boundary ----------------
+    static inline TLorentzVector toTLorentzVector(const P4& p) {
+        return TLorentzVector(p.px, p.py, p.pz, p.e);
+    }
+
+    static inline P4 fromTLorentzVector(const TLorentzVector& v) {
+        return P4::fromPxPyPzE(v.Px(), v.Py(), v.Pz(), v.E());
+    }
+
+    // In-place eta/mass flattening of a TLorentzVector without the
+    // Pt()/Phi()/SetPtEtaPhiM() round trip.
+    static inline void flattenEta(TLorentzVector& v) {
+        v.SetPxPyPzE(v.Px(), v.Py(), 0.0, v.Pt());
+    }
+};
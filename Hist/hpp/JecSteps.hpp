@@ -0,0 +1,116 @@
+#pragma once
+
+#include <type_traits>
+
+#include "GlobalFlag.h"
+
+// Residual step of the data JEC chain.
+enum class JecResidual { None, L2Res, L2L3Res };
+
+// Correction steps the per-jet loops of ScaleJet and ScaleMet apply, fixed for
+// a job by (data/MC, JetAlgo, JecApplicationLevel, applyJer). The loops are
+// templates over a steps type: with JecStepsFixed every test below is a
+// constant, so the compiler drops the unused steps and the bookkeeping, and
+// one specialisation per job runs without per-jet flag checks. Debug and
+// bookkeeping jobs run the JecStepsRuntime instance of the same loop.
+template <bool Data, bool L1Rc, bool L2Rel, JecResidual Res, bool Jer>
+struct JecStepsFixed {
+    static constexpr bool isData()         { return Data; }
+    static constexpr bool l1Rc()           { return L1Rc; }
+    static constexpr bool l2Rel()          { return L2Rel; }
+    static constexpr JecResidual residual() { return Res; }
+    static constexpr bool jer()            { return Jer; }
+    static constexpr bool bookKeep()       { return false; }
+    static constexpr bool debug()          { return false; }
+};
+
+struct JecStepsRuntime {
+    bool        isData_   = false;
+    bool        l1Rc_     = false;
+    bool        l2Rel_    = false;
+    JecResidual residual_ = JecResidual::None;
+    bool        jer_      = false;
+    bool        bookKeep_ = false;
+    bool        debug_    = false;
+
+    bool isData() const         { return isData_; }
+    bool l1Rc() const           { return l1Rc_; }
+    bool l2Rel() const          { return l2Rel_; }
+    JecResidual residual() const { return residual_; }
+    bool jer() const            { return jer_; }
+    bool bookKeep() const       { return bookKeep_; }
+    bool debug() const          { return debug_; }
+
+    static JecStepsRuntime of(const GlobalFlag& gf) {
+        using Level = GlobalFlag::JecApplicationLevel;
+        const Level level = gf.getJecApplicationLevel();
+
+        JecStepsRuntime s;
+        s.isData_ = gf.isData();
+        // L1 RC only for CHS; Puppi jets carry no pileup offset
+        s.l1Rc_  = level >= Level::L1Rc && gf.getJetAlgo() == GlobalFlag::JetAlgo::AK4Chs;
+        s.l2Rel_ = level >= Level::L2Rel;
+        if (s.isData_) {
+            s.residual_ = level >= Level::L2L3Res ? JecResidual::L2L3Res
+                        : level >= Level::L2Res   ? JecResidual::L2Res
+                                                  : JecResidual::None;
+        }
+        s.jer_      = gf.applyJer() && !s.isData_;
+        s.bookKeep_ = gf.isBookKeep();
+        s.debug_    = gf.isDebug();
+        return s;
+    }
+};
+
+namespace jecsteps_detail {
+
+template <class F>
+void withBool(bool b, F&& f) {
+    if (b) f(std::true_type{});
+    else   f(std::false_type{});
+}
+
+template <bool Data, bool L1Rc, bool L2Rel, class F>
+void withResidualAndJer(const JecStepsRuntime& s, F&& f) {
+    if constexpr (Data) {
+        switch (s.residual()) {
+            case JecResidual::L2L3Res: f(JecStepsFixed<Data, L1Rc, L2Rel, JecResidual::L2L3Res, false>{}); break;
+            case JecResidual::L2Res:   f(JecStepsFixed<Data, L1Rc, L2Rel, JecResidual::L2Res,   false>{}); break;
+            case JecResidual::None:    f(JecStepsFixed<Data, L1Rc, L2Rel, JecResidual::None,    false>{}); break;
+        }
+    } else {
+        withBool(s.jer(), [&](auto jer) {
+            f(JecStepsFixed<Data, L1Rc, L2Rel, JecResidual::None, decltype(jer)::value>{});
+        });
+    }
+}
+
+} // namespace jecsteps_detail
+
+// Steps object for a loop instantiated on Steps: a JecStepsFixed carries no
+// state, the runtime instance is the job's own `s`.
+template <class Steps>
+Steps jecStepsAs(const JecStepsRuntime& s) {
+    if constexpr (std::is_same_v<Steps, JecStepsRuntime>) return s;
+    else return Steps{};
+}
+
+// Calls f once with the steps of `s`: a JecStepsFixed specialisation, or `s`
+// itself for debug/bookkeeping jobs. Data jobs never smear, MC jobs never
+// apply residuals, so 20 specialisations cover every job.
+template <class F>
+void dispatchJecSteps(const JecStepsRuntime& s, F&& f) {
+    using namespace jecsteps_detail;
+    if (s.bookKeep() || s.debug()) {
+        f(s);
+        return;
+    }
+    withBool(s.isData(), [&](auto data) {
+        withBool(s.l1Rc(), [&](auto l1) {
+            withBool(s.l2Rel(), [&](auto l2) {
+                withResidualAndJer<decltype(data)::value, decltype(l1)::value,
+                                   decltype(l2)::value>(s, f);
+            });
+        });
+    });
+}
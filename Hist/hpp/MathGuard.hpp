@@ -2,66 +2,65 @@
 
 #include <cmath>
 #include <cstddef>
+#include <iostream>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
-#include <utility>
-#include <vector>
 
 #include <TLorentzVector.h> // header-only requires full type
 
+#include "GuardPolicy.hpp"
+
+// Checks are finiteness tests on the raw (px, py, pz, E) doubles. Derived
+// quantities and the message are computed only on failure. Under
+// GuardPolicy::FlightRecorder, cacheP4/cacheScalar keep the last kMaxRecords
+// raw values in a ring buffer, allocated once per guard in that mode only,
+// and print them with the failure.
 class MathGuard {
 public:
-    enum class Mode {
-        Throw,   // throw std::runtime_error
-        Warn,    // write to std::cerr and continue
-        Off      // no checks
-    };
+    static constexpr std::size_t kMaxRecords = 64;
 
-    MathGuard(std::string className,
-              std::string where,
+    MathGuard(const char* className,
+              const char* where,
               bool isDebug,
-              Mode mode = Mode::Throw)
-        : className_(std::move(className)),
-          where_(std::move(where)),
+              GuardPolicy policy = GuardConfig::policy())
+        : className_(className),
+          where_(where),
           isDebug_(isDebug),
-          mode_(mode)
-    {}
+          checks_(policy != GuardPolicy::Off),
+          record_(policy == GuardPolicy::FlightRecorder)
+    {
+        if (recordOn_()) records_.reset(new Record[kMaxRecords]);
+    }
 
-    // ---- caching (for better crash messages) ----
-    inline MathGuard& cacheScalar(const std::string& name, double v) {
-        if (mode_ == Mode::Off) return *this;
-        cachedScalars_.emplace_back(name, v);
+    // ---- flight recorder (for better crash messages) ----
+    inline MathGuard& cacheScalar(const char* name, double v) {
+        if (unlikely_(recordOn_())) {
+            Record& r = next_();
+            r.name = name;
+            r.isP4 = false;
+            r.v[0] = v;
+        }
         return *this;
     }
 
-    struct P4Snapshot {
-        double pt{0}, eta{0}, phi{0}, m{0};
-        double px{0}, py{0}, pz{0}, e{0};
-    };
-
-    inline MathGuard& cacheP4(const std::string& name, const TLorentzVector& p4) {
-        if (mode_ == Mode::Off) return *this;
-
-        P4Snapshot s;
-        // Include both (pt,eta,phi,m) and (px,py,pz,E) because ROOT can produce NaN in Eta()
-        s.pt  = p4.Pt();
-        s.eta = p4.Eta();
-        s.phi = p4.Phi();
-        s.m   = p4.M();
-        s.px  = p4.Px();
-        s.py  = p4.Py();
-        s.pz  = p4.Pz();
-        s.e   = p4.E();
-
-        cachedP4s_.emplace_back(name, s);
+    inline MathGuard& cacheP4(const char* name, const TLorentzVector& p4) {
+        if (unlikely_(recordOn_())) {
+            Record& r = next_();
+            r.name = name;
+            r.isP4 = true;
+            r.v[0] = p4.Px();
+            r.v[1] = p4.Py();
+            r.v[2] = p4.Pz();
+            r.v[3] = p4.E();
+        }
         return *this;
     }
 
     // ---- core checks ----
-    inline void requireFiniteScalar(double x, const std::string& name) const {
-        if (mode_ == Mode::Off) return;
-        if (likely_(std::isfinite(x))) return;
+    inline void requireFiniteScalar(double x, const char* name) const {
+        if (!checksOn_() || likely_(std::isfinite(x))) return;
 
         // slow path only
         std::ostringstream oss;
@@ -69,74 +68,61 @@ public:
         handleFailure_(oss.str());
     }
 
-    inline void requireFiniteP4(const TLorentzVector& p4, const std::string& name) const {
-        if (mode_ == Mode::Off) return;
-
-        // Guard both kinematics and components.
-        const double pt  = p4.Pt();
-        const double eta = p4.Eta();
-        const double phi = p4.Phi();
-        const double px  = p4.Px();
-        const double py  = p4.Py();
-        const double pz  = p4.Pz();
-        const double e   = p4.E();
-
-        if (likely_(std::isfinite(pt)  && std::isfinite(eta) && std::isfinite(phi) &&
-                    std::isfinite(px)  && std::isfinite(py)  && std::isfinite(pz)  && std::isfinite(e)))
-        {
+    inline void requireFiniteP4(const TLorentzVector& p4, const char* name) const {
+        if (!checksOn_()) return;
+        // Finite components imply finite pt/phi; eta/m are derived only for the message.
+        if (likely_(std::isfinite(p4.Px()) && std::isfinite(p4.Py()) &&
+                    std::isfinite(p4.Pz()) && std::isfinite(p4.E()))) {
             return;
         }
 
         std::ostringstream oss;
-        oss << "non-finite 4-vector: " << name
-            << " (pt=" << pt << ", eta=" << eta << ", phi=" << phi
-            << ", px=" << px << ", py=" << py << ", pz=" << pz << ", E=" << e << ")";
+        oss << "non-finite 4-vector: " << name << ' ';
+        printP4_(oss, p4.Px(), p4.Py(), p4.Pz(), p4.E());
         handleFailure_(oss.str());
     }
 
-    inline void requireDenNotSmall(double den, const std::string& denName, double eps = 1e-12) const {
+    inline void requireDenNotSmall(double den, const char* denName, double eps = 1e-12) const {
         requireFiniteScalar(den, denName);
-        if (mode_ == Mode::Off) return;
-        if (std::fabs(den) >= eps) return;
+        if (!checksOn_() || likely_(std::fabs(den) >= eps)) return;
 
         std::ostringstream oss;
         oss << "unsafe denominator: |" << denName << "| < " << eps << " (=" << den << ")";
         handleFailure_(oss.str());
     }
 
-    inline void requireAbsNotSmall(double x, const std::string& name, double eps = 1e-12) const {
+    inline void requireAbsNotSmall(double x, const char* name, double eps = 1e-12) const {
         requireFiniteScalar(x, name);
-        if (mode_ == Mode::Off) return;
-        if (std::fabs(x) >= eps) return;
+        if (!checksOn_() || likely_(std::fabs(x) >= eps)) return;
 
         std::ostringstream oss;
         oss << "unsafe value: |" << name << "| < " << eps << " (=" << x << ")";
         handleFailure_(oss.str());
     }
 
-    inline void requireUnitAxisOK(const TLorentzVector& axis, const std::string& name, double eps = 1e-12) const {
-        if (mode_ == Mode::Off) return;
+    inline void requireUnitAxisOK(const TLorentzVector& axis, const char* name, double eps = 1e-12) const {
+        if (!checksOn_()) return;
 
         const double ax = axis.Px();
         const double ay = axis.Py();
         const double az = axis.Pz();
 
-        if (!std::isfinite(ax) || !std::isfinite(ay) || !std::isfinite(az)) {
-            handleFailure_(name + " axis has non-finite components");
+        if (unlikely_(!std::isfinite(ax) || !std::isfinite(ay) || !std::isfinite(az))) {
+            handleFailure_(std::string(name) + " axis has non-finite components");
         }
-        if (axis.Vect().Mag2() < eps) {
+        if (unlikely_(ax * ax + ay * ay + az * az < eps)) {
             std::ostringstream oss;
             oss << name << " axis is degenerate (|v|^2 < " << eps << ")";
             handleFailure_(oss.str());
         }
     }
 
-    inline double safeOnePlusOverOneMinus(double a, const std::string& aName, double eps = 1e-12) const {
+    inline double safeOnePlusOverOneMinus(double a, const char* aName, double eps = 1e-12) const {
         requireFiniteScalar(a, aName);
-        if (mode_ == Mode::Off) return (1.0 + a) / (1.0 - a);
-
         const double den = 1.0 - a;
-        if (std::fabs(den) < eps) {
+        if (!checksOn_()) return (1.0 + a) / den;
+
+        if (unlikely_(std::fabs(den) < eps)) {
             std::ostringstream oss;
             oss << "unsafe ratio (1+" << aName << ")/(1-" << aName << "): denominator too small. "
                 << aName << "=" << a;
@@ -144,69 +130,94 @@ public:
         }
 
         const double out = (1.0 + a) / den;
-        requireFiniteScalar(out, "ratio(1+" + aName + ")/(1-" + aName + ")");
+        if (unlikely_(!std::isfinite(out))) {
+            std::ostringstream oss;
+            oss << "non-finite scalar: ratio(1+" << aName << ")/(1-" << aName << ")=" << out;
+            handleFailure_(oss.str());
+        }
         return out;
     }
 
     template <typename T>
-    inline void requireFiniteResult(T x, const std::string& name) const {
+    inline void requireFiniteResult(T x, const char* name) const {
         requireFiniteScalar(static_cast<double>(x), name);
     }
 
+    // Unconditional failure (the caller already tested its condition).
     [[noreturn]] inline void fail(const std::string& what) const {
-        handleFailure_(what);
-        throw std::runtime_error("MathGuard::fail internal error"); // unreachable
+        throw std::runtime_error(message_(what));
     }
 
 private:
+    struct Record {
+        const char* name;
+        bool isP4;
+        double v[4];
+    };
+
+    // GUARD_POLICY_MAX=0 (1) compiles the checks (the recorder) out;
+    // otherwise the runtime policy decides
+    bool checksOn_() const {
+        if constexpr (kGuardChecks) return checks_;
+        else return false;
+    }
+    bool recordOn_() const {
+        if constexpr (kGuardRecord) return record_;
+        else return false;
+    }
+
     static inline bool likely_(bool x)   { return __builtin_expect(!!x, 1); }
     static inline bool unlikely_(bool x) { return __builtin_expect(!!x, 0); }
 
-    inline std::string header_() const {
-        std::ostringstream oss;
-        oss << className_ << "::" << where_;
-        return oss.str();
+    // Ring buffer: once full, the oldest record is overwritten.
+    inline Record& next_() {
+        Record& r = records_[nRecorded_ % kMaxRecords];
+        ++nRecorded_;
+        return r;
+    }
+
+    static void printP4_(std::ostream& os, double px, double py, double pz, double e) {
+        TLorentzVector p4(px, py, pz, e);
+        const double pt = p4.Pt();
+        os << "(pt=" << pt << ", eta=" << (pt > 0.0 ? p4.Eta() : 0.0) << ", phi=" << p4.Phi()
+           << ", m=" << p4.M()
+           << "; px=" << px << ", py=" << py << ", pz=" << pz << ", E=" << e << ")";
     }
 
     inline std::string context_() const {
-        std::ostringstream oss;
+        if (nRecorded_ == 0) return {};
 
-        if (!cachedScalars_.empty() || !cachedP4s_.empty()) {
-            oss << "\n  cached context:";
-        }
-        for (const auto& kv : cachedScalars_) {
-            oss << "\n    " << kv.first << " = " << kv.second;
+        std::ostringstream oss;
+        oss << "\n  cached context:";
+        const std::size_t n = nRecorded_ < kMaxRecords ? nRecorded_ : kMaxRecords;
+        if (nRecorded_ > kMaxRecords) {
+            oss << "\n    (" << (nRecorded_ - kMaxRecords) << " older records dropped)";
         }
-        for (const auto& kv : cachedP4s_) {
-            const auto& n = kv.first;
-            const auto& s = kv.second;
-            oss << "\n    " << n << " = "
-                << "(pt=" << s.pt << ", eta=" << s.eta << ", phi=" << s.phi << ", m=" << s.m
-                << "; px=" << s.px << ", py=" << s.py << ", pz=" << s.pz << ", E=" << s.e << ")";
+        for (std::size_t i = nRecorded_ - n; i < nRecorded_; ++i) {
+            const Record& r = records_[i % kMaxRecords];
+            oss << "\n    " << r.name << " = ";
+            if (r.isP4) printP4_(oss, r.v[0], r.v[1], r.v[2], r.v[3]);
+            else        oss << r.v[0];
         }
         return oss.str();
     }
 
-    inline void handleFailure_(const std::string& what) const {
-        if (mode_ == Mode::Off) return;
-
+    inline std::string message_(const std::string& what) const {
         std::ostringstream msg;
-        msg << header_() << " - " << what;
-        msg << context_();
+        msg << className_ << "::" << where_ << " - " << what << context_();
+        return msg.str();
+    }
 
-        if (mode_ == Mode::Warn) {
-            std::cerr << msg.str() << std::endl;
-            return;
-        }
-        throw std::runtime_error(msg.str());
+    [[noreturn]] inline void handleFailure_(const std::string& what) const {
+        throw std::runtime_error(message_(what));
     }
 
-    std::string className_;
-    std::string where_;
+    const char* className_;
+    const char* where_;
     bool isDebug_{false}; // kept for future expansion
-    Mode mode_{Mode::Throw};
+    const bool checks_;
+    const bool record_;
 
-    std::vector<std::pair<std::string, double>> cachedScalars_;
-    std::vector<std::pair<std::string, P4Snapshot>> cachedP4s_;
+    std::size_t nRecorded_{0};
+    std::unique_ptr<Record[]> records_; // FlightRecorder only; only [0, nRecorded_) is read
 };
-
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+// Lightweight four-vector for the per-event hot paths (Pick*, HelperDelta).
+//
+// TLorentzVector is a TObject with a virtual table and a TVector3 member; every
+// SetPtEtaPhiM/Pt()/Eta()/Phi() call recomputes trigonometry.  P4 stores both the
+// Cartesian (px, py, pz, e) and the collider (pt, eta, phi, m) components, filled
+// once at construction, so accessors are plain loads and the type can live in
+// fixed-size arrays.  Convert to TLorentzVector only where ROOT APIs need one.
+struct P4 {
+    double px  = 0.0;
+    double py  = 0.0;
+    double pz  = 0.0;
+    double e   = 0.0;
+    double pt  = 0.0;
+    double eta = 0.0;
+    double phi = 0.0;
+    double m   = 0.0;
+
+    static inline P4 fromPtEtaPhiM(double pt, double eta, double phi, double m) {
+        P4 p;
+        const double apt = std::fabs(pt);
+        p.px  = apt * std::cos(phi);
+        p.py  = apt * std::sin(phi);
+        p.pz  = apt * std::sinh(eta);
+        // Same convention as TLorentzVector::SetPtEtaPhiM for negative mass.
+        p.e   = (m >= 0.0)
+              ? std::sqrt(p.px * p.px + p.py * p.py + p.pz * p.pz + m * m)
+              : std::sqrt(std::fmax(p.px * p.px + p.py * p.py + p.pz * p.pz - m * m, 0.0));
+        p.pt  = apt;
+        p.eta = eta;
+        p.phi = phi; // NanoAOD phi is already in (-pi, pi]
+        p.m   = m;
+        return p;
+    }
+
+    static inline P4 fromPxPyPzE(double px, double py, double pz, double e) {
+        P4 p;
+        p.px = px;
+        p.py = py;
+        p.pz = pz;
+        p.e  = e;
+        p.finalize_();
+        return p;
+    }
+
+    inline P4 operator+(const P4& o) const { return fromPxPyPzE(px + o.px, py + o.py, pz + o.pz, e + o.e); }
+    inline P4 operator-(const P4& o) const { return fromPxPyPzE(px - o.px, py - o.py, pz - o.pz, e - o.e); }
+    inline P4 operator-() const { return fromPxPyPzE(-px, -py, -pz, -e); }
+
+private:
+    // Derive the cached collider components from (px, py, pz, e).
+    // Conventions follow TLorentzVector: eta = +-1e10 along the beam, M() < 0 if m2 < 0.
+    inline void finalize_() {
+        pt  = std::sqrt(px * px + py * py);
+        phi = (px == 0.0 && py == 0.0) ? 0.0 : std::atan2(py, px);
+        if (pt > 0.0)      eta = std::asinh(pz / pt);
+        else if (pz > 0.0) eta =  1e10;
+        else if (pz < 0.0) eta = -1e10;
+        else               eta = 0.0;
+        const double m2 = e * e - (px * px + py * py + pz * pz);
+        m = (m2 >= 0.0) ? std::sqrt(m2) : -std::sqrt(-m2);
+    }
+};
+
+static_assert(std::is_trivially_copyable<P4>::value, "P4 must stay trivially copyable");
+
+// Component-wise accumulator: sums only (px, py, pz, e) and derives pt/eta/phi/m once.
+struct P4Sum {
+    double px = 0.0;
+    double py = 0.0;
+    double pz = 0.0;
+    double e  = 0.0;
+
+    inline void add(const P4& p) {
+        px += p.px;
+        py += p.py;
+        pz += p.pz;
+        e  += p.e;
+    }
+    inline void reset() { px = py = pz = e = 0.0; }
+    inline P4 get() const { return P4::fromPxPyPzE(px, py, pz, e); }
+    // Invariant mass only, without the trigonometry of get(); M() < 0 if m2 < 0.
+    inline double mass() const {
+        const double m2 = e * e - (px * px + py * py + pz * pz);
+        return (m2 >= 0.0) ? std::sqrt(m2) : -std::sqrt(-m2);
+    }
+};
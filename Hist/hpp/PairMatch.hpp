@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "HelperDelta.hpp"
+
+// Eta-sorted view of one SoA collection (eta, phi, pt).
+//
+// Built once per event and published as an event product (fwk::prod::GenJetIndex),
+// so every consumer, and every target of a multi-target chain, queries the same
+// index. A ΔR < r query only visits the entries with |Δeta| <= r (binary search
+// on eta) and compares ΔR² to r², so there is no sqrt or TLorentzVector per pair.
+// Ties in ΔR go to the lower collection index, as in a plain index loop.
+class EtaIndex {
+public:
+    struct Item {
+        float eta;
+        float phi;
+        float pt;
+        int   idx; // index in the source collection
+    };
+
+    // Entries i in [0, n) with accept(i) true; accept may throw (guards).
+    // The item storage is reused across events.
+    template <class Accept>
+    void build(int n, const float* eta, const float* phi, const float* pt, Accept&& accept) {
+        items_.clear();
+        for (int i = 0; i < n; ++i) {
+            if (accept(i)) items_.push_back({eta[i], phi[i], pt[i], i});
+        }
+        std::sort(items_.begin(), items_.end(), [](const Item& a, const Item& b) {
+            return a.eta < b.eta || (a.eta == b.eta && a.idx < b.idx);
+        });
+    }
+
+    bool empty() const { return items_.empty(); }
+    std::size_t size() const { return items_.size(); }
+
+    // visit(item, dR2) for every entry with ΔR < maxDeltaR, in eta order
+    template <class Visit>
+    void forEachInCone(double eta, double phi, double maxDeltaR, Visit&& visit) const {
+        const double maxDR2 = maxDeltaR * maxDeltaR;
+        auto it = std::lower_bound(items_.begin(), items_.end(), eta - maxDeltaR,
+                                   [](const Item& a, double v) { return a.eta < v; });
+        for (; it != items_.end() && it->eta <= eta + maxDeltaR; ++it) {
+            const double dEta = it->eta - eta;
+            const double dPhi = HelperDelta::DELTAPHI(it->phi, phi);
+            const double dR2  = dEta * dEta + dPhi * dPhi;
+            if (dR2 < maxDR2) visit(*it, dR2);
+        }
+    }
+
+    // Closest entry with ΔR < maxDeltaR and skip(item) false; -1 if none
+    template <class Skip>
+    int closest(double eta, double phi, double maxDeltaR, Skip&& skip) const {
+        int best = -1;
+        double bestDR2 = std::numeric_limits<double>::infinity();
+        forEachInCone(eta, phi, maxDeltaR, [&](const Item& it, double dR2) {
+            if (skip(it)) return;
+            if (dR2 < bestDR2 || (dR2 == bestDR2 && it.idx < best)) {
+                bestDR2 = dR2;
+                best    = it.idx;
+            }
+        });
+        return best;
+    }
+
+private:
+    std::vector<Item> items_;
+};
@@ -2,16 +2,20 @@
 
 #include <cstddef>
 #include <cmath>
-#include <iosfwd>
+#include <iostream>
 #include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <unordered_set>
 #include <vector>
 
 #include <TLorentzVector.h>
 
+#include "GuardPolicy.hpp"
+#include "HelperP4.hpp"
+
 class PickGuard {
 public:
     enum class Policy {
@@ -26,11 +30,13 @@ public:
         std::ostream* out = nullptr; // if null, defaults to std::cerr
     };
 
-    explicit PickGuard(std::string context)
-        : PickGuard(std::move(context), Config{}) {}
+    // `context` must outlive the guard (a string literal at every call site).
+    explicit PickGuard(const char* context)
+        : PickGuard(context, Config{}) {}
 
-    PickGuard(std::string context, Config cfg)
-        : context_(std::move(context)), cfg_(cfg)
+    PickGuard(const char* context, Config cfg)
+        : context_(context), cfg_(cfg),
+          checks_(GuardConfig::policy() != GuardPolicy::Off)
     {
         if (!cfg_.out) cfg_.out = &std::cerr;
     }
@@ -38,16 +44,28 @@ public:
     ~PickGuard() = default;
 
     // ---------------- core ----------------
+    // The message is either a literal or a callable returning std::string that
+    // is invoked only when the condition fails:
+    //   g.require(n >= 0, "NEG_N", [&] { return "n=" + std::to_string(n); });
+    inline void require(bool condition, const char* code, const char* message) {
+        if (likely_(condition || !checksOn_())) return;
+        fail_(code, message);
+    }
+
     inline void require(bool condition, const char* code, const std::string& message) {
-        if (likely_(condition)) return;
-        report_(code, message);
-        if (cfg_.policy == Policy::Throw) {
-            throw std::runtime_error(format_(code, message));
-        }
+        if (likely_(condition || !checksOn_())) return;
+        fail_(code, message);
+    }
+
+    template <typename MakeMessage,
+              typename = std::enable_if_t<std::is_invocable_r_v<std::string, MakeMessage>>>
+    inline void require(bool condition, const char* code, MakeMessage&& makeMessage) {
+        if (likely_(condition || !checksOn_())) return;
+        fail_(code, makeMessage());
     }
 
     inline void warn(bool condition, const char* code, const std::string& message) {
-        if (likely_(condition)) return;
+        if (likely_(condition || !checksOn_())) return;
         if (cfg_.policy == Policy::Throw) {
             // downgrade to warning
             Policy saved = cfg_.policy;
@@ -61,12 +79,12 @@ public:
 
     // ---------------- common checks ----------------
     inline void requireNonNull(const void* ptr, const char* name) {
-        if (likely_(ptr != nullptr)) return;
+        if (likely_(ptr != nullptr || !checksOn_())) return;
         require(false, "NULL_PTR", std::string("null pointer: ") + (name ? name : "UNKNOWN"));
     }
 
     inline void requireFinite(double x, const char* name) {
-        if (likely_(std::isfinite(x))) return;
+        if (likely_(!checksOn_() || std::isfinite(x))) return;
         // slow path only
         std::ostringstream oss;
         oss << "non-finite value: " << (name ? name : "UNKNOWN") << "=" << x;
@@ -74,7 +92,7 @@ public:
     }
 
     inline void requireIndexInRange(int idx, int n, const char* what) {
-        if (likely_(idx >= 0 && idx < n)) return;
+        if (likely_(!checksOn_() || (idx >= 0 && idx < n))) return;
         std::ostringstream oss;
         oss << "index out of range for " << (what ? what : "UNKNOWN")
             << " idx=" << idx << " n=" << n;
@@ -82,7 +100,7 @@ public:
     }
 
     inline void requireSize(std::size_t got, std::size_t expected, const char* what) {
-        if (likely_(got == expected)) return;
+        if (likely_(!checksOn_() || got == expected)) return;
         std::ostringstream oss;
         oss << "unexpected size for " << (what ? what : "UNKNOWN")
             << " got=" << got << " expected=" << expected;
@@ -90,18 +108,20 @@ public:
     }
 
     inline void requireAllFinite(const std::vector<TLorentzVector>& v, const char* what) {
+        if (!checksOn_()) return;
         for (std::size_t i = 0; i < v.size(); ++i) {
             const auto& p4 = v[i];
 
+            // Raw components only; pt/eta/phi/m are derived for the message.
+            if (likely_(std::isfinite(p4.Px()) && std::isfinite(p4.Py()) &&
+                        std::isfinite(p4.Pz()) && std::isfinite(p4.E()))) {
+                continue;
+            }
+
             const double pt  = p4.Pt();
             const double eta = p4.Eta();
             const double phi = p4.Phi();
             const double m   = p4.M();
-
-            if (likely_(std::isfinite(pt) && std::isfinite(eta) && std::isfinite(phi) && std::isfinite(m))) {
-                continue;
-            }
-
             std::ostringstream oss;
             oss << "non-finite TLorentzVector in " << (what ? what : "UNKNOWN")
                 << " i=" << i
@@ -124,6 +144,15 @@ public:
         return p4;
     }
 
+    // Same checks as makeP4, but returns the lightweight P4 (no TObject, cached pt/eta/phi/m).
+    inline P4 makeKin(double pt, double eta, double phi, double mass, const char* what) {
+        requireFiniteNamed_(pt,   what, "pt");
+        requireFiniteNamed_(eta,  what, "eta");
+        requireFiniteNamed_(phi,  what, "phi");
+        requireFiniteNamed_(mass, what, "mass");
+        return P4::fromPtEtaPhiM(pt, eta, phi, mass);
+    }
+
     // ---------------- common Pick* contracts ----------------
     inline void requireJetTriplet(const std::vector<TLorentzVector>& jets,
                                   const std::vector<int>& indices,
@@ -137,8 +166,15 @@ public:
     }
 
 private:
-    std::string context_;
+    const char* context_;
     mutable Config cfg_;
+    bool checks_{true};
+
+    // GUARD_POLICY_MAX=0 compiles every check out; otherwise the runtime policy decides
+    bool checksOn_() const {
+        if constexpr (kGuardChecks) return checks_;
+        else return false;
+    }
 
     static inline bool likely_(bool x)   { return __builtin_expect(!!x, 1); }
     static inline bool unlikely_(bool x) { return __builtin_expect(!!x, 0); }
@@ -154,19 +190,26 @@ private:
     }
 
     inline void requireFiniteNamed_(double x, const char* what, const char* field) {
-        if (likely_(std::isfinite(x))) return;
+        if (likely_(!checksOn_() || std::isfinite(x))) return;
         std::ostringstream oss;
         oss << "non-finite value: " << (what ? what : "obj") << "." << (field ? field : "field")
             << "=" << x;
         require(false, "NON_FINITE", oss.str());
     }
 
+    inline void fail_(const char* code, const std::string& message) {
+        report_(code, message);
+        if (cfg_.policy == Policy::Throw) {
+            throw std::runtime_error(format_(code, message));
+        }
+    }
+
     inline void report_(const char* code, const std::string& message) {
         if (cfg_.policy == Policy::Silent) return;
 
         if (cfg_.policy == Policy::WarnOnce) {
             // Key only built on failure (rare)
-            const std::string key = context_ + "|" + (code ? code : "UNKNOWN");
+            const std::string key = std::string(context_) + "|" + (code ? code : "UNKNOWN");
             std::lock_guard<std::mutex> lock(onceMutex_());
             auto& keys = onceKeys_();
             if (keys.find(key) != keys.end()) return;
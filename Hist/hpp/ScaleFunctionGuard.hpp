@@ -4,12 +4,12 @@
 #include <cstdint>
 #include <iostream>
 #include <limits>
-#include <mutex>
 #include <sstream>
 #include <string>
-#include <unordered_map>
 
 #include "GlobalFlag.h" // header-only: need full type
+#include "GuardPolicy.hpp"
+#include "fwk/LoggerService.h"
 
 class ScaleFunctionGuard {
 public:
@@ -25,31 +25,33 @@ public:
         double sfMaxDefault = 5.0;
     };
 
+    // `where` must outlive the guard (a string literal at every call site).
     ScaleFunctionGuard(const GlobalFlag& flags,
-                       std::string where,
+                       const char* where,
                        uint32_t run = 0,
                        uint32_t lumi = 0,
                        uint64_t event = 0)
         : flags_(flags),
-          where_(std::move(where)),
+          where_(where),
           run_(run),
           lumi_(lumi),
           event_(event),
-          isDebug_(flags_.isDebug())
+          isDebug_(flags_.isDebug()),
+          checks_(GuardConfig::policy() != GuardPolicy::Off)
     {}
 
     // Simple checks
     inline void checkIndex(const char* coll, int idx) const {
-        if (idx >= 0) return;
-        const std::string key = where_ + ":idxneg:" + (coll ? coll : "coll");
+        if (idx >= 0 || !checksOn_()) return;
+        const std::string key = std::string(where_) + ":idxneg:" + (coll ? coll : "coll");
         if (allowPrint_(key, cfg_.maxPrintPerKey)) {
             print_("WARN", std::string(coll ? coll : "coll") + " index is negative: idx=" + std::to_string(idx));
         }
     }
 
     inline void checkFinite(const char* name, double v) const {
-        if (finite_(v)) return;
-        const std::string key = where_ + ":nonfinite:" + (name ? name : "var");
+        if (finite_(v) || !checksOn_()) return;
+        const std::string key = std::string(where_) + ":nonfinite:" + (name ? name : "var");
         if (allowPrint_(key, cfg_.maxPrintPerKey)) {
             // Note: only runs on failure
             print_("WARN", std::string(name ? name : "var") + " is non-finite: v=" + std::to_string(v));
@@ -57,10 +59,11 @@ public:
     }
 
     inline void checkPtEta(double pt, double eta, const char* objLabel) const {
+        if (!checksOn_()) return;
         const char* obj = objLabel ? objLabel : "obj";
 
         if (!finite_(pt) || !finite_(eta)) {
-            const std::string key = where_ + ":kin_nonfinite:" + obj;
+            const std::string key = std::string(where_) + ":kin_nonfinite:" + obj;
             if (allowPrint_(key, cfg_.maxPrintPerKey)) {
                 print_("WARN", std::string(obj) + " has non-finite kinematics: pt=" +
                                std::to_string(pt) + " eta=" + std::to_string(eta));
@@ -69,14 +72,14 @@ public:
         }
 
         if (pt <= cfg_.minPt) {
-            const std::string key = where_ + ":pt_nonpos:" + obj;
+            const std::string key = std::string(where_) + ":pt_nonpos:" + obj;
             if (allowPrint_(key, cfg_.maxPrintPerKey)) {
                 print_("WARN", std::string(obj) + " has non-positive pt: pt=" + std::to_string(pt));
             }
         }
 
         if (std::abs(eta) > cfg_.maxAbsEta) {
-            const std::string key = where_ + ":eta_large:" + obj;
+            const std::string key = std::string(where_) + ":eta_large:" + obj;
             if (allowPrint_(key, cfg_.maxPrintPerKey)) {
                 print_("WARN", std::string(obj) + " has |eta| too large: eta=" + std::to_string(eta));
             }
@@ -85,10 +88,11 @@ public:
 
     inline void checkPtEtaPhi(double pt, double eta, double phi, const char* objLabel) const {
         checkPtEta(pt, eta, objLabel);
+        if (!checksOn_()) return;
 
         const char* obj = objLabel ? objLabel : "obj";
         if (!finite_(phi)) {
-            const std::string key = where_ + ":phi_nonfinite:" + obj;
+            const std::string key = std::string(where_) + ":phi_nonfinite:" + obj;
             if (allowPrint_(key, cfg_.maxPrintPerKey)) {
                 print_("WARN", std::string(obj) + " has non-finite phi: phi=" + std::to_string(phi));
             }
@@ -96,7 +100,7 @@ public:
         }
 
         if (std::abs(phi) > cfg_.maxAbsPhi) {
-            const std::string key = where_ + ":phi_large:" + obj;
+            const std::string key = std::string(where_) + ":phi_large:" + obj;
             if (allowPrint_(key, cfg_.maxPrintPerKey)) {
                 print_("WARN", std::string(obj) + " has |phi| too large: phi=" + std::to_string(phi));
             }
@@ -107,12 +111,13 @@ public:
                         double lo = std::numeric_limits<double>::quiet_NaN(),
                         double hi = std::numeric_limits<double>::quiet_NaN()) const
     {
+        if (!checksOn_()) return;
         const char* nm = name ? name : "sf";
         const double minv = std::isnan(lo) ? cfg_.sfMinDefault : lo;
         const double maxv = std::isnan(hi) ? cfg_.sfMaxDefault : hi;
 
         if (!finite_(sf)) {
-            const std::string key = where_ + ":sf_nonfinite:" + nm;
+            const std::string key = std::string(where_) + ":sf_nonfinite:" + nm;
             if (allowPrint_(key, cfg_.maxPrintPerKey)) {
                 print_("WARN", std::string(nm) + " is non-finite: sf=" + std::to_string(sf));
             }
@@ -120,7 +125,7 @@ public:
         }
 
         if (sf < minv || sf > maxv) {
-            const std::string key = where_ + ":sf_oob:" + nm;
+            const std::string key = std::string(where_) + ":sf_oob:" + nm;
             if (allowPrint_(key, cfg_.maxPrintPerKey)) {
                 print_("WARN", std::string(nm) + " out of expected range [" +
                                std::to_string(minv) + "," + std::to_string(maxv) + "]: sf=" +
@@ -131,13 +136,14 @@ public:
 
     inline void noteDefaultedToOne(const char* name, const char* reason) const {
         const char* nm = name ? name : "var";
-        const std::string key = where_ + ":default1:" + nm + ":" + (reason ? reason : "");
+        const std::string key = std::string(where_) + ":default1:" + nm + ":" + (reason ? reason : "");
         if (allowPrint_(key, cfg_.maxPrintPerKey)) {
             print_("WARN", std::string(nm) + " defaulted to 1.0 (" + (reason ? reason : "unknown") + ")");
         }
     }
 
     inline void noteClamp(const char* name, double before, double after, const char* reason = nullptr) const {
+        if (!checksOn_()) return;
         if (!finite_(before) || !finite_(after)) return;
         if (before == after) return;
 
@@ -145,7 +151,7 @@ public:
         const bool big = (rel > 0.20);
 
         const char* nm = name ? name : "var";
-        const std::string key = where_ + ":clamp:" + nm + (big ? ":big" : ":small");
+        const std::string key = std::string(where_) + ":clamp:" + nm + (big ? ":big" : ":small");
         if (!allowPrint_(key, cfg_.maxPrintPerKey)) return;
 
         std::string msg = std::string(nm) + " clamped: " +
@@ -158,14 +164,14 @@ public:
 
     inline void note(const char* msg) const {
         if (!isDebug_ || !cfg_.printInfoInDebug) return;
-        const std::string key = where_ + ":note:" + (msg ? msg : "");
+        const std::string key = std::string(where_) + ":note:" + (msg ? msg : "");
         if (allowPrint_(key, cfg_.maxPrintPerKey)) {
             print_("INFO", msg ? msg : "");
         }
     }
 
     inline void warn(const char* msg) const {
-        const std::string key = where_ + ":warn:" + (msg ? msg : "");
+        const std::string key = std::string(where_) + ":warn:" + (msg ? msg : "");
         if (allowPrint_(key, cfg_.maxPrintPerKey)) {
             print_("WARN", msg ? msg : "");
         }
@@ -173,23 +179,25 @@ public:
 
 private:
     const GlobalFlag& flags_;
-    std::string where_;
+    const char* where_;
     uint32_t run_{0};
     uint32_t lumi_{0};
     uint64_t event_{0};
     Cfg cfg_{};
     bool isDebug_{false};
+    bool checks_{true};
+
+    // GUARD_POLICY_MAX=0 compiles every check out; otherwise the runtime policy decides
+    bool checksOn_() const {
+        if constexpr (kGuardChecks) return checks_;
+        else return false;
+    }
 
     static inline bool finite_(double x) { return std::isfinite(x); }
 
+    // Per-key caps are shared with the FWK_WARN_LIMITED messages.
     static inline bool allowPrint_(const std::string& key, int maxPrint) {
-        static std::mutex mtx;
-        static std::unordered_map<std::string, int> counts;
-
-        std::lock_guard<std::mutex> lk(mtx);
-        int& c = counts[key];
-        if (c < maxPrint) { ++c; return true; }
-        return false;
+        return fwk::LoggerService::allowKey(key, maxPrint);
     }
 
     inline void print_(const char* level, const std::string& text) const {
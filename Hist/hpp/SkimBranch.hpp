@@ -6,6 +6,8 @@
 // Compatible with Nano V9. Type-cast for other versions in SkimAdapter
 // ------------------------------------------------------------------
 
+class SkimAdapter;
+
 // Pure data container for all branches 
 // SkimTree will inherit from this to remain backwards-compatible.
 class SkimBranch {
@@ -32,10 +34,16 @@ public:
     static const int nJetMax = 200;
 
     UInt_t  nJet{};
+    // Jet_pt/Jet_mass are the working view read by the selections. The
+    // "pt"/"mass" branches are read into Jet_ptNano/Jet_massNano, which are
+    // never written; SkimTree::getEntry copies them into the view and
+    // ScaleJet overwrites the view with one CorrectedJets variation.
     Float_t Jet_pt[nJetMax]{};
     Float_t Jet_eta[nJetMax]{};
     Float_t Jet_phi[nJetMax]{};
     Float_t Jet_mass[nJetMax]{};
+    Float_t Jet_ptNano[nJetMax]{};
+    Float_t Jet_massNano[nJetMax]{};
 
     Float_t Jet_rawFactor[nJetMax]{};
     Float_t Jet_muonSubtrFactor[nJetMax]{};
@@ -193,5 +201,45 @@ public:
     Float_t L1PreFiringWeight{};
     Float_t L1PreFiringWeight_Dn{};
     Float_t L1PreFiringWeight_Up{};
+
+    // ------------------------------------------------------------------
+    // Derived per-event quantities (filled by the analysis, not branches)
+    // ------------------------------------------------------------------
+    // JetQuality bits per jet; valid only while hasJetQualityMask is set
+    // (cleared by SkimTree::getEntry, set by JetQuality::fill).
+    UInt_t Jet_qualityMask[nJetMax]{};
+    Bool_t hasJetQualityMask{false};
+
+    // ------------------------------------------------------------------
+    // Lazily converted NanoV15 collections
+    // ------------------------------------------------------------------
+    // On NanoV15 input these arrays are read in narrower types and widened
+    // by SkimAdapter only when first required in an event. Call require()
+    // before reading them; it is a no-op for NanoV9 input or when the
+    // collection is already converted. Counters (nJet, nMuon, ...) are
+    // always converted eagerly.
+    enum V15Collection : unsigned {
+        kJetMultiplicity = 1u << 0, // Jet_chMultiplicity, Jet_neMultiplicity
+        kJetLeptonIdx    = 1u << 1, // Jet_muonIdx1/2, Jet_electronIdx1/2
+        kJetGen          = 1u << 2, // Jet_genJetIdx, Jet_partonFlavour, Jet_hadronFlavour
+        kGenJetFlavour   = 1u << 3, // GenJet_partonFlavour, GenJet_hadronFlavour
+        kPhoton          = 1u << 4, // Photon_cutBased, Photon_jetIdx, Photon_genPartIdx
+        kElectron        = 1u << 5, // Electron_cutBased
+        kMuon            = 1u << 6, // Muon_nTrackerLayers
+        kGenPart         = 1u << 7, // GenPart_genPartIdxMother, GenPart_statusFlags
+    };
+
+    void require(unsigned collections) const {
+        if (v15Pending_ & collections) convertV15_(collections);
+    }
+
+private:
+    friend class SkimAdapter;
+
+    // Set by SkimAdapter for NanoV15 input only.
+    SkimAdapter*     v15Adapter_{nullptr};
+    mutable unsigned v15Pending_{0};
+
+    void convertV15_(unsigned collections) const; // defined in SkimAdapter.cpp
 };
 
@@ -1,4 +1,5 @@
 import os
+import re
 import sys
 import json
 import itertools
@@ -22,6 +23,21 @@ def reducedJob(nJob, sKey):
             n = 1
     return int(n)
 
+#Merge per-era Data keys (..._2018A_Data_X) into year-only keys (..._2018_Data_X)
+def mergeEras(jSkim, year):
+    merged = {}
+    for sKey, (info, files) in jSkim.items():
+        yKey = re.sub(rf"_{year}[A-Z]+_Data_", f"_{year}_Data_", sKey)
+        if yKey == sKey:
+            merged[sKey] = [info, files]
+            continue
+        if yKey not in merged:
+            merged[yKey] = [{"xsecOrLumi": 0, "nEvents": 0}, []]
+        merged[yKey][0]["xsecOrLumi"] += info["xsecOrLumi"]
+        merged[yKey][0]["nEvents"]    += info["nEvents"]
+        merged[yKey][1] += files
+    return merged
+
 if __name__=="__main__":
     skimDir = "../../Skim/input/json/"
     os.system("mkdir -p json")
@@ -39,6 +55,8 @@ if __name__=="__main__":
             for oldSkimKey, newSkimKey in keyMap.items():
                 if oldSkimKey in jSkim:
                     jSkim[newSkimKey] = jSkim.pop(oldSkimKey)
+            if mergeDataEras:
+                jSkim = mergeEras(jSkim, year)
 
             fHist = open(f"json/FilesHist{stage}_{algo}_{jec}_{ch}_{year}.json", "w")
             dHist = {}
@@ -69,4 +87,5 @@ if __name__=="__main__":
             json.dump(jSkim, fSkimNew, indent=4) 
             json.dump(dHist, fHist, indent=4) 
     print(f"All jobs =  {allJobs}")
+    print("Index the skim files (entries, clusters) for the jobs with: ./runMain -x")
     
@@ -1,26 +1,34 @@
 // Common
 #include "SkimFile.h"
 #include "SkimTree.h"
+#include "SkimFileIndex.h"
 #include "RunsTree.h"
+#include "ResourceCache.h"
 #include "ScaleEvent.h"
 #include "GlobalFlag.h"
+#include "GuardPolicy.hpp"
 #include "Helper.hpp"
 #include "Logger.h"
+#include "fwk/CheckpointService.h"
 #include "fwk/ConfigService.h"
 #include "fwk/Context.h"
 #include "fwk/CutflowService.h"
 #include "fwk/Driver.h"
+#include "fwk/EventCacheService.h"
 #include "fwk/Factory.h"
 #include "fwk/LoggerService.h"
+#include "fwk/LumiBlockService.h"
 #include "fwk/OutputService.h"
 #include "fwk/TimerService.h"
 
 // system
+#include <sys/resource.h>           // getrusage (peak RSS for -B)
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>                 // getopt/optind on Linux
 #include <filesystem>
 #include <nlohmann/json.hpp>
+#include <chrono>
 #include <memory>
 #include <fstream>
 #include <iostream>
@@ -34,7 +42,8 @@ using json = nlohmann::json;
 // ----------------------------------------------
 namespace {
 
-std::vector<std::string> listJsonFiles(const std::string& jsonDir) {
+std::vector<std::string> listJsonFiles(const std::string& jsonDir,
+                                       const std::string& prefix = "FilesHist") {
     std::vector<std::string> out;
     if (!fs::exists(jsonDir)) return out;
 
@@ -44,7 +53,7 @@ std::vector<std::string> listJsonFiles(const std::string& jsonDir) {
         const auto& p = entry.path();
         const auto fname = p.filename().string();
 
-        if (p.extension() == ".json" && fname.rfind("FilesHist", 0) == 0) {
+        if (p.extension() == ".json" && fname.rfind(prefix, 0) == 0) {
             out.push_back(p.string());
         }
     }
@@ -52,6 +61,35 @@ std::vector<std::string> listJsonFiles(const std::string& jsonDir) {
 }
 
 void printHelpAndExamples(const std::vector<std::string>& jsonFiles) {
+    std::cout << "Options:\n"
+              << "  -d               debug mode (first N events, verbose)\n"
+              << "  -z               compact output: skip empty histograms, sparse 2D profiles,\n"
+              << "                   per-type compression and a CompactIndex tree\n"
+              << "  -r [-y]          prefill config/RunsTree.json for all MC samples\n"
+              << "  -x               index every file of input/json/FilesSkim_*.json (entries,\n"
+              << "                   clusters, NanoVersion, UUID) into FileIndex_*.json; jobs\n"
+              << "                   then build their TChain without opening the files\n"
+              << "  -a <n>           open the next <n> remote skim files in the background while\n"
+              << "                   the current one is read, and enable ROOT's async basket\n"
+              << "                   prefetching (default 0: off)\n"
+              << "  -L               data: skip lumi blocks outside the golden JSON without reading\n"
+              << "                   their events (passSkim/passHlt then count golden blocks only)\n"
+              << "  -S               split the sample into the M jobs at cluster boundaries,\n"
+              << "                   balanced by compressed bytes (needs -x; use it for every\n"
+              << "                   job of a sample or for none)\n"
+              << "  -c               also write output/EventCache_<ioName> for later replays\n"
+              << "  -p <cache.root>  replay an event cache instead of reading the skims\n"
+              << "  -k <minutes>     write output/<ioName>.ckpt every <minutes> of wall time\n"
+              << "  -K               resume from output/<ioName>.ckpt if it exists\n"
+              << "  -l <jobs.txt>    run every ioName listed in the file (one per line) in this process;\n"
+              << "                   several ioNames may also be given as arguments\n"
+              << "  -t <targets>     fill several <level>:<stage> targets from one read of the skim,\n"
+              << "                   e.g. -t L3Residual:Derivation,L3Residual:Closure\n"
+              << "  -B <report.json> time every module and write events/s, per-module seconds\n"
+              << "                   and peak RSS of each job as JSON (see bench/)\n"
+              << "  -G <policy>      Math/Pick/ScaleFunction guards: off, check (default) or\n"
+              << "                   record (keep cached context for failures; default with -d)\n";
+
     for (const auto& jsonFile : jsonFiles) {
         std::ifstream file(jsonFile);
         if (!file.is_open()) {
@@ -80,7 +118,194 @@ void printHelpAndExamples(const std::vector<std::string>& jsonFiles) {
     std::exit(1);
 }
 
+struct JobOptions {
+    bool isDebug = false;
+    bool compactOutput = false;     // -z
+    bool writeEventCache = false;   // -c
+    std::string replayCachePath;    // -p
+    double checkpointMinutes = 0.0; // -k
+    bool resumeCheckpoint = false;  // -K
+    std::vector<fwk::ChainTarget> targets; // -t
+    std::string benchReportPath;    // -B
+    std::string guardPolicy;        // -G (empty: check, or record with -d)
+    int prefetchFiles = 0;          // -a
+    bool skipBadLumiBlocks = false; // -L
+    bool clusterSplit = false;      // -S
+};
+
+// Peak resident set size of this process so far (Linux reports kB).
+long peakRssKb() {
+    struct rusage ru {};
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss;
+}
+
+// -l <list>: one ioName per line; blank lines and '#' comments ignored.
+std::vector<std::string> readJobList(const std::string& path) {
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        dieUsage("cannot open job list " + path);
+    }
+    std::vector<std::string> out;
+    std::string line;
+    while (std::getline(in, line)) {
+        const auto b = line.find_first_not_of(" \t\r");
+        if (b == std::string::npos || line[b] == '#') continue;
+        const auto e = line.find_last_not_of(" \t\r");
+        out.push_back(line.substr(b, e - b + 1));
+    }
+    return out;
+}
+
+// One histogramming job: everything from GlobalFlag to the written output
+// file. Corrections and JSON inputs come from ResourceCache, so later jobs in
+// the same process reuse what the first one parsed.
+int runJob(const std::string& ioName, const JobOptions& opt, json* benchReport = nullptr) {
+    const auto wallStart = std::chrono::steady_clock::now();
+
+    Helper::printBanner("Set GlobalFlag");
+    GlobalFlag globalFlag(ioName);
+    globalFlag.setDebug(opt.isDebug);
+    globalFlag.setNDebug(10000);
+    globalFlag.setPrefetchFiles(opt.prefetchFiles);
+    fwk::LoggerService::setLevel(opt.isDebug ? fwk::LoggerService::Level::Debug
+                                             : fwk::LoggerService::Level::Info);
+    GuardConfig::setPolicy(!opt.guardPolicy.empty() ? GuardConfig::parse(opt.guardPolicy)
+                           : opt.isDebug ? GuardPolicy::FlightRecorder
+                                         : GuardPolicy::CheckOnly);
+    std::cout << "[runMain] guard policy: " << GuardConfig::name(GuardConfig::policy()) << '\n';
+    globalFlag.printFlags(std::cout);
+
+    Helper::printBanner("Set and load SkimFile");
+    const std::string inJsonDir = "input/json/";
+    auto skimF = std::make_shared<SkimFile>(globalFlag, ioName, inJsonDir);
+
+    Helper::printBanner("Set and load RunsTree");
+    auto runsT = std::make_shared<RunsTree>(globalFlag);
+
+    Double_t normGenEventSumw = 1.0;
+    if (globalFlag.isMC()) {
+        const std::string cacheFilePath = "config/RunsTree.json";
+        normGenEventSumw = runsT->getCachedNormGenEventSumw(
+            skimF->getSampleKey(),
+            cacheFilePath,
+            skimF->getAllFileNames()
+        );
+    }
+
+    Helper::printBanner("Set and load SkimTree");
+    auto skimT = std::make_shared<SkimTree>(globalFlag);
+    if (opt.replayCachePath.empty()) {
+        const SkimFileIndex fileIndex(SkimFileIndex::indexPathFor(skimF->getInputJsonPath()),
+                                      skimF->getSampleKey());
+        if (opt.clusterSplit) {
+            skimF->splitAtClusters(fileIndex);
+        }
+        skimT->loadTree(skimF->getJobFileNames(), &fileIndex);
+        if (opt.clusterSplit) {
+            const auto [first, last] = skimF->getJobEntryRange();
+            skimT->setEntryRange(first, last);
+        }
+    } else {
+        std::cout << "Replaying event cache: " << opt.replayCachePath << '\n';
+        skimT->loadTree({opt.replayCachePath});
+    }
+
+    Helper::printBanner("Set and load ScaleEvent");
+    auto scaleEvent = std::make_shared<ScaleEvent>(
+        globalFlag,
+        globalFlag.getLumiPerYear(),
+        skimF->getXsecOrLumiNano(),
+        skimF->getEventsNano(),
+        normGenEventSumw
+    );
+
+    const std::string outDir = "output";
+    fs::create_directories(outDir);
+
+    auto fout = std::make_unique<TFile>((outDir + "/" + ioName).c_str(), "RECREATE");
+    if (!fout || fout->IsZombie()) {
+        throw std::runtime_error("Failed to create output ROOT file: " + outDir + "/" + ioName);
+    }
+
+    Helper::printBanner("Run framework module chain");
+
+    fwk::Context ctx(globalFlag);
+    ctx.skimT = skimT;
+    ctx.scaleEvent = scaleEvent.get();
+    ctx.out = std::make_unique<fwk::OutputService>(fout.get());
+    ctx.out->setCompact(opt.compactOutput);
+    ctx.cutflow = std::make_unique<fwk::CutflowService>();
+    ctx.timer = std::make_unique<fwk::TimerService>();
+    ctx.config = std::make_unique<fwk::ConfigService>();
+    ctx.log = std::make_unique<fwk::LoggerService>();
+    if (opt.writeEventCache) {
+        ctx.eventCache = std::make_unique<fwk::EventCacheService>(
+            globalFlag, fwk::EventCacheService::defaultPath(outDir, ioName));
+    }
+
+    if (opt.checkpointMinutes > 0.0 || opt.resumeCheckpoint) {
+        ctx.checkpoint = std::make_unique<fwk::CheckpointService>(
+            fwk::CheckpointService::defaultPath(outDir, ioName),
+            opt.checkpointMinutes > 0.0 ? 60.0 * opt.checkpointMinutes : 1e30,
+            opt.resumeCheckpoint);
+    }
+
+    if (globalFlag.isData()) {
+        // An event cache must keep every entry for later replays
+        ctx.lumiBlocks = std::make_unique<fwk::LumiBlockService>(
+            globalFlag, opt.skipBadLumiBlocks && !opt.writeEventCache);
+    }
+
+    auto chain = opt.targets.empty()
+               ? fwk::makeChain(globalFlag)
+               : fwk::makeChain(globalFlag, opt.targets);
+    if (benchReport) {
+        chain.setTimer(ctx.timer.get());
+    }
+    const int code = fwk::Driver::run(ctx, chain);
+
+    if (benchReport) {
+        const double wall = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - wallStart).count();
+        // Legacy Run() modules loop over the tree themselves, so count the
+        // entries the job covers rather than Driver iterations.
+        long long nEvents = skimT->getEntries();
+        if (globalFlag.isDebug() && nEvents > globalFlag.getNDebug() + 1) {
+            nEvents = globalFlag.getNDebug() + 1;
+        }
+        const auto& totals = ctx.timer->totals();
+        const auto loopIt = totals.find("driver:eventLoop");
+        const double loop = loopIt != totals.end() ? loopIt->second : wall;
+
+        json timers = json::object();
+        for (const auto& [key, seconds] : totals) {
+            timers[key] = seconds;
+        }
+        *benchReport = {
+            {"ioName", ioName},
+            {"channel", globalFlag.getChannelStr()},
+            {"jetAlgo", globalFlag.getJetAlgoStr()},
+            {"isMC", globalFlag.isMC()},
+            {"events", nEvents},
+            {"wallSeconds", wall},
+            {"eventLoopSeconds", loop},
+            {"eventsPerSecond", loop > 0.0 ? nEvents / loop : 0.0},
+            {"peakRssKb", peakRssKb()},
+            {"timers", timers}
+        };
+    }
+    return code;
+}
 
+void writeBenchReport(const std::string& path, const json& jobs) {
+    std::ofstream out(path);
+    if (!out.is_open()) {
+        throw std::runtime_error("writeBenchReport - cannot open " + path);
+    }
+    out << json{{"jobs", jobs}, {"peakRssKb", peakRssKb()}}.dump(2) << '\n';
+    std::cout << "[runMain] bench report -> " << path << '\n';
+}
 
 } // namespace
 
@@ -100,16 +325,58 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    bool isDebug      = false;
     bool runCacheFill = false;   // -r mode
+    bool buildFileIndex = false; // -x mode
     bool forceYes     = false;   // -y to skip confirmation
+    JobOptions jobOpt;           // -d, -z, -a, -L, -S, -c, -p, -k, -K, -t, -B, -G
+    std::string jobListPath;     // -l <jobs.txt> extra ioNames, one per line
 
     int opt;
-    while ((opt = getopt(argc, argv, "hdry")) != -1) {
+    while ((opt = getopt(argc, argv, "hdzrxya:LScp:k:Kl:t:B:G:")) != -1) {
         switch (opt) {
-            case 'd': isDebug = true; break;
+            case 'd': jobOpt.isDebug = true; break;
+            case 'z': jobOpt.compactOutput = true; break;
             case 'r': runCacheFill = true; break;
+            case 'x': buildFileIndex = true; break;
             case 'y': forceYes = true; break;
+            case 'a':
+                try {
+                    jobOpt.prefetchFiles = std::stoi(optarg);
+                } catch (const std::exception&) {
+                    dieUsage("-a expects a number of files");
+                }
+                if (jobOpt.prefetchFiles < 0) dieUsage("-a expects a number >= 0");
+                break;
+            case 'L': jobOpt.skipBadLumiBlocks = true; break;
+            case 'S': jobOpt.clusterSplit = true; break;
+            case 'c': jobOpt.writeEventCache = true; break;
+            case 'p': jobOpt.replayCachePath = optarg; break;
+            case 'k':
+                try {
+                    jobOpt.checkpointMinutes = std::stod(optarg);
+                } catch (const std::exception&) {
+                    dieUsage("-k expects a number of minutes");
+                }
+                if (!(jobOpt.checkpointMinutes > 0.0)) dieUsage("-k expects a number of minutes > 0");
+                break;
+            case 'K': jobOpt.resumeCheckpoint = true; break;
+            case 'l': jobListPath = optarg; break;
+            case 'B': jobOpt.benchReportPath = optarg; break;
+            case 'G':
+                try {
+                    GuardConfig::parse(optarg);
+                } catch (const std::exception& e) {
+                    dieUsage(e.what());
+                }
+                jobOpt.guardPolicy = optarg;
+                break;
+            case 't':
+                try {
+                    jobOpt.targets = fwk::parseTargets(optarg);
+                } catch (const std::exception& e) {
+                    dieUsage(e.what());
+                }
+                break;
             case 'h':
                 printHelpAndExamples(jsonFiles);
                 return 0;
@@ -141,79 +408,85 @@ int main(int argc, char* argv[]) {
             }
         }
 
-        return RunsTree::prefillRunsTreeCache(jsonFiles, jsonDir, isDebug);
+        return RunsTree::prefillRunsTreeCache(jsonFiles, jsonDir, jobOpt.isDebug);
     }
 
     // ---------------------------------------------------------
-    // Normal mode: expect one positional argument
+    // -x mode: per-file metadata index of the skims
     // ---------------------------------------------------------
-    if (optind >= argc) {
-        dieUsage("Output filename missing. Usage: ./runMain [-d] <ioName.root>");
-    }
-    const std::string ioName = argv[optind];
-
-    try {
-        Helper::printBanner("Set GlobalFlag");
-        GlobalFlag globalFlag(ioName);
-        globalFlag.setDebug(isDebug);
-        globalFlag.setNDebug(10000);
-        globalFlag.printFlags(std::cout);
-
-        Helper::printBanner("Set and load SkimFile");
-        const std::string inJsonDir = "input/json/";
-        auto skimF = std::make_shared<SkimFile>(globalFlag, ioName, inJsonDir);
-
-        Helper::printBanner("Set and load RunsTree");
-        auto runsT = std::make_shared<RunsTree>(globalFlag);
-
-        Double_t normGenEventSumw = 1.0;
-        if (globalFlag.isMC()) {
-            const std::string cacheFilePath = "config/RunsTree.json";
-            normGenEventSumw = runsT->getCachedNormGenEventSumw(
-                skimF->getSampleKey(),
-                cacheFilePath,
-                skimF->getAllFileNames()
-            );
+    if (buildFileIndex) {
+        const auto skimJsonFiles = listJsonFiles(jsonDir, "FilesSkim");
+        if (skimJsonFiles.empty()) {
+            std::cerr << "No FilesSkim_*.json found in directory: " << jsonDir << "\n";
+            return 1;
         }
+        return SkimFileIndex::buildIndexes(skimJsonFiles, jobOpt.isDebug);
+    }
 
-        Helper::printBanner("Set and load SkimTree");
-        auto skimT = std::make_shared<SkimTree>(globalFlag);
-        skimT->loadTree(skimF->getJobFileNames());
-
-        Helper::printBanner("Set and load ScaleEvent");
-        auto scaleEvent = std::make_shared<ScaleEvent>(
-            globalFlag,
-            globalFlag.getLumiPerYear(),
-            skimF->getXsecOrLumiNano(),
-            skimF->getEventsNano(),
-            normGenEventSumw
-        );
-
-        const std::string outDir = "output";
-        fs::create_directories(outDir);
+    // ---------------------------------------------------------
+    // Normal mode: one or more ioNames (positional and/or -l list)
+    // ---------------------------------------------------------
+    std::vector<std::string> ioNames;
+    if (!jobListPath.empty()) {
+        ioNames = readJobList(jobListPath);
+    }
+    for (int i = optind; i < argc; ++i) {
+        ioNames.emplace_back(argv[i]);
+    }
+    if (ioNames.empty()) {
+        dieUsage("Output filename missing. Usage: ./runMain [-d] [-a <n>] [-L] [-S] [-c | -p <cache.root>] [-k <minutes>] [-K] [-l <jobs.txt>] [-t <level>:<stage>,...] [-B <report.json>] [-G off|check|record] <ioName.root> [<ioName.root> ...]");
+    }
+    if (jobOpt.writeEventCache && !jobOpt.replayCachePath.empty()) {
+        dieUsage("-c and -p are mutually exclusive");
+    }
+    if (jobOpt.clusterSplit && !jobOpt.replayCachePath.empty()) {
+        dieUsage("-S splits the skims; it cannot be combined with -p");
+    }
+    if (jobOpt.writeEventCache && jobOpt.resumeCheckpoint) {
+        dieUsage("-c cannot be combined with -K (the cache would miss the checkpointed entries)");
+    }
+    if (!jobOpt.replayCachePath.empty() && ioNames.size() > 1) {
+        dieUsage("-p replays a single job's cache; give exactly one ioName");
+    }
 
-        auto fout = std::make_unique<TFile>((outDir + "/" + ioName).c_str(), "RECREATE");
-        if (!fout || fout->IsZombie()) {
-            throw std::runtime_error("Failed to create output ROOT file: " + outDir + "/" + ioName);
+    // Jobs run back to back in this process: ROOT output directories, the
+    // legacy Run() loops and the guard print caps are process-global, so
+    // running them concurrently is not safe. The gain is the shared
+    // ResourceCache (correction sets, golden JSON, veto maps, configs).
+    std::vector<std::string> failed;
+    json benchJobs = json::array();
+    for (std::size_t i = 0; i < ioNames.size(); ++i) {
+        if (ioNames.size() > 1) {
+            Helper::printBanner("Job " + std::to_string(i + 1) + "/" +
+                                std::to_string(ioNames.size()) + ": " + ioNames[i]);
         }
+        try {
+            json report;
+            if (runJob(ioNames[i], jobOpt,
+                       jobOpt.benchReportPath.empty() ? nullptr : &report) != 0) {
+                failed.push_back(ioNames[i]);
+            }
+            if (!report.is_null()) {
+                benchJobs.push_back(std::move(report));
+            }
+        }
+        catch (const std::exception& e) {
+            std::cerr << "FATAL EXCEPTION: " << e.what() << "\n";
+            failed.push_back(ioNames[i]);
+        }
+    }
 
-        Helper::printBanner("Run framework module chain");
-
-        fwk::Context ctx(globalFlag);
-        ctx.skimT = skimT;
-        ctx.scaleEvent = scaleEvent.get();
-        ctx.out = std::make_unique<fwk::OutputService>(fout.get());
-        ctx.cutflow = std::make_unique<fwk::CutflowService>();
-        ctx.timer = std::make_unique<fwk::TimerService>();
-        ctx.config = std::make_unique<fwk::ConfigService>();
-        ctx.log = std::make_unique<fwk::LoggerService>();
-
-        auto chain = fwk::makeChain(globalFlag);
-        return fwk::Driver::run(ctx, chain);
+    if (!jobOpt.benchReportPath.empty()) {
+        writeBenchReport(jobOpt.benchReportPath, benchJobs);
     }
-    catch (const std::exception& e) {
-        std::cerr << "FATAL EXCEPTION: " << e.what() << "\n";
-        return 1;
+
+    if (ioNames.size() > 1) {
+        ResourceCache::printStats(std::cout);
+        std::cout << "[runMain] " << (ioNames.size() - failed.size()) << " / "
+                  << ioNames.size() << " jobs succeeded\n";
+        for (const auto& name : failed) {
+            std::cout << "  FAILED: " << name << '\n';
+        }
     }
+    return failed.empty() ? 0 : 1;
 }
-
@@ -0,0 +1,228 @@
+# CompactUtils.py
+#
+# Merge and expand the compact output of `runMain -z` (fwk::CompactWriter):
+#   - empty histograms are not written, so a key may exist in only some inputs,
+#   - sparse TProfile2D are stored as THnSparseD (x, y, moment) with the title
+#     prefix "CompactProfile2D:" and moments 1..4 = sum w, sum wy, sum wy^2, sum w^2,
+#   - the "CompactIndex" tree lists every written object.
+# The layout constants below must match header/fwk/CompactWriter.h.
+import os
+import sys
+from collections import defaultdict
+
+import ROOT
+
+ROOT.gROOT.SetBatch(True)
+ROOT.TH1.AddDirectory(False)
+
+sys.dont_write_bytecode = True
+
+INDEX_NAME = "CompactIndex"
+SPARSE_TITLE_PREFIX = "CompactProfile2D:"
+SUMW, SUMWY, SUMWY2, SUMW2 = 1, 2, 3, 4
+
+_ALG = ROOT.RCompressionSetting.EAlgorithm
+COMPRESS_1D = ROOT.CompressionSettings(_ALG.kZSTD, 5)
+COMPRESS_2D = ROOT.CompressionSettings(_ALG.kLZMA, 8)
+COMPRESS_INDEX = ROOT.CompressionSettings(_ALG.kZLIB, 1)
+
+
+def read_compact_index(path):
+    """
+    Returns {object path: (stored class, entries)} or None for a non-compact file.
+    Only the small index tree is read; no histogram is decompressed.
+    """
+    f = ROOT.TFile.Open(path, "READ")
+    if not f or f.IsZombie():
+        raise RuntimeError(f"read_compact_index: cannot open {path}")
+    tree = f.Get(INDEX_NAME)
+    if not tree:
+        f.Close()
+        return None
+    out = {}
+    for row in tree:
+        obj_path = str(row.path)
+        stored, entries = out.get(obj_path, (str(row.stored), 0.0))
+        out[obj_path] = (stored, entries + row.entries)
+    f.Close()
+    return out
+
+
+def is_compact(path):
+    f = ROOT.TFile.Open(path, "READ")
+    if not f or f.IsZombie():
+        return False
+    ok = bool(f.GetListOfKeys().FindObject(INDEX_NAME))
+    f.Close()
+    return ok
+
+
+def _split(obj_path):
+    d, _, name = obj_path.rpartition("/")
+    return d, name
+
+
+def _out_dir(fout, d):
+    if not d:
+        return fout
+    return fout.mkdir(d, "", True)
+
+
+def _compression_for(stored):
+    if stored.startswith("THnSparse") or stored.startswith("TH2") or stored.startswith("TProfile2D"):
+        return COMPRESS_2D
+    return COMPRESS_1D
+
+
+def _copy_key(fin, fout, obj_path):
+    """Copy one object as its compressed key bytes; falls back to read/write."""
+    d, name = _split(obj_path)
+    src_dir = fin.GetDirectory(d) if d else fin
+    key = src_dir.GetKey(name)
+    dst = _out_dir(fout, d)
+    try:
+        new_key = ROOT.TKey(dst, key, 0)
+        ROOT.SetOwnership(new_key, False)
+        if not dst.GetListOfKeys().FindObject(name):
+            dst.AppendKey(new_key)
+        new_key.WriteFile(0)
+    except Exception:
+        obj = key.ReadObj()
+        dst.WriteTObject(obj, name, "Overwrite")
+
+
+def _write_index(fout, index):
+    fout.cd()
+    fout.SetCompressionSettings(COMPRESS_INDEX)
+    path, cls, stored = ROOT.std.string(), ROOT.std.string(), ROOT.std.string()
+    entries = ROOT.std.vector("double")(1)
+    filled = ROOT.std.vector("int")(1)
+    cells = ROOT.std.vector("int")(1)
+    tree = ROOT.TTree(INDEX_NAME, "CompactWriter object index")
+    tree.Branch("path", path)
+    tree.Branch("cls", cls)
+    tree.Branch("stored", stored)
+    tree.Branch("entries", entries.data(), "entries/D")
+    tree.Branch("filled", filled.data(), "filled/I")
+    tree.Branch("cells", cells.data(), "cells/I")
+    for obj_path, (st, n) in sorted(index.items()):
+        path.assign(obj_path)
+        stored.assign(st)
+        cls.assign("TProfile2D" if st.startswith("THnSparse") else st)
+        entries[0] = n
+        filled[0] = -1  # not recounted after a merge
+        cells[0] = -1
+        tree.Fill()
+    tree.Write("", ROOT.TObject.kOverwrite)
+
+
+def merge_compact(output_file, input_files):
+    """
+    Merge compact files. The merge is planned from the index trees alone:
+    objects present in a single input are copied without being decompressed,
+    the others are read, added and rewritten with the per-type compression.
+    """
+    indices = [read_compact_index(p) for p in input_files]
+    if any(i is None for i in indices):
+        raise RuntimeError("merge_compact: not every input has a CompactIndex")
+
+    owners = defaultdict(list)
+    merged_index = {}
+    for i, idx in enumerate(indices):
+        for obj_path, (stored, n) in idx.items():
+            owners[obj_path].append(i)
+            st, tot = merged_index.get(obj_path, (stored, 0.0))
+            merged_index[obj_path] = (st, tot + n)
+
+    fins = [ROOT.TFile.Open(p, "READ") for p in input_files]
+    fout = ROOT.TFile.Open(output_file, "RECREATE")
+    if not fout or fout.IsZombie():
+        raise RuntimeError(f"merge_compact: cannot create {output_file}")
+
+    n_copied = 0
+    for obj_path, who in sorted(owners.items()):
+        stored = merged_index[obj_path][0]
+        if len(who) == 1:
+            fout.SetCompressionSettings(_compression_for(stored))
+            _copy_key(fins[who[0]], fout, obj_path)
+            n_copied += 1
+            continue
+
+        objs = [fins[i].Get(obj_path) for i in who]
+        # A profile can be sparse in one job and dense in another.
+        if len({o.ClassName() for o in objs}) > 1:
+            objs = [sparse_to_profile2d(o) if _is_sparse_profile(o) else o for o in objs]
+            stored = "TProfile2D"
+            merged_index[obj_path] = (stored, merged_index[obj_path][1])
+        total = objs[0].Clone()
+        for o in objs[1:]:
+            total.Add(o)
+        d, name = _split(obj_path)
+        fout.SetCompressionSettings(_compression_for(stored))
+        _out_dir(fout, d).WriteTObject(total, name, "Overwrite")
+
+    _write_index(fout, merged_index)
+    fout.Close()
+    for f in fins:
+        f.Close()
+    print(f"[merge_compact] {len(owners)} objects ({n_copied} copied unopened) -> {output_file}")
+
+
+def _is_sparse_profile(obj):
+    return obj.InheritsFrom("THnSparse") and obj.GetTitle().startswith(SPARSE_TITLE_PREFIX)
+
+
+def sparse_to_profile2d(s):
+    """Rebuild the TProfile2D stored by CompactWriter::toSparse."""
+    title = s.GetTitle()[len(SPARSE_TITLE_PREFIX):]
+    ax, ay = s.GetAxis(0), s.GetAxis(1)
+    p = ROOT.TProfile2D(s.GetName(), title,
+                        ax.GetNbins(), ax.GetXmin(), ax.GetXmax(),
+                        ay.GetNbins(), ay.GetXmin(), ay.GetXmax())
+    for src, dst in ((ax, p.GetXaxis()), (ay, p.GetYaxis())):
+        if src.GetXbins().GetSize() > 0:
+            dst.Set(src.GetNbins(), src.GetXbins().GetArray())
+        dst.SetTitle(src.GetTitle())
+
+    idx = ROOT.std.vector("int")(3)
+    cells = [(s.GetBinContent(i, idx.data()), idx[0], idx[1], idx[2]) for i in range(s.GetNbins())]
+    if any(m == SUMW2 for _, _, _, m in cells):
+        p.Sumw2()
+    arr = p.GetArray()
+    for v, ix, iy, m in cells:
+        b = p.GetBin(ix, iy)
+        if m == SUMW:
+            p.SetBinEntries(b, v)
+        elif m == SUMWY:
+            arr[b] = v
+        elif m == SUMWY2:
+            p.GetSumw2().fArray[b] = v
+        elif m == SUMW2:
+            p.GetBinSumw2().fArray[b] = v
+    p.ResetStats()
+    p.SetEntries(s.GetEntries())
+    return p
+
+
+def expand_compact(input_file, output_file):
+    """Write a plain ROOT file with every sparse profile turned back into a TProfile2D."""
+    index = read_compact_index(input_file)
+    if index is None:
+        raise RuntimeError(f"expand_compact: {input_file} has no {INDEX_NAME}")
+    fin = ROOT.TFile.Open(input_file, "READ")
+    fout = ROOT.TFile.Open(output_file, "RECREATE")
+    for obj_path in sorted(index):
+        obj = fin.Get(obj_path)
+        if _is_sparse_profile(obj):
+            obj = sparse_to_profile2d(obj)
+        d, name = _split(obj_path)
+        _out_dir(fout, d).WriteTObject(obj, name, "Overwrite")
+    fout.Close()
+    fin.Close()
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print("Usage: python CompactUtils.py <compact.root> <expanded.root>")
+        sys.exit(1)
+    expand_compact(sys.argv[1], sys.argv[2])
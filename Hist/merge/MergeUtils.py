@@ -79,6 +79,7 @@ def run_hadd(output_file, input_files):
     Robust hadd wrapper:
       - ensures EOS output directory exists (using eos mkdir -p)
       - forces absolute XRootD URLs for EOS paths to avoid "relative path is disallowed"
+      - merges compact (`runMain -z`) outputs with CompactUtils.merge_compact
     """
     if not input_files:
         raise ValueError("run_hadd: empty input_files")
@@ -93,6 +94,13 @@ def run_hadd(output_file, input_files):
     out_arg = _eos_to_xrd(output_file)
     in_args = [_eos_to_xrd(p) for p in input_files]
 
+    # Outputs of `runMain -z` carry a CompactIndex: merge them from the index
+    # so objects found in a single job are copied without decompression.
+    from CompactUtils import is_compact, merge_compact
+    if is_compact(in_args[0]):
+        merge_compact(out_arg, in_args)
+        return
+
     cmd = ["hadd", "-f", "-v", "0", "-k", out_arg] + in_args
     subprocess.run(cmd, check=True)
 